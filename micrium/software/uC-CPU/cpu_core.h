@@ -863,6 +863,41 @@ CPU_INT64U  CPU_TS64_to_uSec(CPU_TS64  ts_cnts);
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                         CPU_TSxx_to_nSec()
+*
+* Description : Convert a 32-/64-bit CPU timestamp from timer counts to nanoseconds.
+*
+* Argument(s) : ts_cnts   CPU timestamp (in timestamp timer counts).
+*
+* Return(s)   : Converted CPU timestamp (in nanoseconds).
+*
+* Caller(s)   : Application.
+*
+*               This function is an (optional) CPU module application programming interface (API)
+*               function which MAY be implemented by application/BSP function(s) & MAY be called by
+*               application function(s).
+*
+* Note(s)     : (1) CPU_TS32_to_nSec()/CPU_TS64_to_nSec() are application/BSP functions that MAY be
+*                   optionally defined by the developer under the same conditions as CPU_TSxx_to_uSec().
+*
+*                   See also 'CPU_TSxx_to_uSec()  Notes #1 & #2'.
+*
+*               (2) Implementations SHOULD avoid a 64-bit division on each conversion, since CPU
+*                   timestamps are often converted on time-critical paths.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+CPU_INT64U  CPU_TS32_to_nSec(CPU_TS32  ts_cnts);
+#endif
+
+#if (CPU_CFG_TS_64_EN == DEF_ENABLED)
+CPU_INT64U  CPU_TS64_to_nSec(CPU_TS64  ts_cnts);
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        CONFIGURATION ERRORS
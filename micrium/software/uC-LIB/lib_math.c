@@ -70,6 +70,15 @@
 #define    MICRIUM_SOURCE
 #define    LIB_MATH_MODULE
 #include  <lib_math.h>
+#include  <lib_mem.h>
+
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+#if   (defined(_M_IX86)   || defined(_M_X64))
+#include  <intrin.h>
+#elif (defined(__i386__)  || defined(__x86_64__))
+#include  <immintrin.h>
+#endif
+#endif
 
 
 /*
@@ -78,6 +87,22 @@
 *********************************************************************************************************
 */
 
+                                                                /* Gen rand nbr streams w/ SSE2 vectors ...             */
+                                                                /* ... if sel'd by lib_mem (see Mem_SIMD_ImplGet()).    */
+#if ((LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)                   && \
+     (defined(_M_IX86)   || defined(_M_X64) || \
+      defined(__i386__)  || defined(__x86_64__)))
+#define  MATH_RAND_STREAM_SIMD_EN               DEF_ENABLED
+#else
+#define  MATH_RAND_STREAM_SIMD_EN               DEF_DISABLED
+#endif
+
+#if (defined(__GNUC__) && (MATH_RAND_STREAM_SIMD_EN == DEF_ENABLED))
+#define  MATH_SIMD_TGT(ext)                     __attribute__((target(ext)))
+#else
+#define  MATH_SIMD_TGT(ext)
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -99,6 +124,14 @@
 *********************************************************************************************************
 */
 
+static  const  CPU_INT32U  Math_RandStreamJumpTbl[4] = {        /* Jump poly, 2^64 outputs (see Math_RandLaneJump()).   */
+    0x8764000Bu, 0xF542D2D3u, 0x6FA035C3u, 0x77F2DB5Bu
+};
+
+static  const  CPU_INT32U  Math_RandStreamLongJumpTbl[4] = {    /* Jump poly, 2^96 outputs (see Math_RandLaneJump()).   */
+    0xB523952Eu, 0x0B6F099Fu, 0xCCF5A0EFu, 0x1C580662u
+};
+
 
 /*
 *********************************************************************************************************
@@ -115,6 +148,24 @@ RAND_NBR  Math_RandSeedCur;                                     /* Cur rand nbr
 *********************************************************************************************************
 */
 
+static  void  Math_RandLaneJump         (       MATH_RAND_STREAM  *p_stream,
+                                                CPU_INT08U         lane,
+                                         const  CPU_INT32U        *p_jump_tbl);
+
+static  void  Math_RandStreamGen        (       MATH_RAND_STREAM  *p_stream,
+                                                CPU_INT32U        *p_tbl,
+                                                CPU_SIZE_T         nbr_steps);
+
+static  void  Math_RandStreamGen_Portable(      MATH_RAND_STREAM  *p_stream,
+                                                CPU_INT32U        *p_tbl,
+                                                CPU_SIZE_T         nbr_steps);
+
+#if (MATH_RAND_STREAM_SIMD_EN == DEF_ENABLED)
+static  void  Math_RandStreamGen_SSE2   (       MATH_RAND_STREAM  *p_stream,
+                                                CPU_INT32U        *p_tbl,
+                                                CPU_SIZE_T         nbr_steps);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -279,3 +330,427 @@ RAND_NBR  Math_RandSeed (RAND_NBR  seed)
     return (rand_nbr);
 }
 
+
+/*
+*********************************************************************************************************
+*                                        Math_RandStreamInit()
+*
+* Description : Initialize a random number stream.
+*
+* Argument(s) : p_stream    Pointer to random number stream to initialize.
+*
+*               seed        Seed shared by a set of independent streams.
+*
+*               stream_nbr  Number of the stream within the set of streams of the same seed (see Note #2).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The seed is expanded into the first lane's 128-bit state with the SplitMix64
+*                   generator, which can NOT return zero twice in a row, so the state is NEVER zero.
+*                   Each following lane is the previous lane advanced by 2^96 outputs (see 'lib_math.h
+*                   RANDOM NUMBER STREAM DEFINES  Note #1b').
+*
+*               (2) Stream 'stream_nbr' is stream 0 advanced by 'stream_nbr' jumps of 2^64 outputs; the
+*                   initialization time is thus proportional to 'stream_nbr', which is intended to
+*                   number tasks or flows.
+*
+*               (3) A stream returns the same sequence for the same seed & stream number, on any CPU &
+*                   with or without vector instructions.
+*********************************************************************************************************
+*/
+
+void  Math_RandStreamInit (MATH_RAND_STREAM  *p_stream,
+                           CPU_INT32U         seed,
+                           CPU_INT32U         stream_nbr)
+{
+    CPU_INT64U  z;
+    CPU_INT64U  mix;
+    CPU_INT32U  i;
+    CPU_INT08U  w;
+    CPU_INT08U  lane;
+
+
+    z = (CPU_INT64U)seed;                                       /* Expand seed w/ SplitMix64 (see Note #1).             */
+    for (w = 0u; w < 4u; w += 2u) {
+        z   += 0x9E3779B97F4A7C15uLL;
+        mix  = z;
+        mix  = (mix ^ (mix >> 30u)) * 0xBF58476D1CE4E5B9uLL;
+        mix  = (mix ^ (mix >> 27u)) * 0x94D049BB133111EBuLL;
+        mix  =  mix ^ (mix >> 31u);
+        p_stream->State[w     ][0] = (CPU_INT32U) mix;
+        p_stream->State[w + 1u][0] = (CPU_INT32U)(mix >> 32u);
+    }
+
+    for (lane = 1u; lane < MATH_RAND_STREAM_NBR_LANES; lane++) {
+        for (w = 0u; w < 4u; w++) {                             /* Start each lane 2^96 outputs after prev lane.        */
+            p_stream->State[w][lane] = p_stream->State[w][lane - 1u];
+        }
+        Math_RandLaneJump(p_stream, lane, Math_RandStreamLongJumpTbl);
+    }
+
+    for (i = 0u; i < stream_nbr; i++) {                         /* Adv to stream nbr (see Note #2).                     */
+        Math_RandStreamJump(p_stream);
+    }
+
+    p_stream->BufIx = MATH_RAND_STREAM_NBR_LANES;               /* Buf empty.                                           */
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Math_RandStreamJump()
+*
+* Description : Advance a random number stream by 2^64 outputs per lane.
+*
+* Argument(s) : p_stream    Pointer to random number stream.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Math_RandStreamInit(),
+*               Application.
+*
+* Note(s)     : (1) Outputs already generated but NOT yet returned are discarded.
+*********************************************************************************************************
+*/
+
+void  Math_RandStreamJump (MATH_RAND_STREAM  *p_stream)
+{
+    CPU_INT08U  lane;
+
+
+    for (lane = 0u; lane < MATH_RAND_STREAM_NBR_LANES; lane++) {
+        Math_RandLaneJump(p_stream, lane, Math_RandStreamJumpTbl);
+    }
+
+    p_stream->BufIx = MATH_RAND_STREAM_NBR_LANES;               /* Discard buf'd outputs (see Note #1).                 */
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Math_RandStreamGet()
+*
+* Description : Get the next pseudo-random number of a random number stream.
+*
+* Argument(s) : p_stream    Pointer to random number stream.
+*
+* Return(s)   : Next pseudo-random number, in the range [0, DEF_INT_32U_MAX_VAL].
+*
+* Caller(s)   : Math_RandStreamFill(),
+*               Application.
+*
+* Note(s)     : (1) Math_RandStreamGet() is re-entrant for distinct streams & accesses NO shared data, so
+*                   it requires NO critical section; a stream MUST NOT be used by more than one task.
+*
+*               (2) All lanes are advanced together; their outputs are then returned in lane order.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  Math_RandStreamGet (MATH_RAND_STREAM  *p_stream)
+{
+    CPU_INT32U  rand_nbr;
+
+
+    if (p_stream->BufIx >= MATH_RAND_STREAM_NBR_LANES) {        /* If buf empty, adv all lanes (see Note #2).           */
+        Math_RandStreamGen_Portable(p_stream, p_stream->Buf, 1u);
+        p_stream->BufIx = 0u;
+    }
+
+    rand_nbr = p_stream->Buf[p_stream->BufIx];
+    p_stream->BufIx++;
+
+    return (rand_nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Math_RandStreamFill()
+*
+* Description : Fill a table with the next pseudo-random numbers of a random number stream.
+*
+* Argument(s) : p_stream    Pointer to random number stream.
+*
+*               p_tbl       Pointer to table to fill.
+*
+*               nbr         Number of pseudo-random numbers to generate.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The table receives the same numbers as 'nbr' calls to Math_RandStreamGet(); whole
+*                   steps of all lanes are generated directly into the table, with vector instructions
+*                   if available (see 'lib_mem.h  MEMORY LIBRARY SIMD OPTIMIZATION CONFIGURATION').
+*********************************************************************************************************
+*/
+
+void  Math_RandStreamFill (MATH_RAND_STREAM  *p_stream,
+                           CPU_INT32U        *p_tbl,
+                           CPU_SIZE_T         nbr)
+{
+    CPU_SIZE_T  nbr_steps;
+
+
+    while ((nbr             > 0u) &&                            /* Rtn buf'd outputs first.                             */
+           (p_stream->BufIx < MATH_RAND_STREAM_NBR_LANES)) {
+       *p_tbl = p_stream->Buf[p_stream->BufIx];
+        p_stream->BufIx++;
+        p_tbl++;
+        nbr--;
+    }
+
+    nbr_steps = nbr / MATH_RAND_STREAM_NBR_LANES;               /* Gen whole steps into tbl (see Note #1).              */
+    if (nbr_steps > 0u) {
+        Math_RandStreamGen(p_stream, p_tbl, nbr_steps);
+        p_tbl += nbr_steps * MATH_RAND_STREAM_NBR_LANES;
+        nbr   -= nbr_steps * MATH_RAND_STREAM_NBR_LANES;
+    }
+
+    while (nbr > 0u) {                                          /* Rtn rem'ing outputs from a new buf.                  */
+       *p_tbl = Math_RandStreamGet(p_stream);
+        p_tbl++;
+        nbr--;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         Math_RandLaneJump()
+*
+* Description : Advance one lane of a random number stream by a jump polynomial.
+*
+* Argument(s) : p_stream    Pointer to random number stream.
+*
+*               lane        Lane to advance.
+*
+*               p_jump_tbl  Pointer to jump polynomial, 128 bits in four words, least significant first :
+*
+*                               Math_RandStreamJumpTbl          Advance by 2^64 outputs.
+*                               Math_RandStreamLongJumpTbl      Advance by 2^96 outputs.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Math_RandStreamInit(),
+*               Math_RandStreamJump().
+*
+* Note(s)     : (1) The jumped state is the sum (XOR) of the states that follow the lane's state by each
+*                   power of the jump polynomial's set bits, as in the xoshiro128** reference jump().
+*********************************************************************************************************
+*/
+
+static  void  Math_RandLaneJump (       MATH_RAND_STREAM  *p_stream,
+                                        CPU_INT08U         lane,
+                                 const  CPU_INT32U        *p_jump_tbl)
+{
+    CPU_INT32U  s[4];
+    CPU_INT32U  jump[4];
+    CPU_INT32U  t;
+    CPU_INT08U  w;
+    CPU_INT08U  b;
+    CPU_INT08U  i;
+
+
+    for (w = 0u; w < 4u; w++) {
+        s[w]    = p_stream->State[w][lane];
+        jump[w] = 0u;
+    }
+
+    for (i = 0u; i < 4u; i++) {
+        for (b = 0u; b < 32u; b++) {
+            if ((p_jump_tbl[i] & (1uL << b)) != 0u) {           /* Sum states for set poly bits (see Note #1).          */
+                for (w = 0u; w < 4u; w++) {
+                    jump[w] ^= s[w];
+                }
+            }
+            t     = s[1] << 9u;                                 /* Adv state by one output.                             */
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3]  = (s[3] << 11u) | (s[3] >> 21u);
+        }
+    }
+
+    for (w = 0u; w < 4u; w++) {
+        p_stream->State[w][lane] = jump[w];
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Math_RandStreamGen()
+*
+* Description : Advance all lanes of a random number stream, storing their outputs.
+*
+* Argument(s) : p_stream    Pointer to random number stream.
+*
+*               p_tbl       Pointer to table to receive 'nbr_steps' * MATH_RAND_STREAM_NBR_LANES outputs.
+*
+*               nbr_steps   Number of times to advance all lanes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Math_RandStreamFill().
+*
+* Note(s)     : (1) Both implementations generate identical outputs.
+*********************************************************************************************************
+*/
+
+static  void  Math_RandStreamGen (MATH_RAND_STREAM  *p_stream,
+                                  CPU_INT32U        *p_tbl,
+                                  CPU_SIZE_T         nbr_steps)
+{
+#if (MATH_RAND_STREAM_SIMD_EN == DEF_ENABLED)
+    switch (Mem_SIMD_ImplGet()) {
+        case LIB_MEM_SIMD_IMPL_SSE2:
+        case LIB_MEM_SIMD_IMPL_AVX2:                            /* Lanes fill one SSE2 vector.                          */
+             Math_RandStreamGen_SSE2(p_stream, p_tbl, nbr_steps);
+             break;
+
+
+        default:
+             Math_RandStreamGen_Portable(p_stream, p_tbl, nbr_steps);
+             break;
+    }
+#else
+    Math_RandStreamGen_Portable(p_stream, p_tbl, nbr_steps);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                    Math_RandStreamGen_Portable()
+*
+* Description : Advance all lanes of a random number stream, storing their outputs, one lane at a time.
+*
+* Argument(s) : p_stream    Pointer to random number stream.
+*
+*               p_tbl       Pointer to table to receive 'nbr_steps' * MATH_RAND_STREAM_NBR_LANES outputs.
+*
+*               nbr_steps   Number of times to advance all lanes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Math_RandStreamGet(),
+*               Math_RandStreamGen().
+*
+* Note(s)     : (1) xoshiro128** output is rotl(s1 * 5, 7) * 9, from the state BEFORE it is advanced.
+*********************************************************************************************************
+*/
+
+static  void  Math_RandStreamGen_Portable (MATH_RAND_STREAM  *p_stream,
+                                           CPU_INT32U        *p_tbl,
+                                           CPU_SIZE_T         nbr_steps)
+{
+    CPU_INT32U  s0;
+    CPU_INT32U  s1;
+    CPU_INT32U  s2;
+    CPU_INT32U  s3;
+    CPU_INT32U  t;
+    CPU_SIZE_T  step;
+    CPU_INT08U  lane;
+
+
+    for (lane = 0u; lane < MATH_RAND_STREAM_NBR_LANES; lane++) {
+        s0 = p_stream->State[0][lane];
+        s1 = p_stream->State[1][lane];
+        s2 = p_stream->State[2][lane];
+        s3 = p_stream->State[3][lane];
+
+        for (step = 0u; step < nbr_steps; step++) {
+            t  = s1 * 5u;                                       /* Output (see Note #1).                                */
+            t  = (t << 7u) | (t >> 25u);
+            p_tbl[(step * MATH_RAND_STREAM_NBR_LANES) + lane] = t * 9u;
+
+            t   = s1 << 9u;                                     /* Adv state.                                           */
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= t;
+            s3  = (s3 << 11u) | (s3 >> 21u);
+        }
+
+        p_stream->State[0][lane] = s0;
+        p_stream->State[1][lane] = s1;
+        p_stream->State[2][lane] = s2;
+        p_stream->State[3][lane] = s3;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                      Math_RandStreamGen_SSE2()
+*
+* Description : Advance all lanes of a random number stream, storing their outputs, with SSE2 vectors.
+*
+* Argument(s) : p_stream    Pointer to random number stream.
+*
+*               p_tbl       Pointer to table to receive 'nbr_steps' * MATH_RAND_STREAM_NBR_LANES outputs.
+*
+*               nbr_steps   Number of times to advance all lanes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Math_RandStreamGen().
+*
+* Note(s)     : (1) SSE2 has NO 32-bit multiply; the multiplications by 5 & 9 are shifts & adds.
+*********************************************************************************************************
+*/
+
+#if (MATH_RAND_STREAM_SIMD_EN == DEF_ENABLED)
+MATH_SIMD_TGT("sse2")
+static  void  Math_RandStreamGen_SSE2 (MATH_RAND_STREAM  *p_stream,
+                                       CPU_INT32U        *p_tbl,
+                                       CPU_SIZE_T         nbr_steps)
+{
+    __m128i     s0;
+    __m128i     s1;
+    __m128i     s2;
+    __m128i     s3;
+    __m128i     t;
+    CPU_SIZE_T  step;
+
+
+    s0 = _mm_loadu_si128((const __m128i *)&p_stream->State[0][0]);
+    s1 = _mm_loadu_si128((const __m128i *)&p_stream->State[1][0]);
+    s2 = _mm_loadu_si128((const __m128i *)&p_stream->State[2][0]);
+    s3 = _mm_loadu_si128((const __m128i *)&p_stream->State[3][0]);
+
+    for (step = 0u; step < nbr_steps; step++) {
+        t  = _mm_add_epi32(_mm_slli_epi32(s1, 2), s1);          /* Output : rotl(s1 * 5, 7) * 9 (see Note #1).          */
+        t  = _mm_or_si128(_mm_slli_epi32(t, 7), _mm_srli_epi32(t, 25));
+        t  = _mm_add_epi32(_mm_slli_epi32(t, 3), t);
+        _mm_storeu_si128((__m128i *)&p_tbl[step * MATH_RAND_STREAM_NBR_LANES], t);
+
+        t  = _mm_slli_epi32(s1, 9);                             /* Adv state.                                           */
+        s2 = _mm_xor_si128(s2, s0);
+        s3 = _mm_xor_si128(s3, s1);
+        s1 = _mm_xor_si128(s1, s2);
+        s0 = _mm_xor_si128(s0, s3);
+        s2 = _mm_xor_si128(s2, t);
+        s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+    }
+
+    _mm_storeu_si128((__m128i *)&p_stream->State[0][0], s0);
+    _mm_storeu_si128((__m128i *)&p_stream->State[1][0], s1);
+    _mm_storeu_si128((__m128i *)&p_stream->State[2][0], s2);
+    _mm_storeu_si128((__m128i *)&p_stream->State[3][0], s3);
+}
+#endif
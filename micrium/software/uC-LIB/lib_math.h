@@ -172,6 +172,29 @@
 #define  RAND_LCG_PARAM_B                              12345u   /* See Note #1b1A3.                                     */
 
 
+/*
+*********************************************************************************************************
+*                                    RANDOM NUMBER STREAM DEFINES
+*
+* Note(s) : (1) (a) Each random number stream is a set of MATH_RAND_STREAM_NBR_LANES xoshiro128** generators
+*                   (lanes), by D. Blackman & S. Vigna, whose 32-bit outputs are interleaved :
+*
+*                       (1) xoshiro128** has a 128-bit state, a period of 2^128 - 1 & 32-bit outputs.
+*
+*                       (2) Its jump functions advance a state by 2^64 or 2^96 outputs.
+*
+*                   (b) The lanes of a stream are 2^96 outputs apart; streams of the same seed are 2^64
+*                       outputs apart.  So up to 2^32 streams of the same seed do NOT overlap for their
+*                       first 2^64 outputs per lane.
+*
+*               (2) Random number streams are NOT shared : each stream is owned by a single task, so NO
+*                   critical section is required (see 'lib_math.c  Math_RandStreamGet()  Note #1').
+*********************************************************************************************************
+*/
+
+#define  MATH_RAND_STREAM_NBR_LANES                        4u   /* See Note #1a.                                        */
+
+
 /*
 *********************************************************************************************************
 *                                             DATA TYPES
@@ -187,6 +210,22 @@
 typedef  CPU_INT32U  RAND_NBR;
 
 
+/*
+*********************************************************************************************************
+*                                    RANDOM NUMBER STREAM DATA TYPE
+*
+* Note(s) : (1) Lane states are stored word by word, so that each word of all lanes can be loaded in a
+*               single vector.
+*********************************************************************************************************
+*/
+
+typedef  struct  math_rand_stream {
+    CPU_INT32U  State[4][MATH_RAND_STREAM_NBR_LANES];           /* Lane states, word by word (see Note #1).             */
+    CPU_INT32U  Buf[MATH_RAND_STREAM_NBR_LANES];                /* Last outputs of all lanes ...                        */
+    CPU_INT08U  BufIx;                                          /* ... & ix of next output to rtn.                      */
+} MATH_RAND_STREAM;
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -278,6 +317,19 @@ RAND_NBR  Math_Rand       (void);
 
 RAND_NBR  Math_RandSeed   (RAND_NBR  seed);
 
+                                                                /* --------------- RAND NBR STREAM FNCTS -------------- */
+void        Math_RandStreamInit(MATH_RAND_STREAM  *p_stream,
+                                CPU_INT32U         seed,
+                                CPU_INT32U         stream_nbr);
+
+void        Math_RandStreamJump(MATH_RAND_STREAM  *p_stream);
+
+CPU_INT32U  Math_RandStreamGet (MATH_RAND_STREAM  *p_stream);
+
+void        Math_RandStreamFill(MATH_RAND_STREAM  *p_stream,
+                                CPU_INT32U        *p_tbl,
+                                CPU_SIZE_T         nbr);
+
 
 /*
 *********************************************************************************************************
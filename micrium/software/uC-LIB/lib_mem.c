@@ -65,6 +65,23 @@
 #include  "lib_math.h"
 #include  "lib_str.h"
 
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+#if   (defined(_M_IX86)   || defined(_M_X64))
+#include  <intrin.h>
+#include  <immintrin.h>
+#elif (defined(__i386__)  || defined(__x86_64__))
+#include  <cpuid.h>
+#include  <immintrin.h>
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include  <arm_neon.h>
+#endif
+#endif
+
+#if ((LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED) && \
+      defined(_MSC_VER))
+#include  <intrin.h>
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -72,6 +89,73 @@
 *********************************************************************************************************
 */
 
+#define  LIB_MEM_SIMD_ARCH_NONE                           0u
+#define  LIB_MEM_SIMD_ARCH_X86                            1u
+#define  LIB_MEM_SIMD_ARCH_NEON                           2u
+
+#if   (defined(_M_IX86)   || defined(_M_X64) || \
+       defined(__i386__)  || defined(__x86_64__))
+#define  LIB_MEM_SIMD_ARCH                      LIB_MEM_SIMD_ARCH_X86
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define  LIB_MEM_SIMD_ARCH                      LIB_MEM_SIMD_ARCH_NEON
+#else
+#define  LIB_MEM_SIMD_ARCH                      LIB_MEM_SIMD_ARCH_NONE
+#endif
+
+                                                                /* Compile SSE2/AVX2 fncts w/o cfg'ing whole file ...   */
+                                                                /* ... for AVX2 (see Mem_SIMD_Init()).                  */
+#if (defined(__GNUC__) && (LIB_MEM_SIMD_ARCH == LIB_MEM_SIMD_ARCH_X86))
+#define  LIB_MEM_SIMD_TGT(ext)                  __attribute__((target(ext)))
+#else
+#define  LIB_MEM_SIMD_TGT(ext)
+#endif
+
+#define  LIB_MEM_SIMD_SIZE_MIN                           32u    /* Min size handled by SIMD fncts (widest vector).      */
+
+                                                                /* ---------------- LOCK-FREE DYN POOL ---------------- */
+#if (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED)
+#if   defined(_MSC_VER)
+#define  MEM_ATOMIC_RD_64(p_val)                               (*((CPU_INT64U volatile *)(p_val)))
+#define  MEM_ATOMIC_RD_SIZE(p_val)                             (*((CPU_SIZE_T volatile *)(p_val)))
+#define  MEM_ATOMIC_CAS_64(p_val, val_cur, val_new)           ((CPU_INT64U)_InterlockedCompareExchange64((__int64 volatile *)(p_val), \
+                                                                                                          (__int64)(val_new),          \
+                                                                                                          (__int64)(val_cur)) == (CPU_INT64U)(val_cur))
+#if (CPU_CFG_ADDR_SIZE == CPU_WORD_SIZE_64)
+#define  MEM_ATOMIC_CAS_SIZE(p_val, val_cur, val_new)          MEM_ATOMIC_CAS_64((p_val), (val_cur), (val_new))
+#else
+#define  MEM_ATOMIC_CAS_SIZE(p_val, val_cur, val_new)         ((CPU_SIZE_T)_InterlockedCompareExchange((long volatile *)(p_val), \
+                                                                                                        (long)(val_new),          \
+                                                                                                        (long)(val_cur)) == (CPU_SIZE_T)(val_cur))
+#endif
+
+#elif defined(__GNUC__)
+#define  MEM_ATOMIC_RD_64(p_val)                                __atomic_load_n((CPU_INT64U volatile *)(p_val), __ATOMIC_ACQUIRE)
+#define  MEM_ATOMIC_RD_SIZE(p_val)                              __atomic_load_n((CPU_SIZE_T volatile *)(p_val), __ATOMIC_ACQUIRE)
+#define  MEM_ATOMIC_CAS_64(p_val, val_cur, val_new)             __sync_bool_compare_and_swap((CPU_INT64U volatile *)(p_val), \
+                                                                                             (CPU_INT64U)(val_cur),          \
+                                                                                             (CPU_INT64U)(val_new))
+#define  MEM_ATOMIC_CAS_SIZE(p_val, val_cur, val_new)           __sync_bool_compare_and_swap((CPU_SIZE_T volatile *)(p_val), \
+                                                                                             (CPU_SIZE_T)(val_cur),          \
+                                                                                             (CPU_SIZE_T)(val_new))
+#else
+#error  "LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN illegally #define'd in 'lib_cfg.h'"
+#error  "                                  [Compiler atomics NOT supported]"
+#endif
+
+                                                                /* Tagged free list head (see 'lib_mem.h  DYNAMIC ...   */
+                                                                /* ... MEMORY POOL DATA TYPE  Note #3').                */
+#define  MEM_DYN_POOL_TOP_OFFSET_MSK            ((CPU_INT64U)DEF_INT_32U_MAX_VAL)
+#define  MEM_DYN_POOL_TOP_TAG_INC               ((CPU_INT64U)1u << DEF_INT_32_NBR_BITS)
+
+#define  MEM_DYN_POOL_TOP_NEXT(top, offset)   ((((top) & ~MEM_DYN_POOL_TOP_OFFSET_MSK) + MEM_DYN_POOL_TOP_TAG_INC) | (CPU_INT64U)(offset))
+
+#define  MEM_DYN_POOL_BLK_TO_OFFSET(p_pool, p_blk)      (((p_blk) == DEF_NULL) ? 0u : \
+                                                         (CPU_INT32U)((CPU_ADDR)(p_blk) - (p_pool)->PoolSegPtr->AddrBase + 1u))
+
+#define  MEM_DYN_POOL_OFFSET_TO_BLK(p_pool, offset)     (((offset) == 0u) ? DEF_NULL : \
+                                                         (void *)((p_pool)->PoolSegPtr->AddrBase + (CPU_ADDR)(offset) - 1u))
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -86,6 +170,25 @@
 *********************************************************************************************************
 */
 
+typedef  struct  mem_slab_page {                                /* ------------------ SLAB PAGE HDR ------------------- */
+    MEM_SLAB    *SlabPtr;                                       /* Ptr to slab that owns page.                          */
+    CPU_INT08U   ClassIx;                                       /* Ix of page's size class.                             */
+} MEM_SLAB_PAGE;
+
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+typedef  void         (*MEM_SIMD_SET_FNCT) (       CPU_INT08U  *p_mem,
+                                                   CPU_INT08U   data_val,
+                                                   CPU_SIZE_T   size);
+
+typedef  void         (*MEM_SIMD_COPY_FNCT)(       CPU_INT08U  *p_dest,
+                                            const  CPU_INT08U  *p_src,
+                                                   CPU_SIZE_T   size);
+
+typedef  CPU_BOOLEAN  (*MEM_SIMD_CMP_FNCT) (const  CPU_INT08U  *p1_mem,
+                                            const  CPU_INT08U  *p2_mem,
+                                                   CPU_SIZE_T   size);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -93,6 +196,19 @@
 *********************************************************************************************************
 */
 
+                                                                /* Slab class sizes, in LIB_MEM_CFG_SLAB_ALIGN units.   */
+static  const  CPU_INT08U  Mem_SlabClassMultTbl[LIB_MEM_SLAB_CLASS_NBR] = {
+    1u,  2u,  3u,  4u,  6u,  8u, 12u, 16u, 24u, 32u
+};
+
+                                                                /* Slab class ix, per (size - 1) / SLAB_ALIGN.          */
+static  const  CPU_INT08U  Mem_SlabClassIxTbl[32u] = {
+    0u,  1u,  2u,  3u,  4u,  4u,  5u,  5u,
+    6u,  6u,  6u,  6u,  7u,  7u,  7u,  7u,
+    8u,  8u,  8u,  8u,  8u,  8u,  8u,  8u,
+    9u,  9u,  9u,  9u,  9u,  9u,  9u,  9u
+};
+
 
 /*
 *********************************************************************************************************
@@ -111,6 +227,21 @@ MEM_SEG      Mem_SegHeap;                                       /* Heap mem seg.
 
 MEM_SEG     *Mem_SegHeadPtr;                                    /* Ptr to head of seg list.                             */
 
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+MEM_SLAB    *Mem_SlabHeadPtr;                                   /* Ptr to head of slab list.                            */
+#endif
+
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+static  CPU_INT08U          Mem_SIMD_Impl     = LIB_MEM_SIMD_IMPL_NONE;         /* Cur SIMD impl.                       */
+static  CPU_INT08U          Mem_SIMD_Avail    = DEF_BIT(LIB_MEM_SIMD_IMPL_NONE);/* SIMD impls supported by CPU.         */
+static  CPU_INT32U          Mem_SIMD_Feat     = DEF_BIT_NONE;                   /* SIMD features reported by CPU.       */
+                                                                /* SIMD fncts; NULL selects portable fncts.             */
+static  MEM_SIMD_SET_FNCT   Mem_SIMD_SetFnct  = DEF_NULL;
+static  MEM_SIMD_COPY_FNCT  Mem_SIMD_CopyFnct = DEF_NULL;
+static  MEM_SIMD_COPY_FNCT  Mem_SIMD_MoveFnct = DEF_NULL;
+static  MEM_SIMD_CMP_FNCT   Mem_SIMD_CmpFnct  = DEF_NULL;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -155,6 +286,31 @@ static  void          Mem_DynPoolCreateInternal(const  CPU_CHAR      *p_name,
                                                        CPU_SIZE_T     blk_qty_max,
                                                        LIB_ERR       *p_err);
 
+static  CPU_SIZE_T    Mem_DynPoolBlkCntReserve (       MEM_DYN_POOL  *p_pool,
+                                                       CPU_SIZE_T     blk_nbr);
+
+static  CPU_BOOLEAN   Mem_DynPoolBlkCntRelease (       MEM_DYN_POOL  *p_pool,
+                                                       CPU_SIZE_T     blk_nbr);
+
+static  CPU_SIZE_T    Mem_DynPoolListPop       (       MEM_DYN_POOL  *p_pool,
+                                                       void         **pp_head,
+                                                       CPU_SIZE_T     blk_nbr);
+
+static  void          Mem_DynPoolListPush      (       MEM_DYN_POOL  *p_pool,
+                                                       void          *p_head,
+                                                       void          *p_tail);
+
+static  CPU_SIZE_T    Mem_DynPoolBlkGetInternal(       MEM_DYN_POOL  *p_pool,
+                                                       void         **pp_head,
+                                                       CPU_SIZE_T     blk_nbr,
+                                                       LIB_ERR       *p_err);
+
+static  void          Mem_DynPoolBlkFreeInternal(      MEM_DYN_POOL  *p_pool,
+                                                       void          *p_head,
+                                                       void          *p_tail,
+                                                       CPU_SIZE_T     blk_nbr,
+                                                       LIB_ERR       *p_err);
+
 #if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
 static  void          Mem_SegAllocTrackCritical(const  CPU_CHAR      *p_name,
                                                        MEM_SEG       *p_seg,
@@ -168,6 +324,84 @@ static  CPU_BOOLEAN   Mem_PoolBlkIsValidAddr   (       MEM_POOL      *p_pool,
                                                        void          *p_mem);
 #endif
 
+static  void          Mem_SlabPageAdd          (       MEM_SLAB      *p_slab,
+                                                       CPU_INT08U     class_ix,
+                                                       LIB_ERR       *p_err);
+
+static  CPU_SIZE_T    Mem_SlabBlkGetBatch      (       MEM_SLAB      *p_slab,
+                                                       CPU_INT08U     class_ix,
+                                                       void         **pp_head,
+                                                       CPU_SIZE_T     blk_nbr,
+                                                       LIB_ERR       *p_err);
+
+static  void          Mem_SlabBlkPutBatch      (       MEM_SLAB      *p_slab,
+                                                       CPU_INT08U     class_ix,
+                                                       void          *p_head,
+                                                       void          *p_tail,
+                                                       CPU_SIZE_T     blk_nbr);
+
+static  CPU_INT08U    Mem_SlabBlkClassIxGet    (       MEM_SLAB      *p_slab,
+                                                       void          *p_blk,
+                                                       LIB_ERR       *p_err);
+
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+static  void          Mem_SIMD_Init            (       void);
+
+#if (LIB_MEM_SIMD_ARCH == LIB_MEM_SIMD_ARCH_X86)
+static  void          Mem_SIMD_CPUID           (       CPU_INT32U     leaf,
+                                                       CPU_INT32U    *regs);
+
+static  void          Mem_SIMD_Set_SSE2        (       CPU_INT08U    *p_mem,
+                                                       CPU_INT08U     data_val,
+                                                       CPU_SIZE_T     size);
+
+static  void          Mem_SIMD_Set_AVX2        (       CPU_INT08U    *p_mem,
+                                                       CPU_INT08U     data_val,
+                                                       CPU_SIZE_T     size);
+
+static  void          Mem_SIMD_Copy_SSE2       (       CPU_INT08U    *p_dest,
+                                                const  CPU_INT08U    *p_src,
+                                                       CPU_SIZE_T     size);
+
+static  void          Mem_SIMD_Copy_AVX2       (       CPU_INT08U    *p_dest,
+                                                const  CPU_INT08U    *p_src,
+                                                       CPU_SIZE_T     size);
+
+static  void          Mem_SIMD_Move_SSE2       (       CPU_INT08U    *p_dest,
+                                                const  CPU_INT08U    *p_src,
+                                                       CPU_SIZE_T     size);
+
+static  void          Mem_SIMD_Move_AVX2       (       CPU_INT08U    *p_dest,
+                                                const  CPU_INT08U    *p_src,
+                                                       CPU_SIZE_T     size);
+
+static  CPU_BOOLEAN   Mem_SIMD_Cmp_SSE2        (const  CPU_INT08U    *p1_mem,
+                                                const  CPU_INT08U    *p2_mem,
+                                                       CPU_SIZE_T     size);
+
+static  CPU_BOOLEAN   Mem_SIMD_Cmp_AVX2        (const  CPU_INT08U    *p1_mem,
+                                                const  CPU_INT08U    *p2_mem,
+                                                       CPU_SIZE_T     size);
+
+#elif (LIB_MEM_SIMD_ARCH == LIB_MEM_SIMD_ARCH_NEON)
+static  void          Mem_SIMD_Set_NEON        (       CPU_INT08U    *p_mem,
+                                                       CPU_INT08U     data_val,
+                                                       CPU_SIZE_T     size);
+
+static  void          Mem_SIMD_Copy_NEON       (       CPU_INT08U    *p_dest,
+                                                const  CPU_INT08U    *p_src,
+                                                       CPU_SIZE_T     size);
+
+static  void          Mem_SIMD_Move_NEON       (       CPU_INT08U    *p_dest,
+                                                const  CPU_INT08U    *p_src,
+                                                       CPU_SIZE_T     size);
+
+static  CPU_BOOLEAN   Mem_SIMD_Cmp_NEON        (const  CPU_INT08U    *p1_mem,
+                                                const  CPU_INT08U    *p2_mem,
+                                                       CPU_SIZE_T     size);
+#endif
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -191,6 +425,7 @@ static  CPU_BOOLEAN   Mem_PoolBlkIsValidAddr   (       MEM_POOL      *p_pool,
 *
 *                   (a) Initialize heap memory pool
 *                   (b) Initialize      memory pool table
+*                   (c) Select SIMD implementation of memory functions      See 'Mem_SIMD_Init()'
 *
 *
 * Argument(s) : none.
@@ -209,8 +444,15 @@ static  CPU_BOOLEAN   Mem_PoolBlkIsValidAddr   (       MEM_POOL      *p_pool,
 void  Mem_Init (void)
 {
 
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)                        /* ----------------- SEL SIMD IMPL ------------------ */
+    Mem_SIMD_Init();
+#endif
+
                                                                 /* ------------------ INIT SEG LIST ------------------- */
     Mem_SegHeadPtr = DEF_NULL;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    Mem_SlabHeadPtr = DEF_NULL;
+#endif
 
 #if (LIB_MEM_CFG_HEAP_SIZE > 0u)
     {
@@ -299,6 +541,9 @@ void  Mem_Clr (void        *pmem,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (4) When LIB_MEM_CFG_SIMD_EN is ENABLED, buffers of at least LIB_MEM_SIMD_SIZE_MIN octets are
+*                   filled by the SIMD implementation selected by Mem_Init(), if any.
 *********************************************************************************************************
 */
 
@@ -323,6 +568,14 @@ void  Mem_Set (void        *pmem,
     }
 #endif
 
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+    if ((size             >= LIB_MEM_SIMD_SIZE_MIN) &&         /* See Note #4.                                         */
+        (Mem_SIMD_SetFnct != DEF_NULL)) {
+        Mem_SIMD_SetFnct((CPU_INT08U *)pmem, data_val, size);
+        return;
+    }
+#endif
+
 
     data_align = 0u;
     for (i = 0u; i < sizeof(CPU_ALIGN); i++) {                  /* Fill each data_align octet with data val.            */
@@ -406,6 +659,13 @@ void  Mem_Set (void        *pmem,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (5) When LIB_MEM_CFG_SIMD_EN is ENABLED, buffers of at least LIB_MEM_SIMD_SIZE_MIN octets are
+*                   copied by the SIMD implementation selected by Mem_Init(), if any. The SIMD implementation
+*                   preserves Note #2b.
+*
+*                   When LIB_MEM_CFG_OPTIMIZE_ASM_EN is ENABLED, the assembly-optimized Mem_Copy() is used
+*                   instead.
 *********************************************************************************************************
 */
 
@@ -438,6 +698,14 @@ void  Mem_Copy (       void        *pdest,
     }
 #endif
 
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+    if ((size              >= LIB_MEM_SIMD_SIZE_MIN) &&        /* See Note #5.                                         */
+        (Mem_SIMD_CopyFnct != DEF_NULL)) {
+        Mem_SIMD_CopyFnct((CPU_INT08U *)pdest, (const CPU_INT08U *)psrc, size);
+        return;
+    }
+#endif
+
 
     size_rem           =  size;
 
@@ -518,6 +786,9 @@ void  Mem_Copy (       void        *pdest,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (5) When LIB_MEM_CFG_SIMD_EN is ENABLED, buffers of at least LIB_MEM_SIMD_SIZE_MIN octets are
+*                   moved by the SIMD implementation selected by Mem_Init(), if any.
 *********************************************************************************************************
 */
 
@@ -556,6 +827,14 @@ void  Mem_Move (       void        *pdest,
         return;
     }
 
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+    if ((size              >= LIB_MEM_SIMD_SIZE_MIN) &&        /* See Note #5.                                         */
+        (Mem_SIMD_MoveFnct != DEF_NULL)) {
+        Mem_SIMD_MoveFnct(pmem_08_dest, pmem_08_src, size);
+        return;
+    }
+#endif
+
     size_rem           =  size;
 
     pmem_08_dest       = (      CPU_INT08U *)pdest + size - 1;
@@ -642,6 +921,9 @@ void  Mem_Move (       void        *pdest,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (5) When LIB_MEM_CFG_SIMD_EN is ENABLED, buffers of at least LIB_MEM_SIMD_SIZE_MIN octets are
+*                   compared by the SIMD implementation selected by Mem_Init(), if any.
 *********************************************************************************************************
 */
 
@@ -671,6 +953,12 @@ CPU_BOOLEAN  Mem_Cmp (const  void        *p1_mem,
         return (DEF_NO);
     }
 
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+    if ((size             >= LIB_MEM_SIMD_SIZE_MIN) &&         /* See Note #5.                                         */
+        (Mem_SIMD_CmpFnct != DEF_NULL)) {
+        return (Mem_SIMD_CmpFnct((const CPU_INT08U *)p1_mem, (const CPU_INT08U *)p2_mem, size));
+    }
+#endif
 
     mem_cmp         =  DEF_YES;                                 /* Assume mem bufs are identical until cmp fails.       */
     size_rem        =  size;
@@ -733,6 +1021,145 @@ CPU_BOOLEAN  Mem_Cmp (const  void        *p1_mem,
 }
 
 
+/*
+*********************************************************************************************************
+*                                         Mem_SIMD_FeatGet()
+*
+* Description : Gets the SIMD features of the CPU, as detected by Mem_Init().
+*
+* Argument(s) : none.
+*
+* Return(s)   : Bit field of LIB_MEM_SIMD_FEAT_xxx, DEF_BIT_NONE if no SIMD feature is available.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Lets the application select its own vectorized code from the same detection as the
+*                   memory functions (see 'Mem_SIMD_Init()  Note #3').
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+CPU_INT32U  Mem_SIMD_FeatGet (void)
+{
+    return (Mem_SIMD_Feat);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_SIMD_ImplGet()
+*
+* Description : Gets the SIMD implementation used by the memory functions.
+*
+* Argument(s) : none.
+*
+* Return(s)   : LIB_MEM_SIMD_IMPL_NONE,     if the portable implementation is used.
+*
+*               LIB_MEM_SIMD_IMPL_SSE2,
+*               LIB_MEM_SIMD_IMPL_AVX2,
+*               LIB_MEM_SIMD_IMPL_NEON,     otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+CPU_INT08U  Mem_SIMD_ImplGet (void)
+{
+    return (Mem_SIMD_Impl);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_SIMD_ImplSet()
+*
+* Description : Sets the SIMD implementation used by the memory functions.
+*
+* Argument(s) : impl        SIMD implementation :
+*
+*                               LIB_MEM_SIMD_IMPL_NONE      Portable implementation.
+*                               LIB_MEM_SIMD_IMPL_SSE2      x86 128-bit vectors.
+*                               LIB_MEM_SIMD_IMPL_AVX2      x86 256-bit vectors.
+*                               LIB_MEM_SIMD_IMPL_NEON      ARM 128-bit vectors.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                    Operation was successful.
+*                               LIB_MEM_ERR_INVALID_SIMD_IMPL       Implementation NOT supported by CPU.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_SIMD_Init(),
+*               Application.
+*
+* Note(s)     : (1) Mem_Init() selects the widest implementation supported by the CPU; this function allows
+*                   the application to select a narrower one, e.g. to compare implementations.
+*
+*               (2) The implementation MUST NOT be changed while other tasks may call the memory functions.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+void  Mem_SIMD_ImplSet (CPU_INT08U   impl,
+                        LIB_ERR     *p_err)
+{
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for null err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+    if ((impl > LIB_MEM_SIMD_IMPL_NEON) ||
+        (DEF_BIT_IS_SET(Mem_SIMD_Avail, DEF_BIT(impl)) == DEF_NO)) {
+       *p_err = LIB_MEM_ERR_INVALID_SIMD_IMPL;
+        return;
+    }
+
+    switch (impl) {
+#if (LIB_MEM_SIMD_ARCH == LIB_MEM_SIMD_ARCH_X86)
+        case LIB_MEM_SIMD_IMPL_SSE2:
+             Mem_SIMD_SetFnct  = Mem_SIMD_Set_SSE2;
+             Mem_SIMD_CopyFnct = Mem_SIMD_Copy_SSE2;
+             Mem_SIMD_MoveFnct = Mem_SIMD_Move_SSE2;
+             Mem_SIMD_CmpFnct  = Mem_SIMD_Cmp_SSE2;
+             break;
+
+        case LIB_MEM_SIMD_IMPL_AVX2:
+             Mem_SIMD_SetFnct  = Mem_SIMD_Set_AVX2;
+             Mem_SIMD_CopyFnct = Mem_SIMD_Copy_AVX2;
+             Mem_SIMD_MoveFnct = Mem_SIMD_Move_AVX2;
+             Mem_SIMD_CmpFnct  = Mem_SIMD_Cmp_AVX2;
+             break;
+
+#elif (LIB_MEM_SIMD_ARCH == LIB_MEM_SIMD_ARCH_NEON)
+        case LIB_MEM_SIMD_IMPL_NEON:
+             Mem_SIMD_SetFnct  = Mem_SIMD_Set_NEON;
+             Mem_SIMD_CopyFnct = Mem_SIMD_Copy_NEON;
+             Mem_SIMD_MoveFnct = Mem_SIMD_Move_NEON;
+             Mem_SIMD_CmpFnct  = Mem_SIMD_Cmp_NEON;
+             break;
+#endif
+
+        case LIB_MEM_SIMD_IMPL_NONE:
+        default:
+             Mem_SIMD_SetFnct  = DEF_NULL;
+             Mem_SIMD_CopyFnct = DEF_NULL;
+             Mem_SIMD_MoveFnct = DEF_NULL;
+             Mem_SIMD_CmpFnct  = DEF_NULL;
+             break;
+    }
+
+    Mem_SIMD_Impl = impl;
+   *p_err         = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           Mem_HeapAlloc()
@@ -1496,6 +1923,21 @@ void  Mem_PoolCreate (MEM_POOL          *p_pool,
         return;
     }
 
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* ------------ ALLOC MEM FOR ALLOC BITMAP ------------ */
+    p_pool->BlkAllocTbl = (CPU_INT08U *)Mem_SegAllocInternal("Unnamed static pool alloc bitmap",
+                                                             &Mem_SegHeap,
+                                                             (blk_nbr + (DEF_OCTET_NBR_BITS - 1u)) / DEF_OCTET_NBR_BITS,
+                                                              sizeof(CPU_ALIGN),
+                                                              LIB_MEM_PADDING_ALIGN_NONE,
+                                                              p_bytes_reqd,
+                                                              p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return;
+    }
+                                                                /* All blks start free.                                 */
+    Mem_Clr(p_pool->BlkAllocTbl, (blk_nbr + (DEF_OCTET_NBR_BITS - 1u)) / DEF_OCTET_NBR_BITS);
+#endif
+
                                                                 /* ------------------ INIT BLK LIST ------------------- */
     p_blk = (CPU_INT08U *)p_pool_mem;
     for (blk_ix = 0; blk_ix < blk_nbr; blk_ix++) {
@@ -1568,6 +2010,9 @@ void  Mem_PoolClr (MEM_POOL  *p_pool,
     p_pool->BlkNbr        = 0u;
     p_pool->BlkFreeTbl    = DEF_NULL;
     p_pool->BlkFreeTblIx  = 0u;
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    p_pool->BlkAllocTbl   = DEF_NULL;
+#endif
 
    *p_err = LIB_MEM_ERR_NONE;
 }
@@ -1608,6 +2053,9 @@ void  *Mem_PoolBlkGet (MEM_POOL    *p_pool,
                        LIB_ERR     *p_err)
 {
     CPU_INT08U  *p_blk;
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    CPU_SIZE_T   blk_ix;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -1642,6 +2090,10 @@ void  *Mem_PoolBlkGet (MEM_POOL    *p_pool,
         p_pool->BlkFreeTblIx                     -=  1u;
         p_blk                                     = (CPU_INT08U *)p_pool->BlkFreeTbl[p_pool->BlkFreeTblIx];
         p_pool->BlkFreeTbl[p_pool->BlkFreeTblIx]  =  DEF_NULL;
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* Mark blk as alloc'd.                                 */
+        blk_ix = ((CPU_ADDR)p_blk - (CPU_ADDR)p_pool->PoolAddrStart) / p_pool->BlkSize;
+        DEF_BIT_SET(p_pool->BlkAllocTbl[blk_ix / DEF_OCTET_NBR_BITS], (CPU_INT08U)DEF_BIT(blk_ix % DEF_OCTET_NBR_BITS));
+#endif
     }
     CPU_CRITICAL_EXIT();
 
@@ -1682,6 +2134,10 @@ void  *Mem_PoolBlkGet (MEM_POOL    *p_pool,
 *
 * Note(s)     : (1) This function is DEPRECATED and will be removed in a future version of this product.
 *                   Mem_DynPoolBlkFree() should be used instead.
+*
+*               (2) The double-free check tests the block's bit in the pool's allocation bitmap, so its cost
+*                   does NOT depend on the number of blocks in the pool (see 'lib_mem.h  MEMORY POOL DATA
+*                   TYPES  Note #2').
 *********************************************************************************************************
 */
 
@@ -1691,7 +2147,8 @@ void  Mem_PoolBlkFree (MEM_POOL  *p_pool,
                        LIB_ERR   *p_err)
 {
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
-    CPU_SIZE_T   tbl_ix;
+    CPU_SIZE_T   blk_ix;
+    CPU_INT08U   blk_mask;
     CPU_BOOLEAN  addr_valid;
 #endif
     CPU_SR_ALLOC();
@@ -1718,13 +2175,14 @@ void  Mem_PoolBlkFree (MEM_POOL  *p_pool,
         return;
     }
 
+    blk_ix   = ((CPU_ADDR)p_blk - (CPU_ADDR)p_pool->PoolAddrStart) / p_pool->BlkSize;
+    blk_mask = (CPU_INT08U)DEF_BIT(blk_ix % DEF_OCTET_NBR_BITS);
+
     CPU_CRITICAL_ENTER();                                       /* Make sure blk isn't already in free list.            */
-    for (tbl_ix = 0u; tbl_ix < p_pool->BlkNbr; tbl_ix++) {
-        if (p_pool->BlkFreeTbl[tbl_ix] == p_blk) {
-            CPU_CRITICAL_EXIT();
-           *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL;
-            return;
-        }
+    if (DEF_BIT_IS_CLR(p_pool->BlkAllocTbl[blk_ix / DEF_OCTET_NBR_BITS], blk_mask) == DEF_YES) {
+        CPU_CRITICAL_EXIT();
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL;
+        return;
     }
 #else                                                           /* Double-free possibility if not in critical section.  */
     CPU_CRITICAL_ENTER();
@@ -1738,6 +2196,9 @@ void  Mem_PoolBlkFree (MEM_POOL  *p_pool,
 
     p_pool->BlkFreeTbl[p_pool->BlkFreeTblIx]  = p_blk;
     p_pool->BlkFreeTblIx                     += 1u;
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    DEF_BIT_CLR(p_pool->BlkAllocTbl[blk_ix / DEF_OCTET_NBR_BITS], blk_mask);
+#endif
     CPU_CRITICAL_EXIT();
 
    *p_err = LIB_MEM_ERR_NONE;
@@ -1973,16 +2434,15 @@ void  Mem_DynPoolCreateHW (const  CPU_CHAR      *p_name,
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) With LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN, a block is taken from the free list without a
+*                   critical section (see 'lib_mem.h  DYNAMIC MEMORY POOL DATA TYPE  Note #3').
 *********************************************************************************************************
 */
 
 void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
                           LIB_ERR       *p_err)
 {
-           void      *p_blk;
-    const  CPU_CHAR  *p_pool_name;
-    CPU_SR_ALLOC();
+    void  *p_blk;
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -1996,46 +2456,7 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
     }
 #endif
 
-                                                                /* Ensure pool is not empty if qty is limited.          */
-    if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {
-        CPU_CRITICAL_ENTER();
-        if (p_pool->BlkAllocCnt >= p_pool->BlkQtyMax) {
-            CPU_CRITICAL_EXIT();
-
-           *p_err = LIB_MEM_ERR_POOL_EMPTY;
-            return (DEF_NULL);
-        }
-
-        p_pool->BlkAllocCnt++;
-        CPU_CRITICAL_EXIT();
-    }
-
-                                                                /* --------------- ALLOC FROM FREE LIST --------------- */
-    CPU_CRITICAL_ENTER();
-    if (p_pool->BlkFreePtr != DEF_NULL) {
-        p_blk              = p_pool->BlkFreePtr;
-        p_pool->BlkFreePtr = *((void **)p_blk);
-        CPU_CRITICAL_EXIT();
-
-       *p_err = LIB_MEM_ERR_NONE;
-
-        return (p_blk);
-    }
-    CPU_CRITICAL_EXIT();
-
-                                                                /* ------------------ ALLOC NEW BLK ------------------- */
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-    p_pool_name = p_pool->NamePtr;
-#else
-    p_pool_name = DEF_NULL;
-#endif
-    p_blk = Mem_SegAllocInternal(p_pool_name,
-                                 p_pool->PoolSegPtr,
-                                 p_pool->BlkSize,
-                                 p_pool->BlkAlign,
-                                 p_pool->BlkPaddingAlign,
-                                 DEF_NULL,
-                                 p_err);
+    (void)Mem_DynPoolBlkGetInternal(p_pool, &p_blk, 1u, p_err);
     if (*p_err != LIB_MEM_ERR_NONE) {
         return (DEF_NULL);
     }
@@ -2064,7 +2485,8 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) With LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN, the block is returned to the free list without a
+*                   critical section (see 'lib_mem.h  DYNAMIC MEMORY POOL DATA TYPE  Note #3').
 *********************************************************************************************************
 */
 
@@ -2072,9 +2494,6 @@ void  Mem_DynPoolBlkFree (MEM_DYN_POOL  *p_pool,
                           void          *p_blk,
                           LIB_ERR       *p_err)
 {
-    CPU_SR_ALLOC();
-
-
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
     if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
         CPU_SW_EXCEPTION(;);
@@ -2091,121 +2510,110 @@ void  Mem_DynPoolBlkFree (MEM_DYN_POOL  *p_pool,
     }
 #endif
 
-    if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {       /* Ensure pool is not full.                             */
-        CPU_CRITICAL_ENTER();
-        if (p_pool->BlkAllocCnt == 0u) {
-            CPU_CRITICAL_EXIT();
-
-           *p_err = LIB_MEM_ERR_POOL_FULL;
-            return;
-        }
-
-        p_pool->BlkAllocCnt--;
-        CPU_CRITICAL_EXIT();
-    }
-
-    CPU_CRITICAL_ENTER();
-   *((void **)p_blk)   = p_pool->BlkFreePtr;
-    p_pool->BlkFreePtr = p_blk;
-    CPU_CRITICAL_EXIT();
-
-   *p_err = LIB_MEM_ERR_NONE;
+    Mem_DynPoolBlkFreeInternal(p_pool, p_blk, p_blk, 1u, p_err);
 }
 
 
 /*
 *********************************************************************************************************
-*                                     Mem_DynPoolBlkNbrAvailGet()
+*                                       Mem_DynPoolBlkGetBulk()
 *
-* Description : Gets number of available blocks in dynamic memory pool. This call will fail with a
-*               dynamic memory pool for which no limit was set at creation.
+* Description : Gets several memory blocks from specified pool, growing it if needed.
 *
-* Argument(s) : p_pool  Pointer to pool data.
+* Argument(s) : p_pool      Pointer to pool data.
 *
-*               p_err   Pointer to variable that will receive the return error code from this function :
+*               p_blk_tbl   Pointer to table that will receive the pointers to the memory blocks.
 *
-*                           LIB_MEM_ERR_NONE                Operation was successful.
-*                           LIB_MEM_ERR_NULL_PTR            'p_pool' pointer passed is NULL.
-*                           LIB_MEM_ERR_POOL_UNLIMITED      Pool has no specified limit.
+*               blk_nbr     Number of blocks requested.
 *
-* Return(s)   : Number of blocks available in dynamic memory pool, if successful.
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*               0, if pool is empty or if an error occurred.
+*                               LIB_MEM_ERR_NONE                All blocks obtained.
+*                               LIB_MEM_ERR_NULL_PTR            Pool data or block table pointer NULL.
+*                               LIB_MEM_ERR_POOL_EMPTY          Pool is empty.
+*
+*                               ----------------------RETURNED BY Mem_SegAllocInternal()-----------------------
+*                               LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*
+* Return(s)   : Number of blocks stored in 'p_blk_tbl', even if an error is returned.
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : None.
+* Note(s)     : (1) The blocks found in the free list are detached with a single critical section or
+*                   compare-and-swap, instead of one per block.
 *********************************************************************************************************
 */
 
-CPU_SIZE_T  Mem_DynPoolBlkNbrAvailGet (MEM_DYN_POOL  *p_pool,
-                                       LIB_ERR       *p_err)
+CPU_SIZE_T  Mem_DynPoolBlkGetBulk (MEM_DYN_POOL   *p_pool,
+                                   void          **p_blk_tbl,
+                                   CPU_SIZE_T      blk_nbr,
+                                   LIB_ERR        *p_err)
 {
-    CPU_SIZE_T  blk_nbr_avail;
-    CPU_SR_ALLOC();
+    void        *p_blk;
+    CPU_SIZE_T   nbr;
+    CPU_SIZE_T   i;
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
     if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
-        CPU_SW_EXCEPTION(0);
+        CPU_SW_EXCEPTION(0u);
     }
 
-    if (p_pool == DEF_NULL) {                                   /* Chk for NULL pool data ptr.                          */
+    if ((p_pool    == DEF_NULL) ||                              /* Chk for NULL pool data or blk tbl ptr.               */
+        (p_blk_tbl == DEF_NULL)) {
        *p_err = LIB_MEM_ERR_NULL_PTR;
         return (0u);
     }
 #endif
 
-    if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {
-        CPU_CRITICAL_ENTER();
-        blk_nbr_avail = p_pool->BlkQtyMax - p_pool->BlkAllocCnt;
-        CPU_CRITICAL_EXIT();
-
+    if (blk_nbr == 0u) {
        *p_err = LIB_MEM_ERR_NONE;
-    } else {
-        blk_nbr_avail = 0u;
-       *p_err         = LIB_MEM_ERR_POOL_UNLIMITED;
+        return (0u);
     }
 
-    return (blk_nbr_avail);
+    nbr = Mem_DynPoolBlkGetInternal(p_pool, &p_blk, blk_nbr, p_err);
+    for (i = 0u; i < nbr; i++) {
+        p_blk_tbl[i] =  p_blk;
+        p_blk        = *((void **)p_blk);
+    }
+
+    return (nbr);
 }
 
 
 /*
 *********************************************************************************************************
-*                                           Mem_OutputUsage()
+*                                      Mem_DynPoolBlkFreeBulk()
 *
-* Description : Outputs memory usage report through 'out_fnct'.
+* Description : Frees several memory blocks, making them available for future use.
 *
-* Argument(s) : out_fnct        Pointer to output function.
+* Argument(s) : p_pool      Pointer to pool data.
 *
-*               print_details   DEF_YES, if the size of each allocation should be printed.
-*                               DEF_NO,  otherwise.
+*               p_blk_tbl   Pointer to table of pointers to the memory blocks.
 *
-*               p_err           Pointer to variable that will receive the return error code from this function :
+*               blk_nbr     Number of blocks in 'p_blk_tbl'.
 *
-*                                   LIB_MEM_ERR_NONE                Operation was successful.
-*                                   LIB_MEM_ERR_NULL_PTR            'out_fnct' pointer passed is NULL.
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                                   ---------------------RETURNED BY Mem_SegRemSizeGet()--------------------
-*                                   LIB_MEM_ERR_NULL_PTR            Segment data pointer NULL.
-*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory alignment.
+*                               LIB_MEM_ERR_NONE        Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR    'p_pool', 'p_blk_tbl' or a block pointer passed is NULL.
+*                               LIB_MEM_ERR_POOL_FULL   Pool would hold more blocks than obtained from it.
 *
-* Return(s)   : None.
+* Return(s)   : none.
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) The blocks are linked together first, then inserted in the free list with a single
+*                   critical section or compare-and-swap.
 *********************************************************************************************************
 */
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
-                      LIB_ERR   *p_err)
+void  Mem_DynPoolBlkFreeBulk (MEM_DYN_POOL   *p_pool,
+                              void          **p_blk_tbl,
+                              CPU_SIZE_T      blk_nbr,
+                              LIB_ERR        *p_err)
 {
-    CPU_CHAR   str[DEF_INT_32U_NBR_DIG_MAX];
-    MEM_SEG   *p_seg;
-    CPU_SR_ALLOC();
+    CPU_SIZE_T  i;
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -2213,519 +2621,525 @@ void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
         CPU_SW_EXCEPTION(;);
     }
 
-    if (out_fnct == DEF_NULL) {                                 /* Chk for NULL out fnct ptr.                           */
+    if ((p_pool    == DEF_NULL) ||                              /* Chk for NULL pool data or blk tbl ptr.               */
+        (p_blk_tbl == DEF_NULL)) {
        *p_err = LIB_MEM_ERR_NULL_PTR;
         return;
     }
-#endif
-
-    out_fnct((CPU_CHAR *)"---------------- Memory allocation info ----------------\r\n");
-    out_fnct((CPU_CHAR *)"| Type    | Size       | Free size  | Name\r\n");
-    out_fnct((CPU_CHAR *)"|---------|------------|------------|-------------------\r\n");
-
-    CPU_CRITICAL_ENTER();
-    p_seg = Mem_SegHeadPtr;
-    while (p_seg != DEF_NULL) {
-        CPU_SIZE_T       rem_size;
-        MEM_SEG_INFO     seg_info;
-        MEM_ALLOC_INFO  *p_alloc;
 
-
-        rem_size = Mem_SegRemSizeGet(p_seg, 1u, &seg_info, p_err);
-        if (*p_err != LIB_MEM_ERR_NONE) {
+    for (i = 0u; i < blk_nbr; i++) {                            /* Chk for NULL blk ptr.                                */
+        if (p_blk_tbl[i] == DEF_NULL) {
+           *p_err = LIB_MEM_ERR_NULL_PTR;
             return;
         }
+    }
+#endif
 
-        out_fnct((CPU_CHAR *)"| Section | ");
+    if (blk_nbr == 0u) {
+       *p_err = LIB_MEM_ERR_NONE;
+        return;
+    }
 
-        (void)Str_FmtNbr_Int32U(seg_info.TotalSize,
-                                10u,
-                                DEF_NBR_BASE_DEC,
-                                ' ',
-                                DEF_NO,
-                                DEF_YES,
-                               &str[0u]);
+    for (i = 1u; i < blk_nbr; i++) {                            /* See Note #1.                                         */
+       *((void **)p_blk_tbl[i - 1u]) = p_blk_tbl[i];
+    }
 
-        out_fnct(str);
-        out_fnct((CPU_CHAR *)" | ");
+    Mem_DynPoolBlkFreeInternal(p_pool, p_blk_tbl[0u], p_blk_tbl[blk_nbr - 1u], blk_nbr, p_err);
+}
 
-        (void)Str_FmtNbr_Int32U(rem_size,
-                                10u,
-                                DEF_NBR_BASE_DEC,
-                                ' ',
-                                DEF_NO,
-                                DEF_YES,
-                               &str[0u]);
 
-        out_fnct(str);
-        out_fnct((CPU_CHAR *)" | ");
-        out_fnct((p_seg->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_seg->NamePtr : (CPU_CHAR *)"Unknown");
-        out_fnct((CPU_CHAR *)"\r\n");
+/*
+*********************************************************************************************************
+*                                     Mem_DynPoolBlkNbrAvailGet()
+*
+* Description : Gets number of available blocks in dynamic memory pool. This call will fail with a
+*               dynamic memory pool for which no limit was set at creation.
+*
+* Argument(s) : p_pool  Pointer to pool data.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE                Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR            'p_pool' pointer passed is NULL.
+*                           LIB_MEM_ERR_POOL_UNLIMITED      Pool has no specified limit.
+*
+* Return(s)   : Number of blocks available in dynamic memory pool, if successful.
+*
+*               0, if pool is empty or if an error occurred.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
 
-        p_alloc = p_seg->AllocInfoHeadPtr;
-        while (p_alloc != DEF_NULL) {
-            out_fnct((CPU_CHAR *)"| -> Obj  | ");
+CPU_SIZE_T  Mem_DynPoolBlkNbrAvailGet (MEM_DYN_POOL  *p_pool,
+                                       LIB_ERR       *p_err)
+{
+    CPU_SIZE_T  blk_nbr_avail;
+    CPU_SR_ALLOC();
 
-            (void)Str_FmtNbr_Int32U(p_alloc->Size,
-                                    10u,
-                                    DEF_NBR_BASE_DEC,
-                                    ' ',
-                                    DEF_NO,
-                                    DEF_YES,
-                                   &str[0u]);
 
-            out_fnct(str);
-            out_fnct((CPU_CHAR *)" |            | ");
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(0);
+    }
 
-            out_fnct((p_alloc->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_alloc->NamePtr : (CPU_CHAR *)"Unknown");
-            out_fnct((CPU_CHAR *)"\r\n");
+    if (p_pool == DEF_NULL) {                                   /* Chk for NULL pool data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (0u);
+    }
+#endif
 
-            p_alloc = p_alloc->NextPtr;
-        }
+    if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {
+        CPU_CRITICAL_ENTER();
+        blk_nbr_avail = p_pool->BlkQtyMax - p_pool->BlkAllocCnt;
+        CPU_CRITICAL_EXIT();
 
-        p_seg = p_seg->NextPtr;
+       *p_err = LIB_MEM_ERR_NONE;
+    } else {
+        blk_nbr_avail = 0u;
+       *p_err         = LIB_MEM_ERR_POOL_UNLIMITED;
     }
-    CPU_CRITICAL_EXIT();
 
-   *p_err = LIB_MEM_ERR_NONE;
+    return (blk_nbr_avail);
 }
-#endif
-
-
-/*
-*********************************************************************************************************
-*********************************************************************************************************
-*                                           LOCAL FUNCTIONS
-*********************************************************************************************************
-*********************************************************************************************************
-*/
 
 /*
 *********************************************************************************************************
-*                                       Mem_SegCreateCritical()
-*
-* Description : Creates a new memory segment to be used for runtime memory allocation or dynamic pools.
+*                                       Mem_DynPoolCacheInit()
 *
-* Argument(s) : p_name          Pointer to segment name.
+* Description : Initializes a dynamic memory pool cache, front end of a pool for a single task.
 *
-*               p_seg           Pointer to segment data. Must be allocated by caller.
-*               -----           Argument validated by caller.
+* Argument(s) : p_cache     Pointer to pool cache data.
 *
-*               seg_base_addr   Segment's first byte address.
+*               p_pool      Pointer to pool data.
 *
-*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer
-*                               from this memory segment. MUST be a power of 2.
-*                               LIB_MEM_PADDING_ALIGN_NONE means no padding.
-*               -------------   Argument validated by caller.
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*               size            Total size of segment, in bytes.
-*               ----            Argument validated by caller.
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Pool cache or pool data pointer NULL.
 *
-* Return(s)   : Pointer to segment data, if successful.
+* Return(s)   : none.
 *
-*               DEF_NULL, otherwise.
+* Caller(s)   : Application.
 *
-* Caller(s)   : Mem_PoolCreate(),
-*               Mem_SegCreate().
+* Note(s)     : (1) A pool cache MUST be used by a single task at a time : its free list is NOT protected
+*                   (see 'lib_mem.h  DYNAMIC MEMORY POOL DATA TYPE  Note #4').
 *
-* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*               (2) Blocks held by a cache count as allocated from the pool, up to 2 *
+*                   LIB_MEM_CFG_DYN_POOL_CACHE_BATCH - 1 blocks per cache. Pools with a maximum quantity
+*                   should be sized accordingly.
 *********************************************************************************************************
 */
 
-static  void  Mem_SegCreateCritical(const  CPU_CHAR    *p_name,
-                                           MEM_SEG     *p_seg,
-                                           CPU_ADDR     seg_base_addr,
-                                           CPU_SIZE_T   padding_align,
-                                           CPU_SIZE_T   size)
+void  Mem_DynPoolCacheInit (MEM_DYN_POOL_CACHE  *p_cache,
+                            MEM_DYN_POOL        *p_pool,
+                            LIB_ERR             *p_err)
 {
-    p_seg->AddrBase         =  seg_base_addr;
-    p_seg->AddrEnd          = (seg_base_addr + (size - 1u));
-    p_seg->AddrNext         =  seg_base_addr;
-    p_seg->NextPtr          =  Mem_SegHeadPtr;
-    p_seg->PaddingAlign     =  padding_align;
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-    p_seg->NamePtr          = p_name;
-    p_seg->AllocInfoHeadPtr = DEF_NULL;
-#else
-    (void)p_name;
+    if ((p_cache == DEF_NULL) ||                                /* Chk for NULL cache or pool data ptr.                 */
+        (p_pool  == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
 #endif
 
-    Mem_SegHeadPtr = p_seg;
+    p_cache->PoolPtr    = p_pool;
+    p_cache->BlkFreePtr = DEF_NULL;
+    p_cache->BlkFreeCnt = 0u;
+
+   *p_err = LIB_MEM_ERR_NONE;
 }
 
 
 /*
 *********************************************************************************************************
-*                                      Mem_SegOverlapChkCritical()
-*
-* Description : Checks if existing memory segment exists or overlaps with specified memory area.
+*                                      Mem_DynPoolCacheBlkGet()
 *
-* Argument(s) : seg_base_addr   Address of first byte of memory area.
+* Description : Gets a memory block through a dynamic memory pool cache.
 *
-*               size            Size of memory area, in bytes.
+* Argument(s) : p_cache     Pointer to pool cache data.
 *
 *               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                               LIB_MEM_ERR_INVALID_SEG_OVERLAP     Segment overlaps another existing segment.
-*                               LIB_MEM_ERR_INVALID_SEG_EXISTS      Segment already exists.
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Pool cache data pointer NULL.
 *
-* Return(s)   : Pointer to memory segment that overlaps.
+*                               -----------------RETURNED BY Mem_DynPoolBlkGetInternal()------------------
+*                               LIB_MEM_ERR_POOL_EMPTY          Pool is empty.
+*                               LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*
+* Return(s)   : Pointer to memory block, if successful.
 *
 *               DEF_NULL, otherwise.
 *
-* Caller(s)   : Mem_PoolCreate(),
-*               Mem_SegCreate().
+* Caller(s)   : Application.
 *
-* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+* Note(s)     : (1) When the cache is empty, up to LIB_MEM_CFG_DYN_POOL_CACHE_BATCH blocks are taken from the
+*                   pool at once. A partial batch is kept without error.
 *********************************************************************************************************
 */
 
-#if  (LIB_MEM_CFG_HEAP_SIZE      >  0u)
-static  MEM_SEG  *Mem_SegOverlapChkCritical (CPU_ADDR     seg_base_addr,
-                                             CPU_SIZE_T   size,
-                                             LIB_ERR     *p_err)
+void  *Mem_DynPoolCacheBlkGet (MEM_DYN_POOL_CACHE  *p_cache,
+                               LIB_ERR             *p_err)
 {
-    MEM_SEG   *p_seg_chk;
-    CPU_ADDR   seg_new_end;
-    CPU_ADDR   seg_chk_start;
-    CPU_ADDR   seg_chk_end;
+    void  *p_blk;
 
 
-    seg_new_end = seg_base_addr + (size - 1u);
-    p_seg_chk   = Mem_SegHeadPtr;
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
 
-    while (p_seg_chk != DEF_NULL) {
-        seg_chk_start = (CPU_ADDR)p_seg_chk->AddrBase;
-        seg_chk_end   = (CPU_ADDR)p_seg_chk->AddrEnd;
+    if (p_cache == DEF_NULL) {                                  /* Chk for NULL cache data ptr.                         */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
+#endif
 
-        if ((seg_base_addr == seg_chk_start) && (seg_new_end == seg_chk_end)) {
-           *p_err = LIB_MEM_ERR_INVALID_SEG_EXISTS;
-            return (p_seg_chk);
-        } else if (((seg_base_addr >= seg_chk_start) && (seg_base_addr <= seg_chk_end)) ||
-                   ((seg_base_addr <= seg_chk_start) && (seg_new_end   >= seg_chk_start))) {
-           *p_err = LIB_MEM_ERR_INVALID_SEG_OVERLAP;
-            return (p_seg_chk);
+    if (p_cache->BlkFreeCnt == 0u) {                            /* Refill cache (see Note #1).                          */
+        p_cache->BlkFreeCnt = Mem_DynPoolBlkGetInternal(p_cache->PoolPtr,
+                                                       &p_cache->BlkFreePtr,
+                                                        LIB_MEM_CFG_DYN_POOL_CACHE_BATCH,
+                                                        p_err);
+        if (p_cache->BlkFreeCnt == 0u) {
+            return (DEF_NULL);
         }
-
-        p_seg_chk = p_seg_chk->NextPtr;
     }
 
+    p_blk               =  p_cache->BlkFreePtr;
+    p_cache->BlkFreePtr = *((void **)p_blk);
+    p_cache->BlkFreeCnt--;
+
    *p_err = LIB_MEM_ERR_NONE;
 
-    return (DEF_NULL);
+    return (p_blk);
 }
-#endif
 
 
 /*
 *********************************************************************************************************
-*                                       Mem_SegAllocInternal()
+*                                      Mem_DynPoolCacheBlkFree()
 *
-* Description : Allocates memory from specified segment.
+* Description : Frees a memory block through a dynamic memory pool cache.
 *
-* Argument(s) : p_name  Pointer to allocated object name. Used for allocations tracking. May be DEF_NULL.
+* Argument(s) : p_cache     Pointer to pool cache data.
 *
-*               p_seg           Pointer to segment from which to allocate memory.
-*               -----           Argument validated by caller.
+*               p_blk       Pointer to memory block, obtained from the cache's pool.
 *
-*               size            Size of memory block to allocate, in bytes.
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*               align           Required alignment of memory block, in bytes. MUST be a power of 2.
-*
-*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer from
-*                               this memory segment. MUST be a power of 2. LIB_MEM_PADDING_ALIGN_NONE
-*                               means no padding.
-*
-*               p_bytes_reqd    Pointer to variable that will receive the number of free bytes missing for
-*                               the allocation to succeed. Set to DEF_NULL to skip calculation.
-*
-*               p_err           Pointer to variable that will receive the return error code from this function :
-*
-*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory block alignment requested.
-*                                   LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
-*                                   LIB_MEM_ERR_NULL_PTR            Error or segment data pointer NULL.
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Pool cache data or block pointer NULL.
 *
-*                                   ------------------RETURNED BY Mem_SegAllocExtCritical()------------------
-*                                   LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*                               ----------------RETURNED BY Mem_DynPoolBlkFreeInternal()-----------------
+*                               LIB_MEM_ERR_POOL_FULL           Pool would hold more blocks than obtained from it.
 *
-* Return(s)   : Pointer to allocated memory block, if successful.
+* Return(s)   : none.
 *
-*               DEF_NULL, otherwise.
+* Caller(s)   : Application.
 *
-* Caller(s)   : Mem_DynPoolBlkGet(),
-*               Mem_DynPoolCreateInternal(),
-*               Mem_HeapAlloc(),
-*               Mem_PoolCreate(),
-*               Mem_SegAlloc(),
-*               Mem_SegAllocExt(),
-*               Mem_SegAllocHW().
+* Note(s)     : (1) The block may come from another task's cache of the same pool.
 *
-* Note(s)     : none.
+*               (2) Once the cache holds 2 * LIB_MEM_CFG_DYN_POOL_CACHE_BATCH blocks, the most recently freed
+*                   LIB_MEM_CFG_DYN_POOL_CACHE_BATCH blocks return to the pool at once; the cache keeps the
+*                   others, so that alternating gets & frees do NOT bounce batches.
 *********************************************************************************************************
 */
 
-static  void  *Mem_SegAllocInternal (const  CPU_CHAR    *p_name,
-                                            MEM_SEG     *p_seg,
-                                            CPU_SIZE_T   size,
-                                            CPU_SIZE_T   align,
-                                            CPU_SIZE_T   padding_align,
-                                            CPU_SIZE_T  *p_bytes_reqd,
-                                            LIB_ERR     *p_err)
+void  Mem_DynPoolCacheBlkFree (MEM_DYN_POOL_CACHE  *p_cache,
+                               void                *p_blk,
+                               LIB_ERR             *p_err)
 {
-    void  *p_blk;
-    CPU_SR_ALLOC();
+    void        *p_head;
+    void        *p_tail;
+    CPU_SIZE_T   i;
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
-    if (p_err == DEF_NULL) {                                    /* Chk for null err ptr.                                */
-        CPU_SW_EXCEPTION(DEF_NULL);
-    }
-
-    if (size < 1u) {                                            /* Chk for invalid sized mem req.                       */
-       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
-        return (DEF_NULL);
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
     }
 
-    if (MATH_IS_PWR2(align) != DEF_YES) {                       /* Chk that align is a pwr of 2.                        */
-       *p_err = LIB_MEM_ERR_INVALID_MEM_ALIGN;
-        return (DEF_NULL);
+    if ((p_cache == DEF_NULL) ||                                /* Chk for NULL cache data or blk ptr.                  */
+        (p_blk   == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
     }
 #endif
 
-    CPU_CRITICAL_ENTER();
-    p_blk = Mem_SegAllocExtCritical(p_seg,
-                                    size,
-                                    align,
-                                    padding_align,
-                                    p_bytes_reqd,
-                                    p_err);
-    if (*p_err != LIB_MEM_ERR_NONE) {
-        CPU_CRITICAL_EXIT();
-        return (DEF_NULL);
-    }
+   *((void **)p_blk)    = p_cache->BlkFreePtr;                  /* See Note #1.                                         */
+    p_cache->BlkFreePtr = p_blk;
+    p_cache->BlkFreeCnt++;
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)                    /* Track alloc if req'd.                                */
-    Mem_SegAllocTrackCritical(p_name,
-                              p_seg,
-                              size,
-                              p_err);
-    if (*p_err != LIB_MEM_ERR_NONE) {
-        CPU_CRITICAL_EXIT();
-        return (DEF_NULL);
+    if (p_cache->BlkFreeCnt >= (2u * LIB_MEM_CFG_DYN_POOL_CACHE_BATCH)) {
+        p_head = p_cache->BlkFreePtr;                           /* See Note #2.                                         */
+        p_tail = p_head;
+        for (i = 1u; i < LIB_MEM_CFG_DYN_POOL_CACHE_BATCH; i++) {
+            p_tail = *((void **)p_tail);
+        }
+        p_cache->BlkFreePtr  = *((void **)p_tail);
+        p_cache->BlkFreeCnt -=  LIB_MEM_CFG_DYN_POOL_CACHE_BATCH;
+
+        Mem_DynPoolBlkFreeInternal(p_cache->PoolPtr, p_head, p_tail, LIB_MEM_CFG_DYN_POOL_CACHE_BATCH, p_err);
+        return;
     }
-#else
-    (void)p_name;
-#endif
-    CPU_CRITICAL_EXIT();
 
-    return (p_blk);
+   *p_err = LIB_MEM_ERR_NONE;
 }
 
 
 /*
 *********************************************************************************************************
-*                                      Mem_SegAllocExtCritical()
+*                                       Mem_DynPoolCacheFlush()
 *
-* Description : Allocates memory from specified segment.
-*
-* Argument(s) : p_seg           Pointer to segment from which to allocate memory.
-*
-*               size            Size of memory block to allocate, in bytes.
-*
-*               align           Required alignment of memory block, in bytes. MUST be a power of 2.
-*
-*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer from
-*                               this memory segment. MUST be a power of 2. LIB_MEM_PADDING_ALIGN_NONE
-*                               means no padding.
+* Description : Returns all blocks held by a dynamic memory pool cache to its pool.
 *
-*               p_bytes_reqd    Pointer to variable that will receive the number of free bytes missing for
-*                               the allocation to succeed. Set to DEF_NULL to skip calculation.
+* Argument(s) : p_cache     Pointer to pool cache data.
 *
-*               p_err           Pointer to variable that will receive the return error code from this function :
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                                   LIB_MEM_ERR_SEG_OVF     Allocation would overflow memory segment.
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Pool cache data pointer NULL.
 *
-* Return(s)   : Pointer to allocated memory block, if successful.
+*                               ----------------RETURNED BY Mem_DynPoolBlkFreeInternal()-----------------
+*                               LIB_MEM_ERR_POOL_FULL           Pool would hold more blocks than obtained from it.
 *
-*               DEF_NULL, otherwise.
+* Return(s)   : none.
 *
-* Caller(s)   : Mem_PoolCreate(),
-*               Mem_SegAllocInternal(),
-*               Mem_SegAllocTrackCritical().
+* Caller(s)   : Application.
 *
-* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+* Note(s)     : (1) To be called before the owner task of the cache is deleted, so that the pool's count
+*                   of allocated blocks does NOT include the blocks the cache held.
 *********************************************************************************************************
 */
 
-static  void  *Mem_SegAllocExtCritical (MEM_SEG     *p_seg,
-                                        CPU_SIZE_T   size,
-                                        CPU_SIZE_T   align,
-                                        CPU_SIZE_T   padding_align,
-                                        CPU_SIZE_T  *p_bytes_reqd,
-                                        LIB_ERR     *p_err)
+void  Mem_DynPoolCacheFlush (MEM_DYN_POOL_CACHE  *p_cache,
+                             LIB_ERR             *p_err)
 {
-    CPU_ADDR    blk_addr;
-    CPU_ADDR    addr_next;
-    CPU_SIZE_T  size_rem_seg;
-    CPU_SIZE_T  size_tot_blk;
-    CPU_SIZE_T  blk_align = DEF_MAX(align, padding_align);
+    void  *p_tail;
 
 
-    blk_addr     = MATH_ROUND_INC_UP_PWR2(p_seg->AddrNext,      /* Compute align'ed blk addr.                           */
-                                          blk_align);
-    addr_next    = MATH_ROUND_INC_UP_PWR2(blk_addr + size,      /* Compute addr of next alloc.                          */
-                                          padding_align);
-    size_rem_seg = (p_seg->AddrEnd - p_seg->AddrNext) + 1u;
-    size_tot_blk =  addr_next      - p_seg->AddrNext;           /* Compute tot blk size including align and padding.    */
-    if (size_rem_seg < size_tot_blk) {                          /* If seg doesn't have enough space ...                 */
-        if (p_bytes_reqd != DEF_NULL) {                         /* ... calc nbr of req'd bytes.                         */
-           *p_bytes_reqd = size_tot_blk - size_rem_seg;
-        }
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
 
-       *p_err = LIB_MEM_ERR_SEG_OVF;
-        return (DEF_NULL);
+    if (p_cache == DEF_NULL) {                                  /* Chk for NULL cache data ptr.                         */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
     }
+#endif
 
-    p_seg->AddrNext = addr_next;
+    if (p_cache->BlkFreeCnt == 0u) {
+       *p_err = LIB_MEM_ERR_NONE;
+        return;
+    }
 
-   *p_err = LIB_MEM_ERR_NONE;
+    p_tail = p_cache->BlkFreePtr;
+    while (*((void **)p_tail) != DEF_NULL) {
+        p_tail = *((void **)p_tail);
+    }
 
-    return ((void *)blk_addr);
+    Mem_DynPoolBlkFreeInternal(p_cache->PoolPtr, p_cache->BlkFreePtr, p_tail, p_cache->BlkFreeCnt, p_err);
+
+    p_cache->BlkFreePtr = DEF_NULL;
+    p_cache->BlkFreeCnt = 0u;
 }
 
 
+
 /*
 *********************************************************************************************************
-*                                     Mem_SegAllocTrackCritical()
-*
-* Description : Tracks segment allocation, adding the 'size' of the allocation under the 'p_name' entry.
+*                                          Mem_SlabCreate()
 *
-* Argument(s) : p_name  Pointer to the name of the object. This string is not copied and its memory should
-*                       remain accessible at all times.
+* Description : Creates a size-class slab allocator.
 *
-*               p_seg   Pointer to segment data.
+* Argument(s) : p_name      Pointer to slab name.
 *
-*               size    Allocation size, in bytes.
+*               p_slab      Pointer to slab data.
 *
-*               p_err   Pointer to variable that will receive the return error code from this function :
+*               p_seg       Pointer to segment from which to allocate pages. Will allocate from
+*                           general-purpose heap if null.
 *
-*                           LIB_MEM_ERR_HEAP_EMPTY      No more memory available on heap
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                           --------------RETURNED BY Mem_SegAllocExtCritical()---------------
-*                           LIB_MEM_ERR_SEG_OVF         Allocation would overflow memory segment.
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Slab data pointer NULL or no segment available.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : Mem_PoolCreate(),
-*               Mem_SegAllocInternal().
+* Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) Size classes are 1, 2, 3, 4, 6, 8, 12, 16, 24 & 32 times LIB_MEM_CFG_SLAB_ALIGN octets,
+*                   so that every block starts on its own cache line(s) when LIB_MEM_CFG_SLAB_ALIGN is the
+*                   CPU cache line size. A request is rounded up by less than 50%.
+*
+*               (2) No page is allocated until the first allocation in a class.
 *********************************************************************************************************
 */
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-static  void  Mem_SegAllocTrackCritical (const  CPU_CHAR    *p_name,
-                                                MEM_SEG     *p_seg,
-                                                CPU_SIZE_T   size,
-                                                LIB_ERR     *p_err)
+void  Mem_SlabCreate (const  CPU_CHAR   *p_name,
+                             MEM_SLAB   *p_slab,
+                             MEM_SEG    *p_seg,
+                             LIB_ERR    *p_err)
 {
-    MEM_ALLOC_INFO  *p_alloc;
+    CPU_INT08U  class_ix;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    CPU_SR_ALLOC();
+#endif
 
 
-                                                                /* ------- UPDATE ALLOC INFO LIST, IF POSSIBLE -------- */
-    p_alloc = p_seg->AllocInfoHeadPtr;
-    while (p_alloc != DEF_NULL) {
-        if (p_alloc->NamePtr == p_name) {
-            p_alloc->Size += size;
-           *p_err = LIB_MEM_ERR_NONE;
-            return;
-        }
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
 
-        p_alloc = p_alloc->NextPtr;
+    if (p_slab == DEF_NULL) {                                   /* Chk for NULL slab data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
     }
+#endif
 
-                                                                /* --------- ADD NEW ALLOC INFO ENTRY IN LIST --------- */
-    p_alloc = (MEM_ALLOC_INFO *)Mem_SegAllocExtCritical(&Mem_SegHeap,             /* Alloc new alloc info struct on heap.                 */
-                                                         sizeof(MEM_ALLOC_INFO),
-                                                         sizeof(CPU_ALIGN),
-                                                         LIB_MEM_PADDING_ALIGN_NONE,
-                                                         DEF_NULL,
-                                                         p_err);
-    if (*p_err != LIB_MEM_ERR_NONE) {
+    if (p_seg == DEF_NULL) {                                    /* Alloc from heap if p_seg is null.                    */
+#if (LIB_MEM_CFG_HEAP_SIZE > 0u)
+        p_seg = &Mem_SegHeap;
+#else
+       *p_err = LIB_MEM_ERR_NULL_PTR;
         return;
+#endif
     }
 
-    p_alloc->NamePtr = p_name;                                  /* Populate alloc info.                                 */
-    p_alloc->Size    = size;
+    p_slab->SegPtr = p_seg;
+    for (class_ix = 0u; class_ix < LIB_MEM_SLAB_CLASS_NBR; class_ix++) {
+        p_slab->ClassTbl[class_ix].BlkSize    = Mem_SlabClassMultTbl[class_ix] * LIB_MEM_CFG_SLAB_ALIGN;
+        p_slab->ClassTbl[class_ix].BlkFreePtr = DEF_NULL;       /* See Note #2.                                         */
+        p_slab->ClassTbl[class_ix].BlkFreeCnt = 0u;
+        p_slab->ClassTbl[class_ix].BlkUsedCnt = 0u;
+        p_slab->ClassTbl[class_ix].PageCnt    = 0u;
+    }
 
-    p_alloc->NextPtr        = p_seg->AllocInfoHeadPtr;          /* Prepend new item in list.                            */
-    p_seg->AllocInfoHeadPtr = p_alloc;
-}
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_slab->NamePtr = p_name;
+
+    CPU_CRITICAL_ENTER();                                       /* Add slab to list, for Mem_OutputUsage().             */
+    p_slab->NextPtr = Mem_SlabHeadPtr;
+    Mem_SlabHeadPtr = p_slab;
+    CPU_CRITICAL_EXIT();
+#else
+    (void)p_name;
 #endif
 
+   *p_err = LIB_MEM_ERR_NONE;
+}
+
 
 /*
 *********************************************************************************************************
-*                                     Mem_DynPoolCreateInternal()
-*
-* Description : Creates a dynamic memory pool.
-*
-* Argument(s) : p_name              Pointer to pool name.
-*
-*               p_pool              Pointer to pool data.
-*
-*               p_seg               Pointer to segment from which to allocate memory.
+*                                           Mem_SlabAlloc()
 *
-*               blk_size            Size of memory block to allocate from pool, in bytes. See Note #1.
-*
-*               blk_align           Required alignment of memory block, in bytes. MUST be a power of 2.
+* Description : Allocates a memory block from a slab allocator.
 *
-*               blk_padding_align   Block's padding alignment, in bytes, that will be added at the end
-*                                   of block's buffer. MUST be a power of 2. LIB_MEM_PADDING_ALIGN_NONE
-*                                   means no padding.
+* Argument(s) : p_slab      Pointer to slab data.
 *
-*               blk_qty_init        Initial number of elements to be allocated in pool.
+*               size        Size of memory block to allocate, in octets.
 *
-*               blk_qty_max         Maximum number of elements that can be allocated from this pool. Set to
-*                                   LIB_MEM_BLK_QTY_UNLIMITED if no limit.
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*               p_err           Pointer to variable that will receive the return error code from this function :
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Slab data pointer NULL.
+*                               LIB_MEM_ERR_INVALID_MEM_SIZE    Size NULL or greater than LIB_MEM_SLAB_BLK_SIZE_MAX.
 *
-*                                   LIB_MEM_ERR_INVALID_BLK_ALIGN   Invalid requested block alignment.
-*                                   LIB_MEM_ERR_INVALID_BLK_SIZE    Invalid requested block size.
-*                                   LIB_MEM_ERR_INVALID_BLK_NBR     Invalid requested block quantity max.
-*                                   LIB_MEM_ERR_NULL_PTR            Pool data pointer NULL.
+*                               --------------------RETURNED BY Mem_SlabBlkGetBatch()--------------------
+*                               LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
 *
-*                                   ------------------RETURNED BY Mem_SegAllocInternal()-------------------
-*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory block alignment requested.
-*                                   LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
-*                                   LIB_MEM_ERR_NULL_PTR            Error or segment data pointer NULL.
-*                                   LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+* Return(s)   : Pointer to memory block, aligned on LIB_MEM_CFG_SLAB_ALIGN, if successful.
 *
-* Return(s)   : None.
+*               DEF_NULL, otherwise.
 *
-* Caller(s)   : Mem_DynPoolCreate(),
-*               Mem_DynPoolCreateHW().
+* Caller(s)   : Application.
 *
-* Note(s)     : (1) 'blk_size' must be big enough to fit a pointer since the pointer to the next free
-*                   block is stored in the block itself (only when free/unused).
+* Note(s)     : (1) Allocation is O(1) : the block is taken from the head of its class' free list, in a
+*                   critical section. A new page is carved from the segment when the class is empty.
 *********************************************************************************************************
 */
 
-static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
-                                                MEM_DYN_POOL  *p_pool,
-                                                MEM_SEG       *p_seg,
-                                                CPU_SIZE_T     blk_size,
-                                                CPU_SIZE_T     blk_align,
-                                                CPU_SIZE_T     blk_padding_align,
-                                                CPU_SIZE_T     blk_qty_init,
-                                                CPU_SIZE_T     blk_qty_max,
-                                                LIB_ERR       *p_err)
+void  *Mem_SlabAlloc (MEM_SLAB    *p_slab,
+                      CPU_SIZE_T   size,
+                      LIB_ERR     *p_err)
 {
-    CPU_INT08U  *p_blks          = DEF_NULL;
-    CPU_SIZE_T   blk_size_align;
-    CPU_SIZE_T   blk_align_worst = DEF_MAX(blk_align, blk_padding_align);
+    void  *p_blk;
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_slab == DEF_NULL) {                                   /* Chk for NULL slab data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
+#endif
+
+    if ((size < 1u) ||
+        (size > LIB_MEM_SLAB_BLK_SIZE_MAX)) {
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return (DEF_NULL);
+    }
+
+    (void)Mem_SlabBlkGetBatch(p_slab,
+                              Mem_SlabClassIxTbl[(size - 1u) / LIB_MEM_CFG_SLAB_ALIGN],
+                             &p_blk,
+                              1u,
+                              p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return (DEF_NULL);
+    }
+
+    return (p_blk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_SlabFree()
+*
+* Description : Frees a memory block to the slab allocator it was allocated from.
+*
+* Argument(s) : p_slab      Pointer to slab data.
+*
+*               p_blk       Pointer to memory block to free.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Slab data or block pointer NULL.
+*
+*                               -------------------RETURNED BY Mem_SlabBlkClassIxGet()-------------------
+*                               LIB_MEM_ERR_INVALID_BLK_ADDR    Block NOT allocated from this slab.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The block's size class is read from its page header, found by masking the block address
+*                   (see 'lib_mem.h  SLAB ALLOCATOR DATA TYPES  Note #1'); the size is NOT needed.
+*
+*               (2) A block allocated through a slab cache MAY be freed here, & vice versa.
+*********************************************************************************************************
+*/
+
+void  Mem_SlabFree (MEM_SLAB  *p_slab,
+                    void      *p_blk,
+                    LIB_ERR   *p_err)
+{
+    CPU_INT08U  class_ix;
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -2733,75 +3147,227 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
         CPU_SW_EXCEPTION(;);
     }
 
-    if (p_pool == DEF_NULL) {                                   /* Chk for NULL pool data ptr.                          */
+    if ((p_slab == DEF_NULL) ||                                 /* Chk for NULL slab data or blk ptr.                   */
+        (p_blk  == DEF_NULL)) {
        *p_err = LIB_MEM_ERR_NULL_PTR;
         return;
     }
+#endif
 
-    if (blk_size < 1u) {                                        /* Chk for inv blk size.                                */
-       *p_err = LIB_MEM_ERR_INVALID_BLK_SIZE;
+    class_ix = Mem_SlabBlkClassIxGet(p_slab, p_blk, p_err);     /* See Note #1.                                         */
+    if (*p_err != LIB_MEM_ERR_NONE) {
         return;
     }
 
-    if ((blk_qty_max  != LIB_MEM_BLK_QTY_UNLIMITED) &&          /* Chk for invalid blk qty.                             */
-        (blk_qty_init >  blk_qty_max)) {
-       *p_err = LIB_MEM_ERR_INVALID_BLK_NBR;
-        return;
+    Mem_SlabBlkPutBatch(p_slab, class_ix, p_blk, p_blk, 1u);
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_SlabCacheInit()
+*
+* Description : Initializes a slab cache, front end of a slab allocator for a single task.
+*
+* Argument(s) : p_cache     Pointer to slab cache data.
+*
+*               p_slab      Pointer to slab data.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Slab cache or slab data pointer NULL.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) A slab cache MUST be used by a single task at a time : its free lists are NOT protected
+*                   (see 'lib_mem.h  SLAB ALLOCATOR DATA TYPES  Note #2').
+*********************************************************************************************************
+*/
+
+void  Mem_SlabCacheInit (MEM_SLAB_CACHE  *p_cache,
+                         MEM_SLAB        *p_slab,
+                         LIB_ERR         *p_err)
+{
+    CPU_INT08U  class_ix;
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
     }
 
-    if (MATH_IS_PWR2(blk_align) != DEF_YES) {                   /* Chk for illegal align spec.                          */
-       *p_err = LIB_MEM_ERR_INVALID_BLK_ALIGN;
+    if ((p_cache == DEF_NULL) ||                                /* Chk for NULL cache or slab data ptr.                 */
+        (p_slab  == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
         return;
     }
 #endif
 
-                                                                /* Calc blk size with align.                            */
-    if (blk_size < sizeof(void *)) {                            /* If size if smaller than ptr ...                      */
-                                                                /* ... inc size to ptr size.                            */
-        blk_size_align = MATH_ROUND_INC_UP_PWR2(sizeof(void *), blk_align_worst);
-    } else {
-        blk_size_align = MATH_ROUND_INC_UP_PWR2(blk_size, blk_align_worst);
+    p_cache->SlabPtr = p_slab;
+    for (class_ix = 0u; class_ix < LIB_MEM_SLAB_CLASS_NBR; class_ix++) {
+        p_cache->BlkFreePtr[class_ix] = DEF_NULL;
+        p_cache->BlkFreeCnt[class_ix] = 0u;
     }
 
-    if (blk_qty_init != 0u) {                                   /* Alloc init blks.                                     */
-        CPU_SIZE_T  i;
-        p_blks = (CPU_INT08U *)Mem_SegAllocInternal(p_name,
-                                                    p_seg,
-                                                    blk_size_align * blk_qty_init,
-                                                    DEF_MAX(blk_align, sizeof(void *)),
-                                                    LIB_MEM_PADDING_ALIGN_NONE,
-                                                    DEF_NULL,
-                                                    p_err);
+   *p_err = LIB_MEM_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SlabCacheAlloc()
+*
+* Description : Allocates a memory block through a slab cache.
+*
+* Argument(s) : p_cache     Pointer to slab cache data.
+*
+*               size        Size of memory block to allocate, in octets.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Slab cache data pointer NULL.
+*                               LIB_MEM_ERR_INVALID_MEM_SIZE    Size NULL or greater than LIB_MEM_SLAB_BLK_SIZE_MAX.
+*
+*                               --------------------RETURNED BY Mem_SlabBlkGetBatch()--------------------
+*                               LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*
+* Return(s)   : Pointer to memory block, aligned on LIB_MEM_CFG_SLAB_ALIGN, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) When the cache's class is empty, up to LIB_MEM_CFG_SLAB_CACHE_BATCH blocks are taken from
+*                   the slab allocator in a single critical section.
+*********************************************************************************************************
+*/
+
+void  *Mem_SlabCacheAlloc (MEM_SLAB_CACHE  *p_cache,
+                           CPU_SIZE_T       size,
+                           LIB_ERR         *p_err)
+{
+    void        *p_blk;
+    CPU_INT08U   class_ix;
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_cache == DEF_NULL) {                                  /* Chk for NULL cache data ptr.                         */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
+#endif
+
+    if ((size < 1u) ||
+        (size > LIB_MEM_SLAB_BLK_SIZE_MAX)) {
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return (DEF_NULL);
+    }
+
+    class_ix = Mem_SlabClassIxTbl[(size - 1u) / LIB_MEM_CFG_SLAB_ALIGN];
+    if (p_cache->BlkFreeCnt[class_ix] == 0u) {                  /* Refill cache (see Note #1).                          */
+        p_cache->BlkFreeCnt[class_ix] = Mem_SlabBlkGetBatch(p_cache->SlabPtr,
+                                                            class_ix,
+                                                           &p_cache->BlkFreePtr[class_ix],
+                                                            LIB_MEM_CFG_SLAB_CACHE_BATCH,
+                                                            p_err);
         if (*p_err != LIB_MEM_ERR_NONE) {
-            return;
+            return (DEF_NULL);
         }
+    }
 
-                                                                /* ----------------- CREATE POOL DATA ----------------- */
-                                                                /* Init free list.                                      */
-        p_pool->BlkFreePtr = (void *)p_blks;
-        for (i = 0u; i < blk_qty_init - 1u; i++) {
-           *((void **)p_blks)  = p_blks + blk_size_align;
-            p_blks            += blk_size_align;
-        }
-       *((void **)p_blks) = DEF_NULL;
-    } else {
-        p_pool->BlkFreePtr = DEF_NULL;
+    p_blk                         =  p_cache->BlkFreePtr[class_ix];
+    p_cache->BlkFreePtr[class_ix] = *((void **)p_blk);
+    p_cache->BlkFreeCnt[class_ix]--;
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (p_blk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_SlabCacheFree()
+*
+* Description : Frees a memory block through a slab cache.
+*
+* Argument(s) : p_cache     Pointer to slab cache data.
+*
+*               p_blk       Pointer to memory block to free.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Slab cache data or block pointer NULL.
+*
+*                               -------------------RETURNED BY Mem_SlabBlkClassIxGet()-------------------
+*                               LIB_MEM_ERR_INVALID_BLK_ADDR    Block NOT allocated from the cache's slab.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The block MAY have been allocated by another task's cache, e.g. a packet freed by the
+*                   task that consumed it.
+*
+*               (2) When the cache's class holds 2 * LIB_MEM_CFG_SLAB_CACHE_BATCH blocks, the first
+*                   LIB_MEM_CFG_SLAB_CACHE_BATCH are returned to the slab allocator in a single critical
+*                   section.
+*********************************************************************************************************
+*/
+
+void  Mem_SlabCacheFree (MEM_SLAB_CACHE  *p_cache,
+                         void            *p_blk,
+                         LIB_ERR         *p_err)
+{
+    void        *p_head;
+    void        *p_tail;
+    CPU_SIZE_T   i;
+    CPU_INT08U   class_ix;
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
     }
 
-#if (LIB_MEM_CFG_HEAP_SIZE > 0u)
-    p_pool->PoolSegPtr      = ((p_seg != DEF_NULL) ? p_seg : &Mem_SegHeap);
-#else
-    p_pool->PoolSegPtr      =   p_seg;
+    if ((p_cache == DEF_NULL) ||                                /* Chk for NULL cache data or blk ptr.                  */
+        (p_blk   == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
 #endif
-    p_pool->BlkSize         =   blk_size;
-    p_pool->BlkAlign        =   blk_align_worst;
-    p_pool->BlkPaddingAlign =   blk_padding_align;
-    p_pool->BlkQtyMax       =   blk_qty_max;
-    p_pool->BlkAllocCnt     =   0u;
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-    p_pool->NamePtr = p_name;
-#endif
+    class_ix = Mem_SlabBlkClassIxGet(p_cache->SlabPtr, p_blk, p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return;
+    }
+
+   *((void **)p_blk)              = p_cache->BlkFreePtr[class_ix];
+    p_cache->BlkFreePtr[class_ix] = p_blk;
+    p_cache->BlkFreeCnt[class_ix]++;
+
+    if (p_cache->BlkFreeCnt[class_ix] >= (2u * LIB_MEM_CFG_SLAB_CACHE_BATCH)) {
+        p_head = p_cache->BlkFreePtr[class_ix];                 /* See Note #2.                                         */
+        p_tail = p_head;
+        for (i = 1u; i < LIB_MEM_CFG_SLAB_CACHE_BATCH; i++) {
+            p_tail = *((void **)p_tail);
+        }
+        p_cache->BlkFreePtr[class_ix]  = *((void **)p_tail);
+        p_cache->BlkFreeCnt[class_ix] -=  LIB_MEM_CFG_SLAB_CACHE_BATCH;
+
+        Mem_SlabBlkPutBatch(p_cache->SlabPtr, class_ix, p_head, p_tail, LIB_MEM_CFG_SLAB_CACHE_BATCH);
+    }
 
    *p_err = LIB_MEM_ERR_NONE;
 }
@@ -2809,44 +3375,2321 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
 
 /*
 *********************************************************************************************************
-*                                      Mem_PoolBlkIsValidAddr()
+*                                        Mem_SlabCacheFlush()
 *
-* Description : Calculates if a given memory block address is valid for the memory pool.
+* Description : Returns all blocks held by a slab cache to its slab allocator.
 *
-* Argument(s) : p_pool   Pointer to memory pool structure to validate memory block address.
-*               ------   Argument validated by caller.
+* Argument(s) : p_cache     Pointer to slab cache data.
 *
-*               p_mem    Pointer to memory block address to validate.
-*               -----    Argument validated by caller.
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-* Return(s)   : DEF_YES, if valid memory pool block address.
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Slab cache data pointer NULL.
 *
-*               DEF_NO,  otherwise.
+* Return(s)   : none.
 *
-* Caller(s)   : Mem_PoolBlkFree().
+* Caller(s)   : Application.
 *
-* Note(s)     : (1) This function is DEPRECATED and will be removed in a future version of this product.
+* Note(s)     : (1) Should be called before the task that owns the cache is deleted.
 *********************************************************************************************************
 */
 
-#if ((LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) && \
-     (LIB_MEM_CFG_HEAP_SIZE      >  0u))
-static  CPU_BOOLEAN  Mem_PoolBlkIsValidAddr (MEM_POOL  *p_pool,
-                                             void      *p_mem)
+void  Mem_SlabCacheFlush (MEM_SLAB_CACHE  *p_cache,
+                          LIB_ERR         *p_err)
 {
-    CPU_ADDR  pool_offset;
+    void        *p_tail;
+    CPU_INT08U   class_ix;
 
 
-    if ((p_mem < p_pool->PoolAddrStart) ||
-        (p_mem > p_pool->PoolAddrEnd)) {
-        return (DEF_FALSE);
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
     }
 
-    pool_offset = (CPU_ADDR)p_mem - (CPU_ADDR)p_pool->PoolAddrStart;
-    if (pool_offset % p_pool->BlkSize != 0u) {
-        return (DEF_FALSE);
-    } else {
-        return (DEF_TRUE);
+    if (p_cache == DEF_NULL) {                                  /* Chk for NULL cache data ptr.                         */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
     }
+#endif
+
+    for (class_ix = 0u; class_ix < LIB_MEM_SLAB_CLASS_NBR; class_ix++) {
+        if (p_cache->BlkFreeCnt[class_ix] > 0u) {
+            p_tail = p_cache->BlkFreePtr[class_ix];
+            while (*((void **)p_tail) != DEF_NULL) {
+                p_tail = *((void **)p_tail);
+            }
+
+            Mem_SlabBlkPutBatch(p_cache->SlabPtr,
+                                class_ix,
+                                p_cache->BlkFreePtr[class_ix],
+                                p_tail,
+                                p_cache->BlkFreeCnt[class_ix]);
+
+            p_cache->BlkFreePtr[class_ix] = DEF_NULL;
+            p_cache->BlkFreeCnt[class_ix] = 0u;
+        }
+    }
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_OutputUsage()
+*
+* Description : Outputs memory usage report through 'out_fnct'.
+*
+* Argument(s) : out_fnct        Pointer to output function.
+*
+*               print_details   DEF_YES, if the size of each allocation should be printed.
+*                               DEF_NO,  otherwise.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_NONE                Operation was successful.
+*                                   LIB_MEM_ERR_NULL_PTR            'out_fnct' pointer passed is NULL.
+*
+*                                   ---------------------RETURNED BY Mem_SegRemSizeGet()--------------------
+*                                   LIB_MEM_ERR_NULL_PTR            Segment data pointer NULL.
+*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory alignment.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Each slab allocator is reported after the segments : its pages' total size & the size of
+*                   its free blocks, then the same per size class, with the number of blocks in use. Blocks
+*                   held by slab caches are counted as used.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
+                      LIB_ERR   *p_err)
+{
+    CPU_CHAR     str[DEF_INT_32U_NBR_DIG_MAX + 1u];
+    MEM_SEG     *p_seg;
+    MEM_SLAB    *p_slab;
+    CPU_SIZE_T   slab_size;
+    CPU_SIZE_T   slab_free;
+    CPU_INT08U   class_ix;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (out_fnct == DEF_NULL) {                                 /* Chk for NULL out fnct ptr.                           */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    out_fnct((CPU_CHAR *)"---------------- Memory allocation info ----------------\r\n");
+    out_fnct((CPU_CHAR *)"| Type    | Size       | Free size  | Name\r\n");
+    out_fnct((CPU_CHAR *)"|---------|------------|------------|-------------------\r\n");
+
+    CPU_CRITICAL_ENTER();
+    p_seg = Mem_SegHeadPtr;
+    while (p_seg != DEF_NULL) {
+        CPU_SIZE_T       rem_size;
+        MEM_SEG_INFO     seg_info;
+        MEM_ALLOC_INFO  *p_alloc;
+
+
+        rem_size = Mem_SegRemSizeGet(p_seg, 1u, &seg_info, p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            return;
+        }
+
+        out_fnct((CPU_CHAR *)"| Section | ");
+
+        (void)Str_FmtNbr_Int32U(seg_info.TotalSize,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+
+        (void)Str_FmtNbr_Int32U(rem_size,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        out_fnct((p_seg->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_seg->NamePtr : (CPU_CHAR *)"Unknown");
+        out_fnct((CPU_CHAR *)"\r\n");
+
+        p_alloc = p_seg->AllocInfoHeadPtr;
+        while (p_alloc != DEF_NULL) {
+            out_fnct((CPU_CHAR *)"| -> Obj  | ");
+
+            (void)Str_FmtNbr_Int32U(p_alloc->Size,
+                                    10u,
+                                    DEF_NBR_BASE_DEC,
+                                    ' ',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)" |            | ");
+
+            out_fnct((p_alloc->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_alloc->NamePtr : (CPU_CHAR *)"Unknown");
+            out_fnct((CPU_CHAR *)"\r\n");
+
+            p_alloc = p_alloc->NextPtr;
+        }
+
+        p_seg = p_seg->NextPtr;
+    }
+
+    p_slab = Mem_SlabHeadPtr;                                   /* See Note #1.                                         */
+    while (p_slab != DEF_NULL) {
+        slab_size = 0u;
+        slab_free = 0u;
+        for (class_ix = 0u; class_ix < LIB_MEM_SLAB_CLASS_NBR; class_ix++) {
+            slab_size += p_slab->ClassTbl[class_ix].PageCnt    * LIB_MEM_CFG_SLAB_PAGE_SIZE;
+            slab_free += p_slab->ClassTbl[class_ix].BlkFreeCnt * p_slab->ClassTbl[class_ix].BlkSize;
+        }
+
+        out_fnct((CPU_CHAR *)"| Slab    | ");
+        (void)Str_FmtNbr_Int32U(slab_size, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        (void)Str_FmtNbr_Int32U(slab_free, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        out_fnct((p_slab->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_slab->NamePtr : (CPU_CHAR *)"Unknown");
+        out_fnct((CPU_CHAR *)"\r\n");
+
+        for (class_ix = 0u; class_ix < LIB_MEM_SLAB_CLASS_NBR; class_ix++) {
+            MEM_SLAB_CLASS  *p_class;
+
+
+            p_class = &p_slab->ClassTbl[class_ix];
+            if (p_class->PageCnt == 0u) {
+                continue;
+            }
+
+            out_fnct((CPU_CHAR *)"| -> Cls  | ");
+            (void)Str_FmtNbr_Int32U(p_class->PageCnt * LIB_MEM_CFG_SLAB_PAGE_SIZE,
+                                    10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)" | ");
+            (void)Str_FmtNbr_Int32U(p_class->BlkFreeCnt * p_class->BlkSize,
+                                    10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)" | ");
+            (void)Str_FmtNbr_Int32U(p_class->BlkSize,
+                                    DEF_INT_32U_NBR_DIG_MAX, DEF_NBR_BASE_DEC, (CPU_CHAR)'\0', DEF_NO, DEF_YES, &str[0u]);
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)"-octet blks, ");
+            (void)Str_FmtNbr_Int32U(p_class->BlkUsedCnt,
+                                    DEF_INT_32U_NBR_DIG_MAX, DEF_NBR_BASE_DEC, (CPU_CHAR)'\0', DEF_NO, DEF_YES, &str[0u]);
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)" used\r\n");
+        }
+
+        p_slab = p_slab->NextPtr;
+    }
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       Mem_SegCreateCritical()
+*
+* Description : Creates a new memory segment to be used for runtime memory allocation or dynamic pools.
+*
+* Argument(s) : p_name          Pointer to segment name.
+*
+*               p_seg           Pointer to segment data. Must be allocated by caller.
+*               -----           Argument validated by caller.
+*
+*               seg_base_addr   Segment's first byte address.
+*
+*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer
+*                               from this memory segment. MUST be a power of 2.
+*                               LIB_MEM_PADDING_ALIGN_NONE means no padding.
+*               -------------   Argument validated by caller.
+*
+*               size            Total size of segment, in bytes.
+*               ----            Argument validated by caller.
+*
+* Return(s)   : Pointer to segment data, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_PoolCreate(),
+*               Mem_SegCreate().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*********************************************************************************************************
+*/
+
+static  void  Mem_SegCreateCritical(const  CPU_CHAR    *p_name,
+                                           MEM_SEG     *p_seg,
+                                           CPU_ADDR     seg_base_addr,
+                                           CPU_SIZE_T   padding_align,
+                                           CPU_SIZE_T   size)
+{
+    p_seg->AddrBase         =  seg_base_addr;
+    p_seg->AddrEnd          = (seg_base_addr + (size - 1u));
+    p_seg->AddrNext         =  seg_base_addr;
+    p_seg->NextPtr          =  Mem_SegHeadPtr;
+    p_seg->PaddingAlign     =  padding_align;
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_seg->NamePtr          = p_name;
+    p_seg->AllocInfoHeadPtr = DEF_NULL;
+#else
+    (void)p_name;
+#endif
+
+    Mem_SegHeadPtr = p_seg;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      Mem_SegOverlapChkCritical()
+*
+* Description : Checks if existing memory segment exists or overlaps with specified memory area.
+*
+* Argument(s) : seg_base_addr   Address of first byte of memory area.
+*
+*               size            Size of memory area, in bytes.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_INVALID_SEG_OVERLAP     Segment overlaps another existing segment.
+*                               LIB_MEM_ERR_INVALID_SEG_EXISTS      Segment already exists.
+*
+* Return(s)   : Pointer to memory segment that overlaps.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_PoolCreate(),
+*               Mem_SegCreate().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*********************************************************************************************************
+*/
+
+#if  (LIB_MEM_CFG_HEAP_SIZE      >  0u)
+static  MEM_SEG  *Mem_SegOverlapChkCritical (CPU_ADDR     seg_base_addr,
+                                             CPU_SIZE_T   size,
+                                             LIB_ERR     *p_err)
+{
+    MEM_SEG   *p_seg_chk;
+    CPU_ADDR   seg_new_end;
+    CPU_ADDR   seg_chk_start;
+    CPU_ADDR   seg_chk_end;
+
+
+    seg_new_end = seg_base_addr + (size - 1u);
+    p_seg_chk   = Mem_SegHeadPtr;
+
+    while (p_seg_chk != DEF_NULL) {
+        seg_chk_start = (CPU_ADDR)p_seg_chk->AddrBase;
+        seg_chk_end   = (CPU_ADDR)p_seg_chk->AddrEnd;
+
+        if ((seg_base_addr == seg_chk_start) && (seg_new_end == seg_chk_end)) {
+           *p_err = LIB_MEM_ERR_INVALID_SEG_EXISTS;
+            return (p_seg_chk);
+        } else if (((seg_base_addr >= seg_chk_start) && (seg_base_addr <= seg_chk_end)) ||
+                   ((seg_base_addr <= seg_chk_start) && (seg_new_end   >= seg_chk_start))) {
+           *p_err = LIB_MEM_ERR_INVALID_SEG_OVERLAP;
+            return (p_seg_chk);
+        }
+
+        p_seg_chk = p_seg_chk->NextPtr;
+    }
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (DEF_NULL);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_SegAllocInternal()
+*
+* Description : Allocates memory from specified segment.
+*
+* Argument(s) : p_name  Pointer to allocated object name. Used for allocations tracking. May be DEF_NULL.
+*
+*               p_seg           Pointer to segment from which to allocate memory.
+*               -----           Argument validated by caller.
+*
+*               size            Size of memory block to allocate, in bytes.
+*
+*               align           Required alignment of memory block, in bytes. MUST be a power of 2.
+*
+*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer from
+*                               this memory segment. MUST be a power of 2. LIB_MEM_PADDING_ALIGN_NONE
+*                               means no padding.
+*
+*               p_bytes_reqd    Pointer to variable that will receive the number of free bytes missing for
+*                               the allocation to succeed. Set to DEF_NULL to skip calculation.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory block alignment requested.
+*                                   LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
+*                                   LIB_MEM_ERR_NULL_PTR            Error or segment data pointer NULL.
+*
+*                                   ------------------RETURNED BY Mem_SegAllocExtCritical()------------------
+*                                   LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*
+* Return(s)   : Pointer to allocated memory block, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_DynPoolBlkGet(),
+*               Mem_DynPoolCreateInternal(),
+*               Mem_HeapAlloc(),
+*               Mem_PoolCreate(),
+*               Mem_SegAlloc(),
+*               Mem_SegAllocExt(),
+*               Mem_SegAllocHW().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  *Mem_SegAllocInternal (const  CPU_CHAR    *p_name,
+                                            MEM_SEG     *p_seg,
+                                            CPU_SIZE_T   size,
+                                            CPU_SIZE_T   align,
+                                            CPU_SIZE_T   padding_align,
+                                            CPU_SIZE_T  *p_bytes_reqd,
+                                            LIB_ERR     *p_err)
+{
+    void  *p_blk;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for null err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (size < 1u) {                                            /* Chk for invalid sized mem req.                       */
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return (DEF_NULL);
+    }
+
+    if (MATH_IS_PWR2(align) != DEF_YES) {                       /* Chk that align is a pwr of 2.                        */
+       *p_err = LIB_MEM_ERR_INVALID_MEM_ALIGN;
+        return (DEF_NULL);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_blk = Mem_SegAllocExtCritical(p_seg,
+                                    size,
+                                    align,
+                                    padding_align,
+                                    p_bytes_reqd,
+                                    p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        CPU_CRITICAL_EXIT();
+        return (DEF_NULL);
+    }
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)                    /* Track alloc if req'd.                                */
+    Mem_SegAllocTrackCritical(p_name,
+                              p_seg,
+                              size,
+                              p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        CPU_CRITICAL_EXIT();
+        return (DEF_NULL);
+    }
+#else
+    (void)p_name;
+#endif
+    CPU_CRITICAL_EXIT();
+
+    return (p_blk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      Mem_SegAllocExtCritical()
+*
+* Description : Allocates memory from specified segment.
+*
+* Argument(s) : p_seg           Pointer to segment from which to allocate memory.
+*
+*               size            Size of memory block to allocate, in bytes.
+*
+*               align           Required alignment of memory block, in bytes. MUST be a power of 2.
+*
+*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer from
+*                               this memory segment. MUST be a power of 2. LIB_MEM_PADDING_ALIGN_NONE
+*                               means no padding.
+*
+*               p_bytes_reqd    Pointer to variable that will receive the number of free bytes missing for
+*                               the allocation to succeed. Set to DEF_NULL to skip calculation.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_SEG_OVF     Allocation would overflow memory segment.
+*
+* Return(s)   : Pointer to allocated memory block, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_PoolCreate(),
+*               Mem_SegAllocInternal(),
+*               Mem_SegAllocTrackCritical().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*********************************************************************************************************
+*/
+
+static  void  *Mem_SegAllocExtCritical (MEM_SEG     *p_seg,
+                                        CPU_SIZE_T   size,
+                                        CPU_SIZE_T   align,
+                                        CPU_SIZE_T   padding_align,
+                                        CPU_SIZE_T  *p_bytes_reqd,
+                                        LIB_ERR     *p_err)
+{
+    CPU_ADDR    blk_addr;
+    CPU_ADDR    addr_next;
+    CPU_SIZE_T  size_rem_seg;
+    CPU_SIZE_T  size_tot_blk;
+    CPU_SIZE_T  blk_align = DEF_MAX(align, padding_align);
+
+
+    blk_addr     = MATH_ROUND_INC_UP_PWR2(p_seg->AddrNext,      /* Compute align'ed blk addr.                           */
+                                          blk_align);
+    addr_next    = MATH_ROUND_INC_UP_PWR2(blk_addr + size,      /* Compute addr of next alloc.                          */
+                                          padding_align);
+    size_rem_seg = (p_seg->AddrEnd - p_seg->AddrNext) + 1u;
+    size_tot_blk =  addr_next      - p_seg->AddrNext;           /* Compute tot blk size including align and padding.    */
+    if (size_rem_seg < size_tot_blk) {                          /* If seg doesn't have enough space ...                 */
+        if (p_bytes_reqd != DEF_NULL) {                         /* ... calc nbr of req'd bytes.                         */
+           *p_bytes_reqd = size_tot_blk - size_rem_seg;
+        }
+
+       *p_err = LIB_MEM_ERR_SEG_OVF;
+        return (DEF_NULL);
+    }
+
+    p_seg->AddrNext = addr_next;
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return ((void *)blk_addr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     Mem_SegAllocTrackCritical()
+*
+* Description : Tracks segment allocation, adding the 'size' of the allocation under the 'p_name' entry.
+*
+* Argument(s) : p_name  Pointer to the name of the object. This string is not copied and its memory should
+*                       remain accessible at all times.
+*
+*               p_seg   Pointer to segment data.
+*
+*               size    Allocation size, in bytes.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_HEAP_EMPTY      No more memory available on heap
+*
+*                           --------------RETURNED BY Mem_SegAllocExtCritical()---------------
+*                           LIB_MEM_ERR_SEG_OVF         Allocation would overflow memory segment.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_PoolCreate(),
+*               Mem_SegAllocInternal().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+static  void  Mem_SegAllocTrackCritical (const  CPU_CHAR    *p_name,
+                                                MEM_SEG     *p_seg,
+                                                CPU_SIZE_T   size,
+                                                LIB_ERR     *p_err)
+{
+    MEM_ALLOC_INFO  *p_alloc;
+
+
+                                                                /* ------- UPDATE ALLOC INFO LIST, IF POSSIBLE -------- */
+    p_alloc = p_seg->AllocInfoHeadPtr;
+    while (p_alloc != DEF_NULL) {
+        if (p_alloc->NamePtr == p_name) {
+            p_alloc->Size += size;
+           *p_err = LIB_MEM_ERR_NONE;
+            return;
+        }
+
+        p_alloc = p_alloc->NextPtr;
+    }
+
+                                                                /* --------- ADD NEW ALLOC INFO ENTRY IN LIST --------- */
+    p_alloc = (MEM_ALLOC_INFO *)Mem_SegAllocExtCritical(&Mem_SegHeap,             /* Alloc new alloc info struct on heap.                 */
+                                                         sizeof(MEM_ALLOC_INFO),
+                                                         sizeof(CPU_ALIGN),
+                                                         LIB_MEM_PADDING_ALIGN_NONE,
+                                                         DEF_NULL,
+                                                         p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return;
+    }
+
+    p_alloc->NamePtr = p_name;                                  /* Populate alloc info.                                 */
+    p_alloc->Size    = size;
+
+    p_alloc->NextPtr        = p_seg->AllocInfoHeadPtr;          /* Prepend new item in list.                            */
+    p_seg->AllocInfoHeadPtr = p_alloc;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     Mem_DynPoolCreateInternal()
+*
+* Description : Creates a dynamic memory pool.
+*
+* Argument(s) : p_name              Pointer to pool name.
+*
+*               p_pool              Pointer to pool data.
+*
+*               p_seg               Pointer to segment from which to allocate memory.
+*
+*               blk_size            Size of memory block to allocate from pool, in bytes. See Note #1.
+*
+*               blk_align           Required alignment of memory block, in bytes. MUST be a power of 2.
+*
+*               blk_padding_align   Block's padding alignment, in bytes, that will be added at the end
+*                                   of block's buffer. MUST be a power of 2. LIB_MEM_PADDING_ALIGN_NONE
+*                                   means no padding.
+*
+*               blk_qty_init        Initial number of elements to be allocated in pool.
+*
+*               blk_qty_max         Maximum number of elements that can be allocated from this pool. Set to
+*                                   LIB_MEM_BLK_QTY_UNLIMITED if no limit.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_INVALID_BLK_ALIGN   Invalid requested block alignment.
+*                                   LIB_MEM_ERR_INVALID_BLK_SIZE    Invalid requested block size.
+*                                   LIB_MEM_ERR_INVALID_BLK_NBR     Invalid requested block quantity max.
+*                                   LIB_MEM_ERR_NULL_PTR            Pool data pointer NULL.
+*                                   LIB_MEM_ERR_INVALID_SEG_SIZE    Segment too large for lock-free pool (see Note #2).
+*
+*                                   ------------------RETURNED BY Mem_SegAllocInternal()-------------------
+*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory block alignment requested.
+*                                   LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
+*                                   LIB_MEM_ERR_NULL_PTR            Error or segment data pointer NULL.
+*                                   LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Mem_DynPoolCreate(),
+*               Mem_DynPoolCreateHW().
+*
+* Note(s)     : (1) 'blk_size' must be big enough to fit a pointer since the pointer to the next free
+*                   block is stored in the block itself (only when free/unused).
+*
+*               (2) With LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN, the free list holds block offsets from the base of
+*                   the segment on 32 bits (see 'lib_mem.h  DYNAMIC MEMORY POOL DATA TYPE  Note #3').
+*********************************************************************************************************
+*/
+
+static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
+                                                MEM_DYN_POOL  *p_pool,
+                                                MEM_SEG       *p_seg,
+                                                CPU_SIZE_T     blk_size,
+                                                CPU_SIZE_T     blk_align,
+                                                CPU_SIZE_T     blk_padding_align,
+                                                CPU_SIZE_T     blk_qty_init,
+                                                CPU_SIZE_T     blk_qty_max,
+                                                LIB_ERR       *p_err)
+{
+    CPU_INT08U  *p_blks          = DEF_NULL;
+    CPU_INT08U  *p_blks_head     = DEF_NULL;
+    CPU_SIZE_T   blk_size_align;
+    CPU_SIZE_T   blk_align_worst = DEF_MAX(blk_align, blk_padding_align);
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_pool == DEF_NULL) {                                   /* Chk for NULL pool data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    if (blk_size < 1u) {                                        /* Chk for inv blk size.                                */
+       *p_err = LIB_MEM_ERR_INVALID_BLK_SIZE;
+        return;
+    }
+
+    if ((blk_qty_max  != LIB_MEM_BLK_QTY_UNLIMITED) &&          /* Chk for invalid blk qty.                             */
+        (blk_qty_init >  blk_qty_max)) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_NBR;
+        return;
+    }
+
+    if (MATH_IS_PWR2(blk_align) != DEF_YES) {                   /* Chk for illegal align spec.                          */
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ALIGN;
+        return;
+    }
+#endif
+
+#if (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED)          /* Blk offsets MUST fit in 32 bits (see Note #2).       */
+    if ((CPU_INT64U)(p_seg->AddrEnd - p_seg->AddrBase) >= DEF_INT_32U_MAX_VAL) {
+       *p_err = LIB_MEM_ERR_INVALID_SEG_SIZE;
+        return;
+    }
+#endif
+
+                                                                /* Calc blk size with align.                            */
+    if (blk_size < sizeof(void *)) {                            /* If size if smaller than ptr ...                      */
+                                                                /* ... inc size to ptr size.                            */
+        blk_size_align = MATH_ROUND_INC_UP_PWR2(sizeof(void *), blk_align_worst);
+    } else {
+        blk_size_align = MATH_ROUND_INC_UP_PWR2(blk_size, blk_align_worst);
+    }
+
+    if (blk_qty_init != 0u) {                                   /* Alloc init blks.                                     */
+        CPU_SIZE_T  i;
+        p_blks = (CPU_INT08U *)Mem_SegAllocInternal(p_name,
+                                                    p_seg,
+                                                    blk_size_align * blk_qty_init,
+                                                    DEF_MAX(blk_align, sizeof(void *)),
+                                                    LIB_MEM_PADDING_ALIGN_NONE,
+                                                    DEF_NULL,
+                                                    p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            return;
+        }
+
+                                                                /* ----------------- CREATE POOL DATA ----------------- */
+                                                                /* Init free list.                                      */
+        p_blks_head = p_blks;
+        for (i = 0u; i < blk_qty_init - 1u; i++) {
+           *((void **)p_blks)  = p_blks + blk_size_align;
+            p_blks            += blk_size_align;
+        }
+       *((void **)p_blks) = DEF_NULL;
+    }
+
+#if (LIB_MEM_CFG_HEAP_SIZE > 0u)
+    p_pool->PoolSegPtr      = ((p_seg != DEF_NULL) ? p_seg : &Mem_SegHeap);
+#else
+    p_pool->PoolSegPtr      =   p_seg;
+#endif
+#if (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    p_pool->BlkFreeTop      =   MEM_DYN_POOL_BLK_TO_OFFSET(p_pool, p_blks_head);
+#else
+    p_pool->BlkFreePtr      =   p_blks_head;
+#endif
+    p_pool->BlkSize         =   blk_size;
+    p_pool->BlkAlign        =   blk_align_worst;
+    p_pool->BlkPaddingAlign =   blk_padding_align;
+    p_pool->BlkQtyMax       =   blk_qty_max;
+    p_pool->BlkAllocCnt     =   0u;
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_pool->NamePtr = p_name;
+#endif
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      Mem_PoolBlkIsValidAddr()
+*
+* Description : Calculates if a given memory block address is valid for the memory pool.
+*
+* Argument(s) : p_pool   Pointer to memory pool structure to validate memory block address.
+*               ------   Argument validated by caller.
+*
+*               p_mem    Pointer to memory block address to validate.
+*               -----    Argument validated by caller.
+*
+* Return(s)   : DEF_YES, if valid memory pool block address.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Mem_PoolBlkFree().
+*
+* Note(s)     : (1) This function is DEPRECATED and will be removed in a future version of this product.
+*********************************************************************************************************
+*/
+
+#if ((LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) && \
+     (LIB_MEM_CFG_HEAP_SIZE      >  0u))
+static  CPU_BOOLEAN  Mem_PoolBlkIsValidAddr (MEM_POOL  *p_pool,
+                                             void      *p_mem)
+{
+    CPU_ADDR  pool_offset;
+
+
+    if ((p_mem < p_pool->PoolAddrStart) ||
+        (p_mem > p_pool->PoolAddrEnd)) {
+        return (DEF_FALSE);
+    }
+
+    pool_offset = (CPU_ADDR)p_mem - (CPU_ADDR)p_pool->PoolAddrStart;
+    if (pool_offset % p_pool->BlkSize != 0u) {
+        return (DEF_FALSE);
+    } else {
+        return (DEF_TRUE);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     Mem_DynPoolBlkCntReserve()
+*
+* Description : Reserves blocks against the maximum quantity of a dynamic memory pool.
+*
+* Argument(s) : p_pool      Pointer to pool data.
+*
+*               blk_nbr     Number of blocks requested.
+*
+* Return(s)   : Number of blocks reserved, from 0 to 'blk_nbr'.
+*
+* Caller(s)   : Mem_DynPoolBlkGetInternal().
+*
+* Note(s)     : (1) Pools with no maximum quantity do NOT count their blocks.
+*********************************************************************************************************
+*/
+
+static  CPU_SIZE_T  Mem_DynPoolBlkCntReserve (MEM_DYN_POOL  *p_pool,
+                                              CPU_SIZE_T     blk_nbr)
+{
+    CPU_SIZE_T  nbr;
+#if (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_SIZE_T  cnt;
+#else
+    CPU_SR_ALLOC();
+#endif
+
+
+    if (p_pool->BlkQtyMax == LIB_MEM_BLK_QTY_UNLIMITED) {       /* See Note #1.                                         */
+        return (blk_nbr);
+    }
+
+#if (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    do {
+        cnt = MEM_ATOMIC_RD_SIZE(&p_pool->BlkAllocCnt);
+        nbr = DEF_MIN(blk_nbr, p_pool->BlkQtyMax - cnt);
+        if (nbr == 0u) {
+            return (0u);
+        }
+    } while (MEM_ATOMIC_CAS_SIZE(&p_pool->BlkAllocCnt, cnt, cnt + nbr) == 0);
+#else
+    CPU_CRITICAL_ENTER();
+    nbr                  = DEF_MIN(blk_nbr, p_pool->BlkQtyMax - p_pool->BlkAllocCnt);
+    p_pool->BlkAllocCnt += nbr;
+    CPU_CRITICAL_EXIT();
+#endif
+
+    return (nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     Mem_DynPoolBlkCntRelease()
+*
+* Description : Releases blocks reserved against the maximum quantity of a dynamic memory pool.
+*
+* Argument(s) : p_pool      Pointer to pool data.
+*
+*               blk_nbr     Number of blocks to release.
+*
+* Return(s)   : DEF_OK,   if blocks released.
+*
+*               DEF_FAIL, if fewer than 'blk_nbr' blocks are reserved (i.e. pool would overflow).
+*
+* Caller(s)   : Mem_DynPoolBlkGetInternal(),
+*               Mem_DynPoolBlkFreeInternal().
+*
+* Note(s)     : (1) Pools with no maximum quantity do NOT count their blocks.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  Mem_DynPoolBlkCntRelease (MEM_DYN_POOL  *p_pool,
+                                               CPU_SIZE_T     blk_nbr)
+{
+#if (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_SIZE_T  cnt;
+#else
+    CPU_SR_ALLOC();
+#endif
+
+
+    if (p_pool->BlkQtyMax == LIB_MEM_BLK_QTY_UNLIMITED) {       /* See Note #1.                                         */
+        return (DEF_OK);
+    }
+
+#if (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    do {
+        cnt = MEM_ATOMIC_RD_SIZE(&p_pool->BlkAllocCnt);
+        if (cnt < blk_nbr) {
+            return (DEF_FAIL);
+        }
+    } while (MEM_ATOMIC_CAS_SIZE(&p_pool->BlkAllocCnt, cnt, cnt - blk_nbr) == 0);
+#else
+    CPU_CRITICAL_ENTER();
+    if (p_pool->BlkAllocCnt < blk_nbr) {
+        CPU_CRITICAL_EXIT();
+        return (DEF_FAIL);
+    }
+    p_pool->BlkAllocCnt -= blk_nbr;
+    CPU_CRITICAL_EXIT();
+#endif
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_DynPoolListPop()
+*
+* Description : Detaches up to 'blk_nbr' blocks from the head of a dynamic memory pool's free list.
+*
+* Argument(s) : p_pool      Pointer to pool data.
+*
+*               pp_head     Pointer to variable that will receive the first block of the detached list,
+*                           terminated by DEF_NULL.
+*
+*               blk_nbr     Maximum number of blocks to detach.
+*
+* Return(s)   : Number of blocks detached.
+*
+* Caller(s)   : Mem_DynPoolBlkGetInternal().
+*
+* Note(s)     : (1) With LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN, other tasks may pop the blocks being walked &
+*                   overwrite their link before the compare-and-swap. Such a link is only followed while it
+*                   points inside the pool's segment; the compare-and-swap then fails since the head's tag
+*                   changed, & the walk is restarted.
+*********************************************************************************************************
+*/
+
+static  CPU_SIZE_T  Mem_DynPoolListPop (MEM_DYN_POOL   *p_pool,
+                                        void          **pp_head,
+                                        CPU_SIZE_T      blk_nbr)
+{
+    void        *p_head;
+    void        *p_tail;
+    void        *p_next;
+    CPU_SIZE_T   nbr;
+#if (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_INT64U   top;
+    CPU_INT64U   top_next;
+    CPU_ADDR     addr_min;
+    CPU_ADDR     addr_max;
+
+
+    addr_min = p_pool->PoolSegPtr->AddrBase;
+    addr_max = p_pool->PoolSegPtr->AddrEnd + 1u - sizeof(void *);
+
+    do {
+        top    = MEM_ATOMIC_RD_64(&p_pool->BlkFreeTop);
+        p_head = MEM_DYN_POOL_OFFSET_TO_BLK(p_pool, (CPU_INT32U)(top & MEM_DYN_POOL_TOP_OFFSET_MSK));
+        if (p_head == DEF_NULL) {
+           *pp_head = DEF_NULL;
+            return (0u);
+        }
+
+        p_tail = p_head;
+        p_next = *((void **)p_tail);
+        nbr    = 1u;
+        while ((nbr              <  blk_nbr)  &&                /* See Note #1.                                         */
+               (p_next           != DEF_NULL) &&
+               ((CPU_ADDR)p_next >= addr_min) &&
+               ((CPU_ADDR)p_next <= addr_max)) {
+            p_tail = p_next;
+            p_next = *((void **)p_tail);
+            nbr++;
+        }
+
+        top_next = MEM_DYN_POOL_TOP_NEXT(top, MEM_DYN_POOL_BLK_TO_OFFSET(p_pool, p_next));
+    } while (MEM_ATOMIC_CAS_64(&p_pool->BlkFreeTop, top, top_next) == 0);
+
+#else
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_head = p_pool->BlkFreePtr;
+    if (p_head == DEF_NULL) {
+        CPU_CRITICAL_EXIT();
+       *pp_head = DEF_NULL;
+        return (0u);
+    }
+
+    p_tail = p_head;
+    p_next = *((void **)p_tail);
+    nbr    = 1u;
+    while ((nbr    <  blk_nbr) &&
+           (p_next != DEF_NULL)) {
+        p_tail = p_next;
+        p_next = *((void **)p_tail);
+        nbr++;
+    }
+    p_pool->BlkFreePtr = p_next;
+    CPU_CRITICAL_EXIT();
+#endif
+
+   *((void **)p_tail) = DEF_NULL;
+   *pp_head           = p_head;
+
+    return (nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_DynPoolListPush()
+*
+* Description : Inserts a list of blocks at the head of a dynamic memory pool's free list.
+*
+* Argument(s) : p_pool      Pointer to pool data.
+*
+*               p_head      Pointer to first block of list.
+*
+*               p_tail      Pointer to last  block of list.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_DynPoolBlkFreeInternal().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  Mem_DynPoolListPush (MEM_DYN_POOL  *p_pool,
+                                   void          *p_head,
+                                   void          *p_tail)
+{
+#if (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_INT64U  top;
+    CPU_INT64U  top_next;
+
+
+    do {
+        top               = MEM_ATOMIC_RD_64(&p_pool->BlkFreeTop);
+       *((void **)p_tail) = MEM_DYN_POOL_OFFSET_TO_BLK(p_pool, (CPU_INT32U)(top & MEM_DYN_POOL_TOP_OFFSET_MSK));
+        top_next          = MEM_DYN_POOL_TOP_NEXT(top, MEM_DYN_POOL_BLK_TO_OFFSET(p_pool, p_head));
+    } while (MEM_ATOMIC_CAS_64(&p_pool->BlkFreeTop, top, top_next) == 0);
+#else
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+   *((void **)p_tail)  = p_pool->BlkFreePtr;
+    p_pool->BlkFreePtr = p_head;
+    CPU_CRITICAL_EXIT();
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                     Mem_DynPoolBlkGetInternal()
+*
+* Description : Gets up to 'blk_nbr' blocks from a dynamic memory pool, growing it if needed.
+*
+* Argument(s) : p_pool      Pointer to pool data.
+*
+*               pp_head     Pointer to variable that will receive the first block of the list of blocks,
+*                           linked through their first location & terminated by DEF_NULL.
+*
+*               blk_nbr     Number of blocks requested.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                All blocks obtained.
+*                               LIB_MEM_ERR_POOL_EMPTY          Pool reached its maximum quantity.
+*
+*                               ----------------------RETURNED BY Mem_SegAllocInternal()-----------------------
+*                               LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*
+* Return(s)   : Number of blocks obtained, even if an error is returned.
+*
+* Caller(s)   : Mem_DynPoolBlkGet(),
+*               Mem_DynPoolBlkGetBulk(),
+*               Mem_DynPoolCacheBlkGet().
+*
+* Note(s)     : (1) Blocks NOT found in the free list are allocated from the pool's segment, one at a time.
+*                   Their reservation is released if the segment overflows.
+*********************************************************************************************************
+*/
+
+static  CPU_SIZE_T  Mem_DynPoolBlkGetInternal (MEM_DYN_POOL   *p_pool,
+                                               void          **pp_head,
+                                               CPU_SIZE_T      blk_nbr,
+                                               LIB_ERR        *p_err)
+{
+           void        *p_head;
+           void        *p_blk;
+    const  CPU_CHAR    *p_pool_name;
+           CPU_SIZE_T   nbr_reserved;
+           CPU_SIZE_T   nbr;
+
+
+    nbr_reserved = Mem_DynPoolBlkCntReserve(p_pool, blk_nbr);
+    if (nbr_reserved == 0u) {
+       *pp_head = DEF_NULL;
+       *p_err   = LIB_MEM_ERR_POOL_EMPTY;
+        return (0u);
+    }
+
+    nbr = Mem_DynPoolListPop(p_pool, &p_head, nbr_reserved);
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_pool_name = p_pool->NamePtr;
+#else
+    p_pool_name = DEF_NULL;
+#endif
+   *p_err = LIB_MEM_ERR_NONE;
+    while (nbr < nbr_reserved) {                                /* See Note #1.                                         */
+        p_blk = Mem_SegAllocInternal(p_pool_name,
+                                     p_pool->PoolSegPtr,
+                                     p_pool->BlkSize,
+                                     p_pool->BlkAlign,
+                                     p_pool->BlkPaddingAlign,
+                                     DEF_NULL,
+                                     p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            (void)Mem_DynPoolBlkCntRelease(p_pool, nbr_reserved - nbr);
+            break;
+        }
+
+       *((void **)p_blk) = p_head;
+        p_head           = p_blk;
+        nbr++;
+    }
+
+    if ((*p_err == LIB_MEM_ERR_NONE) &&
+        (nbr    <  blk_nbr)) {
+       *p_err = LIB_MEM_ERR_POOL_EMPTY;
+    }
+
+   *pp_head = p_head;
+
+    return (nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    Mem_DynPoolBlkFreeInternal()
+*
+* Description : Returns a list of blocks to a dynamic memory pool.
+*
+* Argument(s) : p_pool      Pointer to pool data.
+*
+*               p_head      Pointer to first block of list.
+*
+*               p_tail      Pointer to last  block of list.
+*
+*               blk_nbr     Number of blocks in list.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_POOL_FULL           Pool would hold more blocks than obtained from it.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_DynPoolBlkFree(),
+*               Mem_DynPoolBlkFreeBulk(),
+*               Mem_DynPoolCacheBlkFree(),
+*               Mem_DynPoolCacheFlush().
+*
+* Note(s)     : (1) The blocks MUST be in the free list before their reservation is released. Otherwise, a
+*                   task getting blocks in between could reserve them, find the free list short & allocate
+*                   new blocks from the pool's segment, growing the pool beyond its maximum quantity.
+*
+*               (2) The count is checked before the blocks are inserted, so that a pool overflow does NOT
+*                   add the blocks to the free list. It is checked again when released.
+*********************************************************************************************************
+*/
+
+static  void  Mem_DynPoolBlkFreeInternal (MEM_DYN_POOL  *p_pool,
+                                          void          *p_head,
+                                          void          *p_tail,
+                                          CPU_SIZE_T     blk_nbr,
+                                          LIB_ERR       *p_err)
+{
+    CPU_SIZE_T  cnt;
+#if (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN != DEF_ENABLED)
+    CPU_SR_ALLOC();
+#endif
+
+
+    if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {       /* Chk for pool ovf (see Note #2).                      */
+#if (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED)
+        cnt = MEM_ATOMIC_RD_SIZE(&p_pool->BlkAllocCnt);
+#else
+        CPU_CRITICAL_ENTER();
+        cnt = p_pool->BlkAllocCnt;
+        CPU_CRITICAL_EXIT();
+#endif
+        if (cnt < blk_nbr) {
+           *p_err = LIB_MEM_ERR_POOL_FULL;
+            return;
+        }
+    }
+
+    Mem_DynPoolListPush(p_pool, p_head, p_tail);                /* See Note #1.                                         */
+
+    if (Mem_DynPoolBlkCntRelease(p_pool, blk_nbr) != DEF_OK) {
+       *p_err = LIB_MEM_ERR_POOL_FULL;
+        return;
+    }
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_SlabPageAdd()
+*
+* Description : Carves a new page from the slab's segment & adds its blocks to a size class.
+*
+* Argument(s) : p_slab      Pointer to slab data.
+*
+*               class_ix    Index of size class.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*
+*                               -------------------RETURNED BY Mem_SegAllocInternal()--------------------
+*                               LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_SlabBlkGetBatch().
+*
+* Note(s)     : (1) The page is allocated & split outside of any critical section; only linking its blocks
+*                   into the class' free list is protected. Two tasks finding the same class empty MAY thus
+*                   each add a page.
+*********************************************************************************************************
+*/
+
+static  void  Mem_SlabPageAdd (MEM_SLAB    *p_slab,
+                               CPU_INT08U   class_ix,
+                               LIB_ERR     *p_err)
+{
+           MEM_SLAB_CLASS  *p_class;
+           MEM_SLAB_PAGE   *p_page;
+           CPU_INT08U      *p_blk_first;
+           CPU_INT08U      *p_blk;
+           CPU_SIZE_T       blk_nbr;
+           CPU_SIZE_T       i;
+    const  CPU_CHAR        *p_name;
+    CPU_SR_ALLOC();
+
+
+    p_class = &p_slab->ClassTbl[class_ix];
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_name  =  p_slab->NamePtr;
+#else
+    p_name  =  DEF_NULL;
+#endif
+    p_page  = (MEM_SLAB_PAGE *)Mem_SegAllocInternal(p_name,
+                                                    p_slab->SegPtr,
+                                                    LIB_MEM_CFG_SLAB_PAGE_SIZE,
+                                                    LIB_MEM_CFG_SLAB_PAGE_SIZE,
+                                                    LIB_MEM_PADDING_ALIGN_NONE,
+                                                    DEF_NULL,
+                                                    p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return;
+    }
+
+    p_page->SlabPtr = p_slab;
+    p_page->ClassIx = class_ix;
+
+    blk_nbr     = (LIB_MEM_CFG_SLAB_PAGE_SIZE - LIB_MEM_CFG_SLAB_ALIGN) / p_class->BlkSize;
+    p_blk_first = (CPU_INT08U *)p_page + LIB_MEM_CFG_SLAB_ALIGN;
+    p_blk       =  p_blk_first;
+    for (i = 1u; i < blk_nbr; i++) {                            /* Link page blks in addr order.                        */
+       *((void **)p_blk) = (void *)(p_blk + p_class->BlkSize);
+        p_blk           +=  p_class->BlkSize;
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #1.                                         */
+   *((void **)p_blk)     = p_class->BlkFreePtr;
+    p_class->BlkFreePtr  = (void *)p_blk_first;
+    p_class->BlkFreeCnt += blk_nbr;
+    p_class->PageCnt++;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SlabBlkGetBatch()
+*
+* Description : Takes one or more blocks from a size class, adding a page to the class if it is empty.
+*
+* Argument(s) : p_slab      Pointer to slab data.
+*
+*               class_ix    Index of size class.
+*
+*               pp_head     Pointer to variable that will receive the first block of a NULL-terminated list.
+*
+*               blk_nbr     Maximum number of blocks to take.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*
+*                               ----------------------RETURNED BY Mem_SlabPageAdd()----------------------
+*                               LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*
+* Return(s)   : Number of blocks taken, between 1 & 'blk_nbr', if successful.
+*
+*               0, otherwise.
+*
+* Caller(s)   : Mem_SlabAlloc(),
+*               Mem_SlabCacheAlloc().
+*
+* Note(s)     : (1) At most 'blk_nbr' links are followed in the critical section.
+*********************************************************************************************************
+*/
+
+static  CPU_SIZE_T  Mem_SlabBlkGetBatch (MEM_SLAB     *p_slab,
+                                         CPU_INT08U    class_ix,
+                                         void        **pp_head,
+                                         CPU_SIZE_T    blk_nbr,
+                                         LIB_ERR      *p_err)
+{
+    MEM_SLAB_CLASS  *p_class;
+    void            *p_blk;
+    CPU_SIZE_T       blk_cnt;
+    CPU_SR_ALLOC();
+
+
+    p_class = &p_slab->ClassTbl[class_ix];
+
+    CPU_CRITICAL_ENTER();
+    while (p_class->BlkFreePtr == DEF_NULL) {                   /* Add page if class empty.                             */
+        CPU_CRITICAL_EXIT();
+        Mem_SlabPageAdd(p_slab, class_ix, p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            return (0u);
+        }
+        CPU_CRITICAL_ENTER();
+    }
+
+    p_blk   = p_class->BlkFreePtr;                              /* See Note #1.                                         */
+    blk_cnt = 1u;
+    while ((blk_cnt          <  blk_nbr) &&
+           (*((void **)p_blk) != DEF_NULL)) {
+        p_blk = *((void **)p_blk);
+        blk_cnt++;
+    }
+
+   *pp_head              =  p_class->BlkFreePtr;
+    p_class->BlkFreePtr  = *((void **)p_blk);
+    p_class->BlkFreeCnt -=  blk_cnt;
+    p_class->BlkUsedCnt +=  blk_cnt;
+    CPU_CRITICAL_EXIT();
+
+   *((void **)p_blk) = DEF_NULL;                                /* Terminate list.                                      */
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (blk_cnt);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SlabBlkPutBatch()
+*
+* Description : Returns a list of blocks to a size class.
+*
+* Argument(s) : p_slab      Pointer to slab data.
+*
+*               class_ix    Index of size class.
+*
+*               p_head      Pointer to first block of list.
+*
+*               p_tail      Pointer to last  block of list.
+*
+*               blk_nbr     Number of blocks in list.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_SlabFree(),
+*               Mem_SlabCacheFree(),
+*               Mem_SlabCacheFlush().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  Mem_SlabBlkPutBatch (MEM_SLAB    *p_slab,
+                                   CPU_INT08U   class_ix,
+                                   void        *p_head,
+                                   void        *p_tail,
+                                   CPU_SIZE_T   blk_nbr)
+{
+    MEM_SLAB_CLASS  *p_class;
+    CPU_SR_ALLOC();
+
+
+    p_class = &p_slab->ClassTbl[class_ix];
+
+    CPU_CRITICAL_ENTER();
+   *((void **)p_tail)    = p_class->BlkFreePtr;
+    p_class->BlkFreePtr  = p_head;
+    p_class->BlkFreeCnt += blk_nbr;
+    p_class->BlkUsedCnt -= blk_nbr;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_SlabBlkClassIxGet()
+*
+* Description : Gets the size class of a slab block from its page header.
+*
+* Argument(s) : p_slab      Pointer to slab data.
+*
+*               p_blk       Pointer to memory block.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_INVALID_BLK_ADDR    Block NOT allocated from this slab.
+*
+* Return(s)   : Index of size class, if successful.
+*
+*               LIB_MEM_SLAB_CLASS_NBR, otherwise.
+*
+* Caller(s)   : Mem_SlabFree(),
+*               Mem_SlabCacheFree().
+*
+* Note(s)     : (1) With external argument checking, the page header & the block's offset in the page are
+*                   validated. The page header of an address that does NOT belong to any slab is still read
+*                   & MUST therefore be accessible.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  Mem_SlabBlkClassIxGet (MEM_SLAB  *p_slab,
+                                           void      *p_blk,
+                                           LIB_ERR   *p_err)
+{
+    MEM_SLAB_PAGE  *p_page;
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    CPU_SIZE_T      blk_offset;
+    CPU_SIZE_T      blk_size;
+#endif
+
+
+    p_page = (MEM_SLAB_PAGE *)((CPU_ADDR)p_blk & ~((CPU_ADDR)LIB_MEM_CFG_SLAB_PAGE_SIZE - 1u));
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* See Note #1.                                         */
+    if ((p_page->SlabPtr != p_slab) ||
+        (p_page->ClassIx >= LIB_MEM_SLAB_CLASS_NBR)) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR;
+        return (LIB_MEM_SLAB_CLASS_NBR);
+    }
+
+    blk_offset = (CPU_SIZE_T)((CPU_ADDR)p_blk - (CPU_ADDR)p_page);
+    blk_size   =  p_slab->ClassTbl[p_page->ClassIx].BlkSize;
+    if ((blk_offset < LIB_MEM_CFG_SLAB_ALIGN) ||
+        (((blk_offset - LIB_MEM_CFG_SLAB_ALIGN) % blk_size) != 0u) ||
+        ((blk_offset  - LIB_MEM_CFG_SLAB_ALIGN + blk_size) > (LIB_MEM_CFG_SLAB_PAGE_SIZE - LIB_MEM_CFG_SLAB_ALIGN))) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR;
+        return (LIB_MEM_SLAB_CLASS_NBR);
+    }
+#else
+    (void)p_slab;
+#endif
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (p_page->ClassIx);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_SIMD_Init()
+*
+* Description : Selects the SIMD implementation of the memory functions.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_Init().
+*
+* Note(s)     : (1) On x86, the widest implementation reported by CPUID is selected :
+*
+*                   (a) AVX2 requires CPUID.1:ECX.OSXSAVE & CPUID.1:ECX.AVX, the YMM state enabled by
+*                       the OS in XCR0 & CPUID.7:EBX.AVX2.
+*
+*                   (b) SSE2 requires CPUID.1:EDX.SSE2.
+*
+*               (2) NEON is part of the ARMv8-A base architecture & is assumed present when the compiler
+*                   targets it; NO run-time detection is performed.
+*
+*               (3) The detected features, including those NOT used by the memory functions (e.g.
+*                   SSE4.2, CPUID.1:ECX.SSE4_2), are kept for Mem_SIMD_FeatGet().
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+static  void  Mem_SIMD_Init (void)
+{
+    CPU_INT08U  impl;
+    LIB_ERR     err;
+#if   (LIB_MEM_SIMD_ARCH == LIB_MEM_SIMD_ARCH_X86)
+    CPU_INT32U  regs[4];
+    CPU_INT32U  leaf_max;
+    CPU_INT32U  xcr0;
+#ifndef  _MSC_VER
+    CPU_INT32U  xcr0_hi;
+#endif
+#endif
+
+
+#if   (LIB_MEM_SIMD_ARCH == LIB_MEM_SIMD_ARCH_X86)
+    Mem_SIMD_Avail = DEF_BIT(LIB_MEM_SIMD_IMPL_NONE);
+    Mem_SIMD_Feat  = DEF_BIT_NONE;
+
+    Mem_SIMD_CPUID(0u, regs);
+    leaf_max = regs[0];
+
+    Mem_SIMD_CPUID(1u, regs);
+    if (DEF_BIT_IS_SET(regs[3], DEF_BIT_26) == DEF_YES) {       /* See Note #1b.                                        */
+        DEF_BIT_SET(Mem_SIMD_Avail, DEF_BIT(LIB_MEM_SIMD_IMPL_SSE2));
+        DEF_BIT_SET(Mem_SIMD_Feat,  LIB_MEM_SIMD_FEAT_SSE2);
+    }
+    if (DEF_BIT_IS_SET(regs[2], DEF_BIT_20) == DEF_YES) {       /* See Note #3.                                         */
+        DEF_BIT_SET(Mem_SIMD_Feat,  LIB_MEM_SIMD_FEAT_SSE42);
+    }
+                                                                /* See Note #1a.                                        */
+    if ((DEF_BIT_IS_SET(regs[2], DEF_BIT_27 | DEF_BIT_28) == DEF_YES) &&
+        (leaf_max >= 7u)) {
+#ifdef  _MSC_VER
+        xcr0 = (CPU_INT32U)_xgetbv(0u);
+#else
+        __asm__ volatile ("xgetbv" : "=a"(xcr0), "=d"(xcr0_hi) : "c"(0u));
+#endif
+        if (DEF_BIT_IS_SET(xcr0, DEF_BIT_01 | DEF_BIT_02) == DEF_YES) {
+            Mem_SIMD_CPUID(7u, regs);
+            if (DEF_BIT_IS_SET(regs[1], DEF_BIT_05) == DEF_YES) {
+                DEF_BIT_SET(Mem_SIMD_Avail, DEF_BIT(LIB_MEM_SIMD_IMPL_AVX2));
+                DEF_BIT_SET(Mem_SIMD_Feat,  LIB_MEM_SIMD_FEAT_AVX2);
+            }
+        }
+    }
+
+    if (DEF_BIT_IS_SET(Mem_SIMD_Avail, DEF_BIT(LIB_MEM_SIMD_IMPL_AVX2)) == DEF_YES) {
+        impl = LIB_MEM_SIMD_IMPL_AVX2;
+    } else if (DEF_BIT_IS_SET(Mem_SIMD_Avail, DEF_BIT(LIB_MEM_SIMD_IMPL_SSE2)) == DEF_YES) {
+        impl = LIB_MEM_SIMD_IMPL_SSE2;
+    } else {
+        impl = LIB_MEM_SIMD_IMPL_NONE;
+    }
+
+#elif (LIB_MEM_SIMD_ARCH == LIB_MEM_SIMD_ARCH_NEON)             /* See Note #2.                                         */
+    Mem_SIMD_Avail = DEF_BIT(LIB_MEM_SIMD_IMPL_NONE) | DEF_BIT(LIB_MEM_SIMD_IMPL_NEON);
+    Mem_SIMD_Feat  = LIB_MEM_SIMD_FEAT_NEON;
+    impl           = LIB_MEM_SIMD_IMPL_NEON;
+
+#else
+    Mem_SIMD_Avail = DEF_BIT(LIB_MEM_SIMD_IMPL_NONE);
+    impl           = LIB_MEM_SIMD_IMPL_NONE;
+#endif
+
+    Mem_SIMD_ImplSet(impl, &err);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_SIMD_CPUID()
+*
+* Description : Executes the CPUID instruction for the specified leaf (sub-leaf 0).
+*
+* Argument(s) : leaf        CPUID leaf.
+*
+*               regs        Array that receives EAX, EBX, ECX & EDX, in that order.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_SIMD_Init().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if ((LIB_MEM_CFG_SIMD_EN == DEF_ENABLED) && \
+     (LIB_MEM_SIMD_ARCH   == LIB_MEM_SIMD_ARCH_X86))
+static  void  Mem_SIMD_CPUID (CPU_INT32U   leaf,
+                              CPU_INT32U  *regs)
+{
+#ifdef  _MSC_VER
+    __cpuidex((int *)regs, (int)leaf, 0);
+#else
+    __cpuid_count(leaf, 0u, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_SIMD_Set_SSE2()
+*                                         Mem_SIMD_Set_AVX2()
+*                                         Mem_SIMD_Set_NEON()
+*
+* Description : Fills data buffer with specified data octet, using vector stores.
+*
+* Argument(s) : p_mem       Pointer to memory buffer to fill.
+*
+*               data_val    Data fill octet value.
+*
+*               size        Number of data buffer octets to fill; MUST be >= vector size.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_Set().
+*
+* Note(s)     : (1) The first & last vectors are stored unaligned & may overlap the aligned stores in
+*                   between, which avoids any octet loop.
+*
+*               (2) Buffers of at least LIB_MEM_CFG_SIMD_NT_THRESHOLD octets are filled with non-temporal
+*                   stores, fenced before returning so that they are ordered with subsequent stores.
+*********************************************************************************************************
+*/
+
+#if ((LIB_MEM_CFG_SIMD_EN == DEF_ENABLED) && \
+     (LIB_MEM_SIMD_ARCH   == LIB_MEM_SIMD_ARCH_X86))
+LIB_MEM_SIMD_TGT("sse2")
+static  void  Mem_SIMD_Set_SSE2 (CPU_INT08U  *p_mem,
+                                 CPU_INT08U   data_val,
+                                 CPU_SIZE_T   size)
+{
+    __m128i      vect;
+    CPU_INT08U  *p_mem_end;
+    CPU_SIZE_T   size_rem;
+
+
+    vect      = _mm_set1_epi8((char)data_val);
+    p_mem_end =  p_mem + size;
+                                                                /* See Note #1.                                         */
+    _mm_storeu_si128((__m128i *)p_mem,               vect);
+    _mm_storeu_si128((__m128i *)(p_mem_end - 16u),   vect);
+
+    size_rem  = (CPU_SIZE_T)(16u - ((CPU_ADDR)p_mem % 16u));
+    p_mem    += size_rem;
+    size_rem  = size - size_rem;
+
+    if (size >= LIB_MEM_CFG_SIMD_NT_THRESHOLD) {                /* See Note #2.                                         */
+        while (size_rem >= 64u) {
+            _mm_stream_si128((__m128i *)(p_mem +  0u), vect);
+            _mm_stream_si128((__m128i *)(p_mem + 16u), vect);
+            _mm_stream_si128((__m128i *)(p_mem + 32u), vect);
+            _mm_stream_si128((__m128i *)(p_mem + 48u), vect);
+            p_mem    += 64u;
+            size_rem -= 64u;
+        }
+        _mm_sfence();
+    } else {
+        while (size_rem >= 64u) {
+            _mm_store_si128((__m128i *)(p_mem +  0u), vect);
+            _mm_store_si128((__m128i *)(p_mem + 16u), vect);
+            _mm_store_si128((__m128i *)(p_mem + 32u), vect);
+            _mm_store_si128((__m128i *)(p_mem + 48u), vect);
+            p_mem    += 64u;
+            size_rem -= 64u;
+        }
+    }
+
+    while (size_rem >= 16u) {
+        _mm_store_si128((__m128i *)p_mem, vect);
+        p_mem    += 16u;
+        size_rem -= 16u;
+    }
+}
+
+
+LIB_MEM_SIMD_TGT("avx2")
+static  void  Mem_SIMD_Set_AVX2 (CPU_INT08U  *p_mem,
+                                 CPU_INT08U   data_val,
+                                 CPU_SIZE_T   size)
+{
+    __m256i      vect;
+    CPU_INT08U  *p_mem_end;
+    CPU_SIZE_T   size_rem;
+
+
+    vect      = _mm256_set1_epi8((char)data_val);
+    p_mem_end =  p_mem + size;
+                                                                /* See Note #1.                                         */
+    _mm256_storeu_si256((__m256i *)p_mem,             vect);
+    _mm256_storeu_si256((__m256i *)(p_mem_end - 32u), vect);
+
+    size_rem  = (CPU_SIZE_T)(32u - ((CPU_ADDR)p_mem % 32u));
+    p_mem    += size_rem;
+    size_rem  = size - size_rem;
+
+    if (size >= LIB_MEM_CFG_SIMD_NT_THRESHOLD) {                /* See Note #2.                                         */
+        while (size_rem >= 128u) {
+            _mm256_stream_si256((__m256i *)(p_mem +  0u), vect);
+            _mm256_stream_si256((__m256i *)(p_mem + 32u), vect);
+            _mm256_stream_si256((__m256i *)(p_mem + 64u), vect);
+            _mm256_stream_si256((__m256i *)(p_mem + 96u), vect);
+            p_mem    += 128u;
+            size_rem -= 128u;
+        }
+        _mm_sfence();
+    } else {
+        while (size_rem >= 128u) {
+            _mm256_store_si256((__m256i *)(p_mem +  0u), vect);
+            _mm256_store_si256((__m256i *)(p_mem + 32u), vect);
+            _mm256_store_si256((__m256i *)(p_mem + 64u), vect);
+            _mm256_store_si256((__m256i *)(p_mem + 96u), vect);
+            p_mem    += 128u;
+            size_rem -= 128u;
+        }
+    }
+
+    while (size_rem >= 32u) {
+        _mm256_store_si256((__m256i *)p_mem, vect);
+        p_mem    += 32u;
+        size_rem -= 32u;
+    }
+}
+#endif
+
+
+#if ((LIB_MEM_CFG_SIMD_EN == DEF_ENABLED) && \
+     (LIB_MEM_SIMD_ARCH   == LIB_MEM_SIMD_ARCH_NEON))
+static  void  Mem_SIMD_Set_NEON (CPU_INT08U  *p_mem,
+                                 CPU_INT08U   data_val,
+                                 CPU_SIZE_T   size)
+{
+    uint8x16_t   vect;
+    CPU_INT08U  *p_mem_end;
+    CPU_SIZE_T   size_rem;
+
+
+    vect      = vdupq_n_u8(data_val);
+    p_mem_end = p_mem + size;
+                                                                /* See Note #1.                                         */
+    vst1q_u8(p_mem,             vect);
+    vst1q_u8(p_mem_end - 16u,   vect);
+
+    size_rem  = (CPU_SIZE_T)(16u - ((CPU_ADDR)p_mem % 16u));
+    p_mem    += size_rem;
+    size_rem  = size - size_rem;
+
+    while (size_rem >= 64u) {                                   /* No non-temporal stores on NEON (see Note #2).        */
+        vst1q_u8(p_mem +  0u, vect);
+        vst1q_u8(p_mem + 16u, vect);
+        vst1q_u8(p_mem + 32u, vect);
+        vst1q_u8(p_mem + 48u, vect);
+        p_mem    += 64u;
+        size_rem -= 64u;
+    }
+
+    while (size_rem >= 16u) {
+        vst1q_u8(p_mem, vect);
+        p_mem    += 16u;
+        size_rem -= 16u;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SIMD_Copy_SSE2()
+*                                        Mem_SIMD_Copy_AVX2()
+*                                        Mem_SIMD_Copy_NEON()
+*
+* Description : Copies data octets from one memory buffer to another, in ascending address order, using
+*               vector loads & stores.
+*
+* Argument(s) : p_dest      Pointer to destination memory buffer.
+*
+*               p_src       Pointer to source      memory buffer.
+*
+*               size        Number of octets to copy.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_Copy(),
+*               Mem_SIMD_Move_SSE2(),
+*               Mem_SIMD_Move_AVX2(),
+*               Mem_SIMD_Move_NEON().
+*
+* Note(s)     : (1) Each group of vectors is loaded before it is stored & the leading & trailing octets are
+*                   copied one at a time. Overlapping buffers are thus copied correctly as long as the source
+*                   buffer is at a higher address value than the destination buffer (see 'Mem_Copy()
+*                   Note #2b').
+*
+*               (2) The destination buffer is aligned on the vector size; source loads are unaligned.
+*
+*               (3) Non-temporal stores are used only for large copies between buffers that do NOT overlap
+*                   (see also 'Mem_SIMD_Set_SSE2()  Note #2').
+*********************************************************************************************************
+*/
+
+#if ((LIB_MEM_CFG_SIMD_EN == DEF_ENABLED) && \
+     (LIB_MEM_SIMD_ARCH   == LIB_MEM_SIMD_ARCH_X86))
+LIB_MEM_SIMD_TGT("sse2")
+static  void  Mem_SIMD_Copy_SSE2 (       CPU_INT08U  *p_dest,
+                                  const  CPU_INT08U  *p_src,
+                                         CPU_SIZE_T   size)
+{
+    __m128i      vect_0;
+    __m128i      vect_1;
+    __m128i      vect_2;
+    __m128i      vect_3;
+    CPU_BOOLEAN  nt;
+
+
+    nt = ((size                                >= LIB_MEM_CFG_SIMD_NT_THRESHOLD) &&
+          ((CPU_SIZE_T)(p_src - p_dest)        >= size)                          &&
+          ((CPU_SIZE_T)(p_dest - p_src)        >= size)) ? DEF_YES : DEF_NO;
+
+    while ((size > 0u) &&                                       /* See Note #2.                                         */
+           (((CPU_ADDR)p_dest % 16u) != 0u)) {
+       *p_dest++ = *p_src++;
+        size--;
+    }
+
+    while (size >= 64u) {                                       /* See Note #1.                                         */
+        vect_0 = _mm_loadu_si128((const __m128i *)(p_src +  0u));
+        vect_1 = _mm_loadu_si128((const __m128i *)(p_src + 16u));
+        vect_2 = _mm_loadu_si128((const __m128i *)(p_src + 32u));
+        vect_3 = _mm_loadu_si128((const __m128i *)(p_src + 48u));
+        if (nt == DEF_YES) {                                    /* See Note #3.                                         */
+            _mm_stream_si128((__m128i *)(p_dest +  0u), vect_0);
+            _mm_stream_si128((__m128i *)(p_dest + 16u), vect_1);
+            _mm_stream_si128((__m128i *)(p_dest + 32u), vect_2);
+            _mm_stream_si128((__m128i *)(p_dest + 48u), vect_3);
+        } else {
+            _mm_store_si128((__m128i *)(p_dest +  0u), vect_0);
+            _mm_store_si128((__m128i *)(p_dest + 16u), vect_1);
+            _mm_store_si128((__m128i *)(p_dest + 32u), vect_2);
+            _mm_store_si128((__m128i *)(p_dest + 48u), vect_3);
+        }
+        p_dest += 64u;
+        p_src  += 64u;
+        size   -= 64u;
+    }
+    if (nt == DEF_YES) {
+        _mm_sfence();
+    }
+
+    while (size >= 16u) {
+        vect_0 = _mm_loadu_si128((const __m128i *)p_src);
+        _mm_store_si128((__m128i *)p_dest, vect_0);
+        p_dest += 16u;
+        p_src  += 16u;
+        size   -= 16u;
+    }
+
+    while (size > 0u) {
+       *p_dest++ = *p_src++;
+        size--;
+    }
+}
+
+
+LIB_MEM_SIMD_TGT("avx2")
+static  void  Mem_SIMD_Copy_AVX2 (       CPU_INT08U  *p_dest,
+                                  const  CPU_INT08U  *p_src,
+                                         CPU_SIZE_T   size)
+{
+    __m256i      vect_0;
+    __m256i      vect_1;
+    __m256i      vect_2;
+    __m256i      vect_3;
+    CPU_BOOLEAN  nt;
+
+
+    nt = ((size                                >= LIB_MEM_CFG_SIMD_NT_THRESHOLD) &&
+          ((CPU_SIZE_T)(p_src - p_dest)        >= size)                          &&
+          ((CPU_SIZE_T)(p_dest - p_src)        >= size)) ? DEF_YES : DEF_NO;
+
+    while ((size > 0u) &&                                       /* See Note #2.                                         */
+           (((CPU_ADDR)p_dest % 32u) != 0u)) {
+       *p_dest++ = *p_src++;
+        size--;
+    }
+
+    while (size >= 128u) {                                      /* See Note #1.                                         */
+        vect_0 = _mm256_loadu_si256((const __m256i *)(p_src +  0u));
+        vect_1 = _mm256_loadu_si256((const __m256i *)(p_src + 32u));
+        vect_2 = _mm256_loadu_si256((const __m256i *)(p_src + 64u));
+        vect_3 = _mm256_loadu_si256((const __m256i *)(p_src + 96u));
+        if (nt == DEF_YES) {                                    /* See Note #3.                                         */
+            _mm256_stream_si256((__m256i *)(p_dest +  0u), vect_0);
+            _mm256_stream_si256((__m256i *)(p_dest + 32u), vect_1);
+            _mm256_stream_si256((__m256i *)(p_dest + 64u), vect_2);
+            _mm256_stream_si256((__m256i *)(p_dest + 96u), vect_3);
+        } else {
+            _mm256_store_si256((__m256i *)(p_dest +  0u), vect_0);
+            _mm256_store_si256((__m256i *)(p_dest + 32u), vect_1);
+            _mm256_store_si256((__m256i *)(p_dest + 64u), vect_2);
+            _mm256_store_si256((__m256i *)(p_dest + 96u), vect_3);
+        }
+        p_dest += 128u;
+        p_src  += 128u;
+        size   -= 128u;
+    }
+    if (nt == DEF_YES) {
+        _mm_sfence();
+    }
+
+    while (size >= 32u) {
+        vect_0 = _mm256_loadu_si256((const __m256i *)p_src);
+        _mm256_store_si256((__m256i *)p_dest, vect_0);
+        p_dest += 32u;
+        p_src  += 32u;
+        size   -= 32u;
+    }
+
+    while (size > 0u) {
+       *p_dest++ = *p_src++;
+        size--;
+    }
+}
+#endif
+
+
+#if ((LIB_MEM_CFG_SIMD_EN == DEF_ENABLED) && \
+     (LIB_MEM_SIMD_ARCH   == LIB_MEM_SIMD_ARCH_NEON))
+static  void  Mem_SIMD_Copy_NEON (       CPU_INT08U  *p_dest,
+                                  const  CPU_INT08U  *p_src,
+                                         CPU_SIZE_T   size)
+{
+    uint8x16_t  vect_0;
+    uint8x16_t  vect_1;
+    uint8x16_t  vect_2;
+    uint8x16_t  vect_3;
+
+
+    while ((size > 0u) &&                                       /* See Note #2.                                         */
+           (((CPU_ADDR)p_dest % 16u) != 0u)) {
+       *p_dest++ = *p_src++;
+        size--;
+    }
+
+    while (size >= 64u) {                                       /* See Note #1.                                         */
+        vect_0 = vld1q_u8(p_src +  0u);
+        vect_1 = vld1q_u8(p_src + 16u);
+        vect_2 = vld1q_u8(p_src + 32u);
+        vect_3 = vld1q_u8(p_src + 48u);
+        vst1q_u8(p_dest +  0u, vect_0);
+        vst1q_u8(p_dest + 16u, vect_1);
+        vst1q_u8(p_dest + 32u, vect_2);
+        vst1q_u8(p_dest + 48u, vect_3);
+        p_dest += 64u;
+        p_src  += 64u;
+        size   -= 64u;
+    }
+
+    while (size >= 16u) {
+        vst1q_u8(p_dest, vld1q_u8(p_src));
+        p_dest += 16u;
+        p_src  += 16u;
+        size   -= 16u;
+    }
+
+    while (size > 0u) {
+       *p_dest++ = *p_src++;
+        size--;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SIMD_Move_SSE2()
+*                                        Mem_SIMD_Move_AVX2()
+*                                        Mem_SIMD_Move_NEON()
+*
+* Description : Moves data octets from one memory buffer to another memory buffer at a higher address
+*               value, using vector loads & stores.
+*
+* Argument(s) : p_dest      Pointer to destination memory buffer.
+*
+*               p_src       Pointer to source      memory buffer; MUST be <= p_dest.
+*
+*               size        Number of octets to move.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_Move().
+*
+* Note(s)     : (1) Buffers that do NOT overlap are copied in ascending address order.
+*
+*               (2) Overlapping buffers are moved in descending address order, from the end of the buffers;
+*                   each group of vectors is loaded before it is stored.
+*********************************************************************************************************
+*/
+
+#if ((LIB_MEM_CFG_SIMD_EN == DEF_ENABLED) && \
+     (LIB_MEM_SIMD_ARCH   == LIB_MEM_SIMD_ARCH_X86))
+LIB_MEM_SIMD_TGT("sse2")
+static  void  Mem_SIMD_Move_SSE2 (       CPU_INT08U  *p_dest,
+                                  const  CPU_INT08U  *p_src,
+                                         CPU_SIZE_T   size)
+{
+    __m128i  vect_0;
+    __m128i  vect_1;
+    __m128i  vect_2;
+    __m128i  vect_3;
+
+
+    if ((CPU_SIZE_T)(p_dest - p_src) >= size) {                 /* See Note #1.                                         */
+        Mem_SIMD_Copy_SSE2(p_dest, p_src, size);
+        return;
+    }
+
+    p_dest += size;                                             /* See Note #2.                                         */
+    p_src  += size;
+
+    while ((size > 0u) &&
+           (((CPU_ADDR)p_dest % 16u) != 0u)) {
+       *--p_dest = *--p_src;
+        size--;
+    }
+
+    while (size >= 64u) {
+        p_dest -= 64u;
+        p_src  -= 64u;
+        vect_0  = _mm_loadu_si128((const __m128i *)(p_src +  0u));
+        vect_1  = _mm_loadu_si128((const __m128i *)(p_src + 16u));
+        vect_2  = _mm_loadu_si128((const __m128i *)(p_src + 32u));
+        vect_3  = _mm_loadu_si128((const __m128i *)(p_src + 48u));
+        _mm_store_si128((__m128i *)(p_dest + 48u), vect_3);
+        _mm_store_si128((__m128i *)(p_dest + 32u), vect_2);
+        _mm_store_si128((__m128i *)(p_dest + 16u), vect_1);
+        _mm_store_si128((__m128i *)(p_dest +  0u), vect_0);
+        size   -= 64u;
+    }
+
+    while (size >= 16u) {
+        p_dest -= 16u;
+        p_src  -= 16u;
+        vect_0  = _mm_loadu_si128((const __m128i *)p_src);
+        _mm_store_si128((__m128i *)p_dest, vect_0);
+        size   -= 16u;
+    }
+
+    while (size > 0u) {
+       *--p_dest = *--p_src;
+        size--;
+    }
+}
+
+
+LIB_MEM_SIMD_TGT("avx2")
+static  void  Mem_SIMD_Move_AVX2 (       CPU_INT08U  *p_dest,
+                                  const  CPU_INT08U  *p_src,
+                                         CPU_SIZE_T   size)
+{
+    __m256i  vect_0;
+    __m256i  vect_1;
+    __m256i  vect_2;
+    __m256i  vect_3;
+
+
+    if ((CPU_SIZE_T)(p_dest - p_src) >= size) {                 /* See Note #1.                                         */
+        Mem_SIMD_Copy_AVX2(p_dest, p_src, size);
+        return;
+    }
+
+    p_dest += size;                                             /* See Note #2.                                         */
+    p_src  += size;
+
+    while ((size > 0u) &&
+           (((CPU_ADDR)p_dest % 32u) != 0u)) {
+       *--p_dest = *--p_src;
+        size--;
+    }
+
+    while (size >= 128u) {
+        p_dest -= 128u;
+        p_src  -= 128u;
+        vect_0  = _mm256_loadu_si256((const __m256i *)(p_src +  0u));
+        vect_1  = _mm256_loadu_si256((const __m256i *)(p_src + 32u));
+        vect_2  = _mm256_loadu_si256((const __m256i *)(p_src + 64u));
+        vect_3  = _mm256_loadu_si256((const __m256i *)(p_src + 96u));
+        _mm256_store_si256((__m256i *)(p_dest + 96u), vect_3);
+        _mm256_store_si256((__m256i *)(p_dest + 64u), vect_2);
+        _mm256_store_si256((__m256i *)(p_dest + 32u), vect_1);
+        _mm256_store_si256((__m256i *)(p_dest +  0u), vect_0);
+        size   -= 128u;
+    }
+
+    while (size >= 32u) {
+        p_dest -= 32u;
+        p_src  -= 32u;
+        vect_0  = _mm256_loadu_si256((const __m256i *)p_src);
+        _mm256_store_si256((__m256i *)p_dest, vect_0);
+        size   -= 32u;
+    }
+
+    while (size > 0u) {
+       *--p_dest = *--p_src;
+        size--;
+    }
+}
+#endif
+
+
+#if ((LIB_MEM_CFG_SIMD_EN == DEF_ENABLED) && \
+     (LIB_MEM_SIMD_ARCH   == LIB_MEM_SIMD_ARCH_NEON))
+static  void  Mem_SIMD_Move_NEON (       CPU_INT08U  *p_dest,
+                                  const  CPU_INT08U  *p_src,
+                                         CPU_SIZE_T   size)
+{
+    uint8x16_t  vect_0;
+    uint8x16_t  vect_1;
+    uint8x16_t  vect_2;
+    uint8x16_t  vect_3;
+
+
+    if ((CPU_SIZE_T)(p_dest - p_src) >= size) {                 /* See Note #1.                                         */
+        Mem_SIMD_Copy_NEON(p_dest, p_src, size);
+        return;
+    }
+
+    p_dest += size;                                             /* See Note #2.                                         */
+    p_src  += size;
+
+    while ((size > 0u) &&
+           (((CPU_ADDR)p_dest % 16u) != 0u)) {
+       *--p_dest = *--p_src;
+        size--;
+    }
+
+    while (size >= 64u) {
+        p_dest -= 64u;
+        p_src  -= 64u;
+        vect_0  = vld1q_u8(p_src +  0u);
+        vect_1  = vld1q_u8(p_src + 16u);
+        vect_2  = vld1q_u8(p_src + 32u);
+        vect_3  = vld1q_u8(p_src + 48u);
+        vst1q_u8(p_dest + 48u, vect_3);
+        vst1q_u8(p_dest + 32u, vect_2);
+        vst1q_u8(p_dest + 16u, vect_1);
+        vst1q_u8(p_dest +  0u, vect_0);
+        size   -= 64u;
+    }
+
+    while (size >= 16u) {
+        p_dest -= 16u;
+        p_src  -= 16u;
+        vst1q_u8(p_dest, vld1q_u8(p_src));
+        size   -= 16u;
+    }
+
+    while (size > 0u) {
+       *--p_dest = *--p_src;
+        size--;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_SIMD_Cmp_SSE2()
+*                                         Mem_SIMD_Cmp_AVX2()
+*                                         Mem_SIMD_Cmp_NEON()
+*
+* Description : Verifies that ALL data octets in two memory buffers are identical in sequence, using vector
+*               compares.
+*
+* Argument(s) : p1_mem      Pointer to first  memory buffer.
+*
+*               p2_mem      Pointer to second memory buffer.
+*
+*               size        Number of data buffer octets to compare.
+*
+* Return(s)   : DEF_YES, if 'size' number of data octets are identical in both memory buffers.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Mem_Cmp().
+*
+* Note(s)     : (1) As for Mem_Cmp(), the comparison starts from the end of the memory buffers (see
+*                   'Mem_Cmp()  Note #2').
+*********************************************************************************************************
+*/
+
+#if ((LIB_MEM_CFG_SIMD_EN == DEF_ENABLED) && \
+     (LIB_MEM_SIMD_ARCH   == LIB_MEM_SIMD_ARCH_X86))
+LIB_MEM_SIMD_TGT("sse2")
+static  CPU_BOOLEAN  Mem_SIMD_Cmp_SSE2 (const  CPU_INT08U  *p1_mem,
+                                        const  CPU_INT08U  *p2_mem,
+                                               CPU_SIZE_T   size)
+{
+    __m128i  vect_eq;
+
+
+    p1_mem += size;                                             /* See Note #1.                                         */
+    p2_mem += size;
+
+    while (size >= 16u) {
+        p1_mem  -= 16u;
+        p2_mem  -= 16u;
+        vect_eq  = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)p1_mem),
+                                  _mm_loadu_si128((const __m128i *)p2_mem));
+        if (_mm_movemask_epi8(vect_eq) != 0xFFFF) {
+            return (DEF_NO);
+        }
+        size    -= 16u;
+    }
+
+    while (size > 0u) {
+        p1_mem--;
+        p2_mem--;
+        if (*p1_mem != *p2_mem) {
+            return (DEF_NO);
+        }
+        size--;
+    }
+
+    return (DEF_YES);
+}
+
+
+LIB_MEM_SIMD_TGT("avx2")
+static  CPU_BOOLEAN  Mem_SIMD_Cmp_AVX2 (const  CPU_INT08U  *p1_mem,
+                                        const  CPU_INT08U  *p2_mem,
+                                               CPU_SIZE_T   size)
+{
+    __m256i  vect_eq;
+
+
+    p1_mem += size;                                             /* See Note #1.                                         */
+    p2_mem += size;
+
+    while (size >= 32u) {
+        p1_mem  -= 32u;
+        p2_mem  -= 32u;
+        vect_eq  = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)p1_mem),
+                                     _mm256_loadu_si256((const __m256i *)p2_mem));
+        if ((CPU_INT32U)_mm256_movemask_epi8(vect_eq) != 0xFFFFFFFFu) {
+            return (DEF_NO);
+        }
+        size    -= 32u;
+    }
+
+    while (size > 0u) {
+        p1_mem--;
+        p2_mem--;
+        if (*p1_mem != *p2_mem) {
+            return (DEF_NO);
+        }
+        size--;
+    }
+
+    return (DEF_YES);
+}
+#endif
+
+
+#if ((LIB_MEM_CFG_SIMD_EN == DEF_ENABLED) && \
+     (LIB_MEM_SIMD_ARCH   == LIB_MEM_SIMD_ARCH_NEON))
+static  CPU_BOOLEAN  Mem_SIMD_Cmp_NEON (const  CPU_INT08U  *p1_mem,
+                                        const  CPU_INT08U  *p2_mem,
+                                               CPU_SIZE_T   size)
+{
+    uint64x2_t  vect_eq;
+
+
+    p1_mem += size;                                             /* See Note #1.                                         */
+    p2_mem += size;
+
+    while (size >= 16u) {
+        p1_mem  -= 16u;
+        p2_mem  -= 16u;
+        vect_eq  = vreinterpretq_u64_u8(vceqq_u8(vld1q_u8(p1_mem), vld1q_u8(p2_mem)));
+        if ((vgetq_lane_u64(vect_eq, 0) & vgetq_lane_u64(vect_eq, 1)) != DEF_INT_64U_MAX_VAL) {
+            return (DEF_NO);
+        }
+        size    -= 16u;
+    }
+
+    while (size > 0u) {
+        p1_mem--;
+        p2_mem--;
+        if (*p1_mem != *p2_mem) {
+            return (DEF_NO);
+        }
+        size--;
+    }
+
+    return (DEF_YES);
 }
 #endif
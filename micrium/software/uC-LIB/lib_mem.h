@@ -137,6 +137,23 @@
 
 #define  LIB_MEM_BLK_QTY_UNLIMITED                        0u
 
+                                                                /* ------------------- SLAB CLASSES ------------------- */
+#define  LIB_MEM_SLAB_CLASS_NBR                          10u    /* Nbr of size classes.                                 */
+                                                                /* Largest blk size.                                    */
+#define  LIB_MEM_SLAB_BLK_SIZE_MAX              (32u * LIB_MEM_CFG_SLAB_ALIGN)
+
+                                                                /* -------------------- SIMD IMPL --------------------- */
+#define  LIB_MEM_SIMD_IMPL_NONE                           0u    /* Portable CPU_ALIGN-sized words & octets.             */
+#define  LIB_MEM_SIMD_IMPL_SSE2                           1u    /* x86 128-bit vectors.                                 */
+#define  LIB_MEM_SIMD_IMPL_AVX2                           2u    /* x86 256-bit vectors.                                 */
+#define  LIB_MEM_SIMD_IMPL_NEON                           3u    /* ARM 128-bit vectors.                                 */
+
+                                                                /* ---------------- SIMD CPU FEATURES ----------------- */
+#define  LIB_MEM_SIMD_FEAT_SSE2                  DEF_BIT_00     /* x86 SSE2.                                            */
+#define  LIB_MEM_SIMD_FEAT_SSE42                 DEF_BIT_01     /* x86 SSE4.2 (incl. CRC32 instruction).                */
+#define  LIB_MEM_SIMD_FEAT_AVX2                  DEF_BIT_02     /* x86 AVX2, YMM state saved by the OS.                 */
+#define  LIB_MEM_SIMD_FEAT_NEON                  DEF_BIT_03     /* ARM NEON.                                            */
+
 
 /*
 *********************************************************************************************************
@@ -184,6 +201,89 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                            MEMORY LIBRARY SIMD OPTIMIZATION CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_SIMD_EN to enable/disable the vectorized Mem_Set(), Mem_Copy(),
+*               Mem_Move() & Mem_Cmp() implementations. The widest implementation supported by the CPU is
+*               selected once, by Mem_Init(); the portable implementation remains the fallback.
+*
+*           (2) Configure LIB_MEM_CFG_SIMD_NT_THRESHOLD with the size, in octets, from which Mem_Set() &
+*               Mem_Copy() use non-temporal stores that bypass the cache.  A buffer larger than the
+*               last-level cache would evict the working set without ever being re-read from it; below
+*               that size, non-temporal stores are slower than cached stores.
+*********************************************************************************************************
+*/
+
+                                                                /* Cfg SIMD-optimized function(s) [see Note #1] :       */
+#ifndef  LIB_MEM_CFG_SIMD_EN
+#define  LIB_MEM_CFG_SIMD_EN            DEF_DISABLED
+                                                                /* DEF_DISABLED     SIMD-optimized fnct(s) DISABLED     */
+                                                                /* DEF_ENABLED      SIMD-optimized fnct(s) ENABLED      */
+#endif
+
+#ifndef  LIB_MEM_CFG_SIMD_NT_THRESHOLD                          /* Cfg non-temporal stores threshold (see Note #2).     */
+#define  LIB_MEM_CFG_SIMD_NT_THRESHOLD  (4096u * 1024u)
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 SLAB ALLOCATOR CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_SLAB_PAGE_SIZE with the size, in octets, of the pages carved from a
+*               memory segment by a slab allocator. Each page holds blocks of a single size class & MUST be
+*               a power of 2 : pages are aligned on their size so that a block's page is found by masking
+*               its address.
+*
+*           (2) Configure LIB_MEM_CFG_SLAB_ALIGN with the alignment, in octets, of slab blocks; usually the
+*               CPU cache line size. Size classes are multiples of this alignment, from 1 to 32 times.
+*
+*           (3) Configure LIB_MEM_CFG_SLAB_CACHE_BATCH with the number of blocks moved at once between a
+*               slab cache & its slab allocator.
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_MEM_CFG_SLAB_PAGE_SIZE                             /* Cfg slab page size (see Note #1).                    */
+#define  LIB_MEM_CFG_SLAB_PAGE_SIZE      16384u
+#endif
+
+#ifndef  LIB_MEM_CFG_SLAB_ALIGN                                 /* Cfg slab blk align (see Note #2).                    */
+#define  LIB_MEM_CFG_SLAB_ALIGN             64u
+#endif
+
+#ifndef  LIB_MEM_CFG_SLAB_CACHE_BATCH                           /* Cfg slab cache batch size (see Note #3).             */
+#define  LIB_MEM_CFG_SLAB_CACHE_BATCH       16u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  DYNAMIC MEMORY POOL CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN to enable/disable the lock-free free list of
+*               dynamic memory pools. When enabled, blocks are taken from & returned to the free list with
+*               compare-and-swap instead of a critical section; a critical section is only entered to grow
+*               the pool from its memory segment.
+*
+*           (2) Configure LIB_MEM_CFG_DYN_POOL_CACHE_BATCH with the number of blocks moved at once between a
+*               dynamic memory pool cache & its pool.
+*********************************************************************************************************
+*/
+
+                                                                /* Cfg lock-free dyn mem pools [see Note #1] :          */
+#ifndef  LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN
+#define  LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN  DEF_DISABLED
+                                                                /* DEF_DISABLED     Free list protected by crit sect    */
+                                                                /* DEF_ENABLED      Free list updated by CAS            */
+#endif
+
+#ifndef  LIB_MEM_CFG_DYN_POOL_CACHE_BATCH                       /* Cfg dyn mem pool cache batch size (see Note #2).     */
+#define  LIB_MEM_CFG_DYN_POOL_CACHE_BATCH   16u
+#endif
+
+
 /*
 *********************************************************************************************************
 *                          MEMORY ALLOCATION DEBUG INFORMATION CONFIGURATION
@@ -318,6 +418,9 @@ typedef  struct  mem_seg_info {                                 /* -------------
 *                    |        |<-------- (Next block to be freed.)
 *                    \--------/
 *
+*           (2) When external argument checking is enabled, 'BlkAllocTbl' holds one bit per block, set while
+*               the block is allocated. Mem_PoolBlkFree() tests the block's bit to detect a double free in
+*               constant time, instead of searching 'BlkFreeTbl'.
 *********************************************************************************************************
 */
 
@@ -329,6 +432,9 @@ typedef  struct  mem_pool {
     CPU_SIZE_T          BlkSize;                                /* Size  of mem pool   blks (in octets).                */
     void              **BlkFreeTbl;                             /* Tbl of free mem pool blks.                           */
     CPU_SIZE_T          BlkFreeTblIx;                           /* Ix of next free blk free tbl entry.                  */
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    CPU_INT08U         *BlkAllocTbl;                            /* Bitmap of allocated mem pool blks (see Note #2).     */
+#endif
 } MEM_POOL;
 
 
@@ -352,6 +458,15 @@ typedef  struct  mem_pool {
 *                    |          |      |          |       |          |   |          |
 *                    \----------/      \----------/       \----------/   \----------/
 *
+*           (3) With LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN, the head of the free list is a 64-bit word updated by
+*               compare-and-swap. Its low 32 bits hold the offset of the first free block from the base of
+*               the pool's segment, plus 1 (0 for an empty list); its high 32 bits hold a tag incremented
+*               by every update, so that a head popped & pushed back between a task's read & its
+*               compare-and-swap is NOT mistaken for an unchanged list (ABA problem).
+*
+*           (4) A dynamic memory pool cache is a front end owned by a single task. It keeps a private free
+*               list, so that most gets & frees touch neither the pool's free list nor its block count;
+*               blocks move between the cache & the pool LIB_MEM_CFG_DYN_POOL_CACHE_BATCH at a time.
 *********************************************************************************************************
 */
 
@@ -360,7 +475,11 @@ typedef  struct  mem_dyn_pool {                                 /* -------------
            CPU_SIZE_T   BlkSize;                                /* Size of pool blks, in octets.                        */
            CPU_SIZE_T   BlkAlign;                               /* Align req'd for blks, in octets.                     */
            CPU_SIZE_T   BlkPaddingAlign;                        /* Padding alignment in bytes for this mem seg.         */
+#if (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED)
+           CPU_INT64U   BlkFreeTop;                             /* Tagged offset of first free blk (see Note #3).       */
+#else
            void        *BlkFreePtr;                             /* Ptr to first free blk.                               */
+#endif
 
            CPU_SIZE_T   BlkQtyMax;                              /* Max qty of blk in dyn mem pool. 0 = unlimited.       */
            CPU_SIZE_T   BlkAllocCnt;                            /* Cnt of alloc blk.                                    */
@@ -370,6 +489,62 @@ typedef  struct  mem_dyn_pool {                                 /* -------------
 #endif
 } MEM_DYN_POOL;
 
+typedef  struct  mem_dyn_pool_cache {                           /* --------------- DYN MEM POOL CACHE ----------------- */
+           MEM_DYN_POOL  *PoolPtr;                              /* Pool from which blks are taken (see Note #4).        */
+           void          *BlkFreePtr;                           /* Ptr to first free blk.                               */
+           CPU_SIZE_T     BlkFreeCnt;                           /* Nbr of free blks.                                    */
+} MEM_DYN_POOL_CACHE;
+
+
+/*
+*********************************************************************************************************
+*                                    SLAB ALLOCATOR DATA TYPES
+*
+* Note(s) : (1) A slab allocator carves pages of LIB_MEM_CFG_SLAB_PAGE_SIZE octets from a memory segment.
+*               Each page is dedicated to one size class; its first LIB_MEM_CFG_SLAB_ALIGN octets hold the
+*               page header & the rest is split into blocks of the class size :
+*
+*                        Page (aligned on LIB_MEM_CFG_SLAB_PAGE_SIZE)
+*                   /----------------------------------------------------\
+*                   | Header | Blk 0  | Blk 1  |  ...   | Blk N-1 |      |
+*                   \----------------------------------------------------/
+*                       |
+*                       \----> Slab ptr, class ix
+*
+*               Pages are never returned to the segment; a freed block returns to its class' free list.
+*
+*           (2) A slab cache is a front end owned by a single task. It keeps a private free list per class,
+*               so that most allocations & frees do NOT enter a critical section; blocks move between the
+*               cache & the slab allocator LIB_MEM_CFG_SLAB_CACHE_BATCH at a time.
+*********************************************************************************************************
+*/
+
+typedef  struct  mem_slab  MEM_SLAB;
+
+typedef  struct  mem_slab_class {                               /* ------------------ SLAB SIZE CLASS ----------------- */
+           CPU_SIZE_T   BlkSize;                                /* Size of class blks, in octets.                       */
+           void        *BlkFreePtr;                             /* Ptr to first free blk.                               */
+           CPU_SIZE_T   BlkFreeCnt;                             /* Nbr of free blks.                                    */
+           CPU_SIZE_T   BlkUsedCnt;                             /* Nbr of blks alloc'd, incl. blks held in caches.      */
+           CPU_SIZE_T   PageCnt;                                /* Nbr of pages carved for class.                       */
+} MEM_SLAB_CLASS;
+
+struct  mem_slab {                                              /* --------------------- SLAB DATA -------------------- */
+           MEM_SEG         *SegPtr;                             /* Mem seg from which pages are alloc'd.                */
+           MEM_SLAB_CLASS   ClassTbl[LIB_MEM_SLAB_CLASS_NBR];   /* Size classes (see Note #1).                          */
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    const  CPU_CHAR        *NamePtr;                            /* Ptr to slab name.                                    */
+           MEM_SLAB        *NextPtr;                            /* Ptr to next slab, for Mem_OutputUsage().             */
+#endif
+};
+
+typedef  struct  mem_slab_cache {                               /* -------------------- SLAB CACHE -------------------- */
+           MEM_SLAB    *SlabPtr;                                /* Slab from which blks are alloc'd (see Note #2).      */
+           void        *BlkFreePtr[LIB_MEM_SLAB_CLASS_NBR];     /* Ptr to first free blk, per class.                    */
+           CPU_SIZE_T   BlkFreeCnt[LIB_MEM_SLAB_CLASS_NBR];     /* Nbr of free blks, per class.                         */
+} MEM_SLAB_CACHE;
+
 
 /*
 *********************************************************************************************************
@@ -1222,6 +1397,15 @@ CPU_BOOLEAN        Mem_Cmp                  (const  void              *p1_mem,
                                              const  void              *p2_mem,
                                                     CPU_SIZE_T         size);
 
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+CPU_INT32U         Mem_SIMD_FeatGet         (       void);
+
+CPU_INT08U         Mem_SIMD_ImplGet         (       void);
+
+void               Mem_SIMD_ImplSet         (       CPU_INT08U         impl,
+                                                    LIB_ERR           *p_err);
+#endif
+
 
                                                                 /* ----------- MEM HEAP FNCTS (DEPRECATED) ------------ */
 #if (LIB_MEM_CFG_HEAP_SIZE > 0u)
@@ -1324,9 +1508,62 @@ void               Mem_DynPoolBlkFree       (       MEM_DYN_POOL      *p_pool,
                                                     void              *p_blk,
                                                     LIB_ERR           *p_err);
 
+CPU_SIZE_T         Mem_DynPoolBlkGetBulk    (       MEM_DYN_POOL      *p_pool,
+                                                    void             **p_blk_tbl,
+                                                    CPU_SIZE_T         blk_nbr,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_DynPoolBlkFreeBulk   (       MEM_DYN_POOL      *p_pool,
+                                                    void             **p_blk_tbl,
+                                                    CPU_SIZE_T         blk_nbr,
+                                                    LIB_ERR           *p_err);
+
 CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
                                                     LIB_ERR           *p_err);
 
+void               Mem_DynPoolCacheInit     (       MEM_DYN_POOL_CACHE  *p_cache,
+                                                    MEM_DYN_POOL        *p_pool,
+                                                    LIB_ERR             *p_err);
+
+void              *Mem_DynPoolCacheBlkGet   (       MEM_DYN_POOL_CACHE  *p_cache,
+                                                    LIB_ERR             *p_err);
+
+void               Mem_DynPoolCacheBlkFree  (       MEM_DYN_POOL_CACHE  *p_cache,
+                                                    void                *p_blk,
+                                                    LIB_ERR             *p_err);
+
+void               Mem_DynPoolCacheFlush    (       MEM_DYN_POOL_CACHE  *p_cache,
+                                                    LIB_ERR             *p_err);
+
+                                                                /* ------------------ SLAB ALLOC FNCTS ---------------- */
+void               Mem_SlabCreate           (const  CPU_CHAR          *p_name,
+                                                    MEM_SLAB          *p_slab,
+                                                    MEM_SEG           *p_seg,
+                                                    LIB_ERR           *p_err);
+
+void              *Mem_SlabAlloc            (       MEM_SLAB          *p_slab,
+                                                    CPU_SIZE_T         size,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_SlabFree             (       MEM_SLAB          *p_slab,
+                                                    void              *p_blk,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_SlabCacheInit        (       MEM_SLAB_CACHE    *p_cache,
+                                                    MEM_SLAB          *p_slab,
+                                                    LIB_ERR           *p_err);
+
+void              *Mem_SlabCacheAlloc       (       MEM_SLAB_CACHE    *p_cache,
+                                                    CPU_SIZE_T         size,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_SlabCacheFree        (       MEM_SLAB_CACHE    *p_cache,
+                                                    void              *p_blk,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_SlabCacheFlush       (       MEM_SLAB_CACHE    *p_cache,
+                                                    LIB_ERR           *p_err);
+
 
 /*
 *********************************************************************************************************
@@ -1361,6 +1598,49 @@ CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
 #endif
 
 
+#if    ((LIB_MEM_CFG_SLAB_PAGE_SIZE & (LIB_MEM_CFG_SLAB_PAGE_SIZE - 1u)) != 0u)
+#error  "LIB_MEM_CFG_SLAB_PAGE_SIZE   illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  a power of 2]           "
+
+#elif  ((LIB_MEM_CFG_SLAB_ALIGN < 16u) || \
+        ((LIB_MEM_CFG_SLAB_ALIGN & (LIB_MEM_CFG_SLAB_ALIGN - 1u)) != 0u))
+#error  "LIB_MEM_CFG_SLAB_ALIGN       illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  a power of 2 >= 16]     "
+
+#elif   (LIB_MEM_CFG_SLAB_PAGE_SIZE < (64u * LIB_MEM_CFG_SLAB_ALIGN))
+#error  "LIB_MEM_CFG_SLAB_PAGE_SIZE   illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  >= 64 * SLAB_ALIGN]     "
+
+#elif   (LIB_MEM_CFG_SLAB_CACHE_BATCH < 1u)
+#error  "LIB_MEM_CFG_SLAB_CACHE_BATCH illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  >= 1]                   "
+#endif
+
+
+#if    ((LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN illegally #define'd in 'lib_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]      "
+#error  "                                  [     ||  DEF_ENABLED ]      "
+
+#elif   (LIB_MEM_CFG_DYN_POOL_CACHE_BATCH < 1u)
+#error  "LIB_MEM_CFG_DYN_POOL_CACHE_BATCH  illegally #define'd in 'lib_cfg.h'"
+#error  "                                  [MUST be  >= 1]              "
+#endif
+
+
+#if    ((LIB_MEM_CFG_SIMD_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_SIMD_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_SIMD_EN          illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  DEF_DISABLED]           "
+#error  "                             [     ||  DEF_ENABLED ]           "
+
+#elif   (LIB_MEM_CFG_SIMD_NT_THRESHOLD < 4096u)
+#error  "LIB_MEM_CFG_SIMD_NT_THRESHOLD illegally #define'd in 'lib_cfg.h'"
+#error  "                              [MUST be  >= 4096]               "
+#endif
+
+
 #ifndef  LIB_MEM_CFG_HEAP_SIZE
 #error  "LIB_MEM_CFG_HEAP_SIZE              not #define'd in 'lib_cfg.h'"
 #error  "                                   [MUST be  >= 0]             "
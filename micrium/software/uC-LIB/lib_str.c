@@ -72,6 +72,16 @@
 #define    LIB_STR_MODULE
 #include  <lib_str.h>
 
+#if (LIB_STR_CFG_SIMD_EN == DEF_ENABLED)
+#include  <lib_mem.h>
+#if   (defined(_M_IX86)   || defined(_M_X64))
+#include  <intrin.h>
+#include  <immintrin.h>
+#elif (defined(__i386__)  || defined(__x86_64__))
+#include  <immintrin.h>
+#endif
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -79,6 +89,41 @@
 *********************************************************************************************************
 */
 
+#define  STR_FMT_NBR_FAST_FP_MAX_VAL            16777216.0f     /* Max FP nbr to fmt w/ int arithmetic (2^24) ...       */
+#define  STR_FMT_NBR_FAST_FP_MAX_NBR_DIG                11u     /* ... & max nbr digs (see 'Str_FmtNbr_32()  Note #8'). */
+
+#define  STR_PARSE_NBR_FAST_PAGE_SIZE                  4096u    /* Smallest page size (see Str_ParseNbr_Dig4()).        */
+                                                                /* Max nbr to merge 4 more digs into w/o ovf.           */
+#define  STR_PARSE_NBR_FAST_OVF_TH_DEC         ((DEF_INT_32U_MAX_VAL - 9999u) / 10000u)
+#define  STR_PARSE_NBR_FAST_OVF_TH_HEX          (DEF_INT_32U_MAX_VAL >> 16)
+
+                                                                /* Set MSb of each octet in ['lo', 'hi'] of a word ...  */
+                                                                /* ... of 7-bit octets (see Str_ParseNbr_Dig4()).       */
+#define  STR_PARSE_NBR_FAST_IN_RANGE(word, lo, hi)                                                \
+                       ((((0x01010101u * (127u + ((hi) + 1u))) - ((word) & 0x7F7F7F7Fu))     & \
+                          (~(word))                                                          & \
+                         (((word) & 0x7F7F7F7Fu) + (0x01010101u * (127u - ((lo) - 1u))))) & 0x80808080u)
+
+#define  LIB_STR_SIMD_ARCH_NONE                           0u
+#define  LIB_STR_SIMD_ARCH_X86                            1u
+
+#if   (defined(_M_IX86)   || defined(_M_X64) || \
+       defined(__i386__)  || defined(__x86_64__))
+#define  LIB_STR_SIMD_ARCH                      LIB_STR_SIMD_ARCH_X86
+#else
+#define  LIB_STR_SIMD_ARCH                      LIB_STR_SIMD_ARCH_NONE
+#endif
+
+                                                                /* Compile SSE2/AVX2 fncts w/o cfg'ing whole file ...   */
+                                                                /* ... for AVX2 (see 'lib_mem.c  Mem_SIMD_Init()').     */
+#if (defined(__GNUC__) && (LIB_STR_SIMD_ARCH == LIB_STR_SIMD_ARCH_X86))
+#define  LIB_STR_SIMD_TGT(ext)                  __attribute__((target(ext)))
+#else
+#define  LIB_STR_SIMD_TGT(ext)
+#endif
+
+#define  LIB_STR_SIMD_PAGE_SIZE                        4096u    /* Smallest page size (see Str_SIMD_SpanCmp_SSE2()).    */
+
 
 /*
 *********************************************************************************************************
@@ -140,6 +185,33 @@ static  const  CPU_INT32U  Str_MultOvfThTbl_Int32U[] = {
    (CPU_INT32U)(DEF_INT_32U_MAX_VAL / 36u)          /* 32-bit mult ovf th for base 36.  */
 };
 
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+static  const  CPU_CHAR  Str_FmtNbr_Dig2Tbl[] =     /* Dec digs '00' .. '99', two chars per val.            */
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static  const  CPU_INT32U  Str_FmtNbr_Pwr10Tbl[] = {
+    1u,
+    10u,
+    100u,
+    1000u,
+    10000u,
+    100000u,
+    1000000u,
+    10000000u,
+    100000000u,
+    1000000000u
+};
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -147,6 +219,10 @@ static  const  CPU_INT32U  Str_MultOvfThTbl_Int32U[] = {
 *********************************************************************************************************
 */
 
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  Str_FmtNbr_FastEn = DEF_ENABLED;           /* Fast nbr fmt en'd (see Str_FmtNbr_FastSet()).        */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -163,12 +239,69 @@ static  CPU_CHAR    *Str_FmtNbr_Int32  (       CPU_INT32U     nbr,
                                                CPU_BOOLEAN    nul,
                                                CPU_CHAR      *pstr);
 
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+static  CPU_INT08U   Str_FmtNbr_DecDigCnt(     CPU_INT32U     nbr);
+
+static  void         Str_FmtNbr_Dec    (       CPU_INT32U     nbr,
+                                               CPU_INT08U     nbr_dig,
+                                               CPU_CHAR      *pstr);
+#endif
+
 static  CPU_INT32U   Str_ParseNbr_Int32(const  CPU_CHAR      *pstr,
                                                CPU_CHAR     **pstr_next,
                                                CPU_INT08U     nbr_base,
                                                CPU_BOOLEAN    nbr_signed,
                                                CPU_BOOLEAN   *pnbr_neg);
 
+#if (LIB_STR_CFG_PARSE_FAST_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  Str_ParseNbr_Dig4 (const  CPU_CHAR      *pstr,
+                                               CPU_INT08U     nbr_base,
+                                               CPU_INT32U    *pnbr);
+#endif
+
+#if (LIB_STR_CFG_SIMD_EN == DEF_ENABLED)
+static  CPU_SIZE_T   Str_SIMD_Span     (const  CPU_CHAR      *pstr,
+                                               CPU_SIZE_T     len_max,
+                                               CPU_CHAR       srch_char);
+
+static  CPU_SIZE_T   Str_SIMD_SpanCmp  (const  CPU_CHAR      *p1_str,
+                                        const  CPU_CHAR      *p2_str,
+                                               CPU_SIZE_T     len_max);
+
+static  CPU_SIZE_T   Str_SIMD_Srch     (const  CPU_CHAR      *pstr,
+                                               CPU_SIZE_T     srch_len,
+                                        const  CPU_CHAR      *pstr_srch,
+                                               CPU_SIZE_T     len_srch);
+
+#if (LIB_STR_SIMD_ARCH == LIB_STR_SIMD_ARCH_X86)
+static  CPU_SIZE_T   Str_SIMD_Span_SSE2    (const  CPU_CHAR      *pstr,
+                                                   CPU_SIZE_T     len_max,
+                                                   CPU_CHAR       srch_char);
+
+static  CPU_SIZE_T   Str_SIMD_Span_AVX2    (const  CPU_CHAR      *pstr,
+                                                   CPU_SIZE_T     len_max,
+                                                   CPU_CHAR       srch_char);
+
+static  CPU_SIZE_T   Str_SIMD_SpanCmp_SSE2 (const  CPU_CHAR      *p1_str,
+                                            const  CPU_CHAR      *p2_str,
+                                                   CPU_SIZE_T     len_max);
+
+static  CPU_SIZE_T   Str_SIMD_SpanCmp_AVX2 (const  CPU_CHAR      *p1_str,
+                                            const  CPU_CHAR      *p2_str,
+                                                   CPU_SIZE_T     len_max);
+
+static  CPU_SIZE_T   Str_SIMD_Srch_SSE2    (const  CPU_CHAR      *pstr,
+                                                   CPU_SIZE_T     srch_len,
+                                            const  CPU_CHAR      *pstr_srch,
+                                                   CPU_SIZE_T     len_srch);
+
+static  CPU_SIZE_T   Str_SIMD_Srch_AVX2    (const  CPU_CHAR      *pstr,
+                                                   CPU_SIZE_T     srch_len,
+                                            const  CPU_CHAR      *pstr_srch,
+                                                   CPU_SIZE_T     len_srch);
+#endif
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -176,6 +309,14 @@ static  CPU_INT32U   Str_ParseNbr_Int32(const  CPU_CHAR      *pstr,
 *********************************************************************************************************
 */
 
+#if ((LIB_STR_CFG_SIMD_EN == DEF_ENABLED) && \
+     (LIB_MEM_CFG_SIMD_EN != DEF_ENABLED))
+#error  "LIB_STR_CFG_SIMD_EN             illegally #define'd in 'lib_cfg.h'"
+#error  "                                [MUST be  DEF_DISABLED     ]       "
+#error  "                                [     ||  LIB_MEM_CFG_SIMD_EN]     "
+#error  "                                [     ==  DEF_ENABLED      ]       "
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -272,6 +413,10 @@ CPU_SIZE_T  Str_Len (const  CPU_CHAR  *pstr)
 *
 *                   (c) 'len_max' number of characters searched.
 *                       (1) 'len_max' number of characters does NOT include the terminating NULL character.
+*
+*               (4) If SIMD string functions are enabled (see 'lib_str.h  STRING SIMD CONFIGURATION'), the
+*                   characters before the terminating NULL character are first skipped with vector
+*                   compares; the remaining characters, if any, are then searched one at a time.
 *********************************************************************************************************
 */
 
@@ -284,9 +429,15 @@ CPU_SIZE_T  Str_Len_N (const  CPU_CHAR    *pstr,
 
     pstr_len = pstr;
     len      = 0u;
+#if (LIB_STR_CFG_SIMD_EN == DEF_ENABLED)
+    if (pstr_len != (const CPU_CHAR *)0) {                      /* Skip non-NULL chars w/ vectors (see Note #4).        */
+        len       = Str_SIMD_Span(pstr_len, len_max, (CPU_CHAR)'\0');
+        pstr_len += len;
+    }
+#endif
     while (( pstr_len != (const CPU_CHAR *)  0 ) &&             /* Calc str len until NULL ptr (see Note #3a) ...       */
-           (*pstr_len != (      CPU_CHAR  )'\0') &&             /* ... or NULL char found      (see Note #3b) ...       */
-           ( len      <  (      CPU_SIZE_T)len_max)) {          /* ... or max nbr chars srch'd (see Note #3c).          */
+           ( len      <  (      CPU_SIZE_T)len_max) &&          /* ... or max nbr chars srch'd (see Note #3c), ...      */
+           (*pstr_len != (      CPU_CHAR  )'\0')) {             /* ... chk'd before rd'ing char, or NULL char found.    */
         pstr_len++;
         len++;
     }
@@ -851,6 +1002,10 @@ CPU_INT16S  Str_Cmp (const  CPU_CHAR  *p1_str,
 *
 *               (4) Since 16-bit signed arithmetic is performed to calculate a non-identical comparison
 *                   return value, 'CPU_CHAR' native data type size MUST be 8-bit.
+*
+*               (5) If SIMD string functions are enabled (see 'lib_str.h  STRING SIMD CONFIGURATION'), the
+*                   identical, non-NULL characters are first skipped with vector compares; the strings
+*                   are then compared one character at a time from the first difference, if any.
 *********************************************************************************************************
 */
 
@@ -890,12 +1045,19 @@ CPU_INT16S  Str_Cmp_N (const  CPU_CHAR    *p1_str,
     p1_str_cmp_next++;
     p2_str_cmp_next++;
     cmp_len         = 0u;
+#if (LIB_STR_CFG_SIMD_EN == DEF_ENABLED)                        /* Skip identical chars w/ vectors (see Note #5).       */
+    cmp_len          = Str_SIMD_SpanCmp(p1_str, p2_str, len_max);
+    p1_str_cmp      += cmp_len;
+    p2_str_cmp      += cmp_len;
+    p1_str_cmp_next += cmp_len;
+    p2_str_cmp_next += cmp_len;
+#endif
 
-    while ((*p1_str_cmp      == *p2_str_cmp)            &&      /* Cmp strs until non-matching chars (see Note #3c) ... */
+    while (( cmp_len         <  (      CPU_SIZE_T)len_max) &&   /* Cmp strs until max nbr chars cmp'd (see Note #3d2),  */
+           (*p1_str_cmp      == *p2_str_cmp)            &&      /* ... or non-matching chars      (see Note #3c) ...    */
            (*p1_str_cmp      != (      CPU_CHAR  )'\0') &&      /* ... or NULL chars                 (see Note #3b) ... */
            ( p1_str_cmp_next != (const CPU_CHAR *)  0 ) &&      /* ... or NULL ptr(s) found          (see Note #3a2).   */
-           ( p2_str_cmp_next != (const CPU_CHAR *)  0 ) &&
-           ( cmp_len         <  (      CPU_SIZE_T)len_max)) {   /* ... or max nbr chars cmp'd        (see Note #3d2).   */
+           ( p2_str_cmp_next != (const CPU_CHAR *)  0 )) {
         p1_str_cmp++;
         p2_str_cmp++;
         p1_str_cmp_next++;
@@ -1172,18 +1334,20 @@ CPU_INT16S  Str_CmpIgnoreCase_N (const  CPU_CHAR    *p1_str,
     char_2          = ASCII_ToLower(*p2_str_cmp);
     cmp_len         = 0u;
 
-    while (( char_1          ==  char_2)                &&      /* Cmp strs until non-matching chars (see Note #3c) ... */
+    while (( cmp_len         <  (      CPU_SIZE_T)len_max) &&   /* Cmp strs until max nbr chars cmp'd (see Note #3d2),  */
+           ( char_1          ==  char_2)                &&      /* ... or non-matching chars      (see Note #3c) ...    */
            (*p1_str_cmp      != (      CPU_CHAR  )'\0') &&      /* ... or NULL chars                 (see Note #3b) ... */
            ( p1_str_cmp_next != (const CPU_CHAR *)  0 ) &&      /* ... or NULL ptr(s) found          (see Note #3a2).   */
-           ( p2_str_cmp_next != (const CPU_CHAR *)  0 ) &&
-           ( cmp_len         <  (      CPU_SIZE_T)len_max)) {   /* ... or max nbr chars cmp'd        (see Note #3d2).   */
+           ( p2_str_cmp_next != (const CPU_CHAR *)  0 )) {
         p1_str_cmp++;
         p2_str_cmp++;
         p1_str_cmp_next++;
         p2_str_cmp_next++;
         cmp_len++;
-        char_1 = ASCII_ToLower(*p1_str_cmp);
-        char_2 = ASCII_ToLower(*p2_str_cmp);
+        if (cmp_len < len_max) {                                /* Rd next chars only within max nbr of chars.          */
+            char_1 = ASCII_ToLower(*p1_str_cmp);
+            char_2 = ASCII_ToLower(*p2_str_cmp);
+        }
     }
 
 
@@ -1347,6 +1511,10 @@ CPU_CHAR  *Str_Char (const  CPU_CHAR  *pstr,
 *                           of characters; NULL pointer returned.
 *                       (2) 'len_max' number of characters MAY include terminating NULL character
 *                           (see Note #2a2).
+*
+*               (4) If SIMD string functions are enabled (see 'lib_str.h  STRING SIMD CONFIGURATION'), the
+*                   characters before the first search or NULL character are first skipped with vector
+*                   compares.
 *********************************************************************************************************
 */
 
@@ -1369,11 +1537,15 @@ CPU_CHAR  *Str_Char_N (const  CPU_CHAR    *pstr,
 
     pstr_char = pstr;
     len_srch  = 0u;
+#if (LIB_STR_CFG_SIMD_EN == DEF_ENABLED)                        /* Skip other chars w/ vectors (see Note #4).           */
+    len_srch   = Str_SIMD_Span(pstr_char, len_max, srch_char);
+    pstr_char += len_srch;
+#endif
 
     while (( pstr_char != (const CPU_CHAR *)  0 )      &&       /* Srch str until NULL ptr     [see Note #3b]  ...      */
-           (*pstr_char != (      CPU_CHAR  )'\0')      &&       /* ... or NULL char            (see Note #3c)  ...      */
-           (*pstr_char != (      CPU_CHAR  )srch_char) &&       /* ... or srch char found      (see Note #3d); ...      */
-           ( len_srch  <  (      CPU_SIZE_T)len_max)) {         /* ... or max nbr chars srch'd (see Note #3e).          */
+           ( len_srch  <  (      CPU_SIZE_T)len_max)   &&       /* ... or max nbr chars srch'd (see Note #3e), ...      */
+           (*pstr_char != (      CPU_CHAR  )'\0')      &&       /* ... chk'd before rd'ing char, or NULL char  ...      */
+           (*pstr_char != (      CPU_CHAR  )srch_char)) {       /* ... (see Note #3c) or srch char found (Note #3d).    */
         pstr_char++;
         len_srch++;
     }
@@ -1846,6 +2018,10 @@ CPU_CHAR  *Str_Str (const  CPU_CHAR  *pstr,
 *                   (g) 'len_max' number of characters searched.
 *                       (1) 'len_max' number of characters does NOT include terminating NULL character
 *                           (see Note #2a2).
+*
+*               (4) If SIMD string functions are enabled (see 'lib_str.h  STRING SIMD CONFIGURATION'),
+*                   positions are first filtered with vector compares of the search string's first & last
+*                   characters; only the positions where both match are compared in full.
 *********************************************************************************************************
 */
 
@@ -1900,6 +2076,12 @@ CPU_CHAR  *Str_Str_N (const  CPU_CHAR    *pstr,
 
     srch_len  = str_len - str_len_srch;                         /* Calc srch len (see Note #3e2).                       */
     srch_ix   = 0u;
+#if (LIB_STR_CFG_SIMD_EN == DEF_ENABLED)                        /* Filter srch positions w/ vectors (see Note #4).      */
+    srch_ix   = Str_SIMD_Srch(pstr, srch_len, pstr_srch, str_len_srch);
+    if (srch_ix > srch_len) {                                   /* Rtn NULL if ALL positions filtered (see Note #3e).   */
+        return ((CPU_CHAR *)0);
+    }
+#endif
 
     do {
         pstr_srch_ix = (const CPU_CHAR *)(pstr + srch_ix);
@@ -2567,6 +2749,19 @@ CPU_CHAR  *Str_FmtNbr_Int32S (CPU_INT32S    nbr,
 *                                           {        'nbr_dp'               +        'nbr_dp'  > 0
 *                                           {         1 (for decimal point) ]
 *
+*               (8) If the fast number format is enabled (see 'lib_str.h  STRING NUMBER FORMAT CONFIGURATION
+*                   Note #1b'), the integer part of numbers less than 2^24 formatted with at most 11 digits
+*                   is formatted with integer arithmetic :
+*
+*                   (a) Each integer digit is otherwise formatted from the truncated floating point quotient
+*                       of the number by a power of 10.  For numbers less than 2^24, this quotient is less
+*                       than one unit in the last place away from the next integer & so can NOT round up to
+*                       it; the truncated quotient is the integer quotient of the number's integer part.
+*
+*                   (b) Powers of 10 up to 10^10 are exact 32-bit floating point numbers; for more digits,
+*                       the rounded powers of 10 require the floating point format.
+*
+*                   Decimal point digits are always formatted with the floating point multiplications.
 *********************************************************************************************************
 */
 
@@ -2596,6 +2791,11 @@ CPU_CHAR  *Str_FmtNbr_32 (CPU_FP32      nbr,
     CPU_BOOLEAN   print_char;
     CPU_BOOLEAN   nbr_neg;
     CPU_BOOLEAN   nbr_neg_fmtd   = DEF_NO;
+    CPU_BOOLEAN   fmt_fast;
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+    CPU_INT32U    nbr_int        = 0u;
+    CPU_INT16U    nbr_dig_int;
+#endif
 
 
                                                                 /* ---------------- VALIDATE FMT ARGS ----------------- */
@@ -2605,6 +2805,7 @@ CPU_CHAR  *Str_FmtNbr_32 (CPU_FP32      nbr,
 
     dig_exp     =  1.0f;
     fmt_invalid =  DEF_NO;
+    fmt_fast    =  DEF_NO;
     lead_char_0 = (lead_char == '0') ? DEF_YES : DEF_NO;        /* Chk if lead char a '0' dig (see Note #3b2).          */
     nbr_fmt     =  0.0f;
     nbr_neg     =  DEF_NO;
@@ -2641,11 +2842,23 @@ CPU_CHAR  *Str_FmtNbr_32 (CPU_FP32      nbr,
             nbr_neg      =  DEF_NO;
         }
 
-        nbr_log     = nbr_fmt;
-        nbr_dig_max = 0u;
-        while (nbr_log >= 1.0f) {                               /* While base-10 digs avail, ...                        */
-            nbr_dig_max++;                                      /* ... calc max nbr digs.                               */
-            nbr_log /= 10.0f;
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+        if ((Str_FmtNbr_FastEn == DEF_ENABLED)                   &&
+            (nbr_fmt           <  STR_FMT_NBR_FAST_FP_MAX_VAL)   &&
+            (nbr_dig           <= STR_FMT_NBR_FAST_FP_MAX_NBR_DIG)) {
+            fmt_fast    =  DEF_YES;                             /* Fmt int part w/ int arithmetic (see Note #8).        */
+            nbr_int     = (CPU_INT32U)nbr_fmt;
+            nbr_dig_max = (nbr_int > 0u) ? Str_FmtNbr_DecDigCnt(nbr_int) : 0u;
+        }
+#endif
+
+        if (fmt_fast == DEF_NO) {
+            nbr_log     = nbr_fmt;
+            nbr_dig_max = 0u;
+            while (nbr_log >= 1.0f) {                           /* While base-10 digs avail, ...                        */
+                nbr_dig_max++;                                  /* ... calc max nbr digs.                               */
+                nbr_log /= 10.0f;
+            }
         }
 
         if (((nbr_dig >= (nbr_dig_max + nbr_neg_sign)) ||       /* If req'd nbr digs >= (max nbr digs + neg sign)    .. */
@@ -2654,8 +2867,10 @@ CPU_CHAR  *Str_FmtNbr_32 (CPU_FP32      nbr,
              (nbr_dp      > 0) ||                               /* ..          (req'd nbr dp  = 0) AND               .. */
              (nbr_neg == DEF_NO))) {                            /* ..          (      nbr neg    )]   (see Note #2b3).  */
                                                                 /* .. prepare nbr digs to fmt.                          */
-            for (i = 1u; i < nbr_dig; i++) {
-                dig_exp *= 10.0f;
+            if (fmt_fast == DEF_NO) {
+                for (i = 1u; i < nbr_dig; i++) {
+                    dig_exp *= 10.0f;
+                }
             }
 
             nbr_neg_fmtd   =  DEF_NO;
@@ -2668,7 +2883,54 @@ CPU_CHAR  *Str_FmtNbr_32 (CPU_FP32      nbr,
 
 
                                                                 /* ------------------- FMT NBR STR -------------------- */
-    for (i = nbr_dig; i > 0; i--) {                             /* Fmt str for desired nbr digs :                       */
+    i = nbr_dig;
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+    if ((fmt_invalid == DEF_NO ) &&                             /* If fast fmt (see Note #8), ...                       */
+        (fmt_fast    == DEF_YES) &&
+        (nbr_dig     >  0u)) {
+        nbr_dig_int = (nbr_dig_max > 0u) ? nbr_dig_max : 1u;
+        for (; i > nbr_dig_int; i--) {                          /* ... fmt lead chars &/or neg sign;            ...     */
+            if ((nbr_neg      == DEF_YES) &&
+                (lead_char_0  == DEF_YES) &&
+                (nbr_neg_fmtd == DEF_NO )) {
+               *pstr_fmt++   = '-';                             /* ... prepend neg sign (see Note #3b);         ...     */
+                nbr_neg_fmtd = DEF_YES;
+
+            } else if (lead_char != (CPU_CHAR)'\0') {
+               *pstr_fmt++     = lead_char;
+                lead_char_fmtd = DEF_YES;
+            }
+        }
+
+        if ((nbr_neg      == DEF_YES) &&                        /* ... prepend neg sign if NOT yet fmt'd        ...     */
+            (nbr_neg_fmtd == DEF_NO )) {
+            if (lead_char_fmtd == DEF_YES) {                    /* ... in place of last lead char (see Note #2b);...    */
+                pstr_fmt--;
+            }
+           *pstr_fmt++   = '-';
+            nbr_neg_fmtd = DEF_YES;
+        }
+
+        if (nbr_dig_max > 0u) {                                 /* ... fmt sig int digs                         ...     */
+            nbr_dig_sig = DEF_MIN(nbr_dig_max, LIB_STR_CFG_FP_MAX_NBR_DIG_SIG);
+            Str_FmtNbr_Dec(nbr_int / Str_FmtNbr_Pwr10Tbl[nbr_dig_max - nbr_dig_sig],
+                           (CPU_INT08U)nbr_dig_sig,
+                           pstr_fmt);
+            pstr_fmt += nbr_dig_sig;
+            for (i = nbr_dig_sig; i < nbr_dig_max; i++) {       /* ... & non-sig 0's (see Note #2c2);           ...     */
+               *pstr_fmt++ = '0';
+            }
+
+        } else if ((nbr_dig > 1) ||                             /* ... else fmt one '0' char (see Note #3c5).           */
+                   (nbr_neg == DEF_NO)) {
+           *pstr_fmt++ = '0';
+        }
+
+        i = 0u;
+    }
+#endif
+
+    for (; i > 0; i--) {                                        /* Fmt str for desired nbr digs :                       */
         if (fmt_invalid == DEF_NO) {
             if (nbr_dig_sig < LIB_STR_CFG_FP_MAX_NBR_DIG_SIG) { /* If nbr sig digs < max, fmt str digs;           ...   */
                 nbr_shiftd = (CPU_INT32U)(nbr_fmt / dig_exp);
@@ -2781,6 +3043,63 @@ CPU_CHAR  *Str_FmtNbr_32 (CPU_FP32      nbr,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                        Str_FmtNbr_FastGet()
+*
+* Description : Get whether the fast number format is used.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_ENABLED,  if the fast     number format is used.
+*
+*               DEF_DISABLED, if the portable number format is used.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+CPU_BOOLEAN  Str_FmtNbr_FastGet (void)
+{
+    return (Str_FmtNbr_FastEn);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Str_FmtNbr_FastSet()
+*
+* Description : Enable or disable the fast number format.
+*
+* Argument(s) : en          Number format :
+*
+*                               DEF_ENABLED         Fast     number format (default).
+*                               DEF_DISABLED        Portable number format.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Both formats produce identical strings (see 'lib_str.h  STRING NUMBER FORMAT
+*                   CONFIGURATION  Note #1'); the portable format is kept to compare their performance.
+*
+*               (2) The format MAY be changed while other tasks format numbers; each number is formatted
+*                   in a single format.
+*********************************************************************************************************
+*/
+
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+void  Str_FmtNbr_FastSet (CPU_BOOLEAN  en)
+{
+    Str_FmtNbr_FastEn = (en == DEF_DISABLED) ? DEF_DISABLED : DEF_ENABLED;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        Str_ParseNbr_Int32U()
@@ -3218,6 +3537,240 @@ CPU_INT32S  Str_ParseNbr_Int32S (const  CPU_CHAR     *pstr,
 }
 
 
+/*
+*********************************************************************************************************
+*                                      Str_ParseNbrTbl_Int32U()
+*
+* Description : Parse a table of 32-bit unsigned integers from a delimited string.
+*
+* Argument(s) : pstr            Pointer to string (see Note #1).
+*
+*               pstr_next       Optional pointer to a variable to return a pointer to the first character
+*                                   NOT parsed (see Note #2).
+*
+*               nbr_base        Base of numbers to parse (see 'Str_ParseNbr_Int32U()  Note #2a1B1').
+*
+*               delim_char      Delimiter character between numbers, or the NULL character for white-space
+*                                   delimited numbers only (see Note #1b).
+*
+*               pnbr_tbl        Pointer to table to receive the parsed numbers.
+*
+*               nbr_tbl_size    Maximum number of numbers to parse.
+*
+* Return(s)   : Number of numbers parsed into the table.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) (a) Each number is parsed as by Str_ParseNbr_Int32U(), with the same overflow
+*                       handling, & so MAY be preceded by white-space characters.
+*
+*                   (b) Each number MAY be followed by white-space characters, then by at most one
+*                       delimiter character.  White-space delimiter characters are merged with any
+*                       surrounding white-space characters.
+*
+*               (2) String parse terminates when :
+*
+*                   (a) The table is full; 'pstr_next' points to the first character following the last
+*                       number's delimiter, where the parse MAY be resumed.
+*
+*                   (b) No number can be parsed; 'pstr_next' points to the first character following the
+*                       last number's delimiter, i.e. to the terminating NULL character or to an invalid
+*                       character (see 'Str_ParseNbr_Int32U()  Note #2a2A').
+*
+*                   (c) A NULL pointer is passed; 'pstr_next' points to 'pstr' & 0 is returned.
+*
+*                   Example :
+*
+*                           pstr       = "  10, 20,30 ;x"
+*                           nbr_base   = 10
+*                           delim_char = ','
+*
+*                           pnbr_tbl   = { 10, 20, 30 }
+*                           return     = 3
+*                           pstr_next  = ";x"
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  Str_ParseNbrTbl_Int32U (const  CPU_CHAR     *pstr,
+                                           CPU_CHAR    **pstr_next,
+                                           CPU_INT08U    nbr_base,
+                                           CPU_CHAR      delim_char,
+                                           CPU_INT32U   *pnbr_tbl,
+                                           CPU_SIZE_T    nbr_tbl_size)
+{
+    const  CPU_CHAR     *pstr_parse;
+           CPU_CHAR     *pstr_parse_next;
+           CPU_CHAR     *pstr_parse_unused;
+           CPU_INT32U    nbr;
+           CPU_SIZE_T    nbr_ix;
+           CPU_BOOLEAN   whitespace;
+           CPU_BOOLEAN   done;
+
+
+    if (pstr_next == (CPU_CHAR **) 0) {                         /* If NOT avail, ...                                    */
+        pstr_next  = (CPU_CHAR **)&pstr_parse_unused;           /* ... re-cfg NULL rtn ptr to unused local var.         */
+       (void)&pstr_parse_unused;                                /* Prevent possible 'variable unused' warning.          */
+    }
+   *pstr_next = (CPU_CHAR *)pstr;                               /* Init rtn str for err.                                */
+
+    if (pstr == (const CPU_CHAR *)0) {                          /* Rtn zero if str ptr NULL (see Note #2c).             */
+        return (0u);
+    }
+    if (pnbr_tbl == (CPU_INT32U *)0) {                          /* Rtn zero if tbl ptr NULL (see Note #2c).             */
+        return (0u);
+    }
+
+
+    pstr_parse = pstr;
+    nbr_ix     = 0u;
+    done       = DEF_NO;
+
+    while ((done   == DEF_NO) &&                                /* Parse nbrs until tbl full (see Note #2a) ...         */
+           (nbr_ix <  nbr_tbl_size)) {
+        nbr = Str_ParseNbr_Int32U(pstr_parse, &pstr_parse_next, nbr_base);
+        if (pstr_parse_next == pstr_parse) {                    /* ... or NO nbr parsed      (see Note #2b).            */
+            done = DEF_YES;
+
+        } else {
+            pnbr_tbl[nbr_ix] = nbr;
+            nbr_ix++;
+            pstr_parse       = pstr_parse_next;
+
+            whitespace = ASCII_IsSpace(*pstr_parse);
+            while (whitespace == DEF_YES) {                     /* Ignore trailing white-space char(s) ...              */
+                pstr_parse++;
+                whitespace = ASCII_IsSpace(*pstr_parse);
+            }
+            if (( delim_char  != (CPU_CHAR)'\0') &&             /* ... & delim char          (see Note #1b).            */
+                (*pstr_parse  ==  delim_char)) {
+                pstr_parse++;
+            }
+        }
+    }
+
+   *pstr_next = (CPU_CHAR *)pstr_parse;
+
+    return (nbr_ix);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      Str_ParseNbrTbl_Int32S()
+*
+* Description : Parse a table of 32-bit signed integers from a delimited string.
+*
+* Argument(s) : pstr            Pointer to string (see Note #1).
+*
+*               pstr_next       Optional pointer to a variable to return a pointer to the first character
+*                                   NOT parsed (see Note #2).
+*
+*               nbr_base        Base of numbers to parse (see 'Str_ParseNbr_Int32S()  Note #2a1B1').
+*
+*               delim_char      Delimiter character between numbers, or the NULL character for white-space
+*                                   delimited numbers only (see Note #1b).
+*
+*               pnbr_tbl        Pointer to table to receive the parsed numbers.
+*
+*               nbr_tbl_size    Maximum number of numbers to parse.
+*
+* Return(s)   : Number of numbers parsed into the table.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) (a) Each number is parsed as by Str_ParseNbr_Int32S(), with the same overflow
+*                       handling, & so MAY be preceded by white-space characters.
+*
+*                   (b) Each number MAY be followed by white-space characters, then by at most one
+*                       delimiter character.  White-space delimiter characters are merged with any
+*                       surrounding white-space characters.
+*
+*               (2) String parse terminates when :
+*
+*                   (a) The table is full; 'pstr_next' points to the first character following the last
+*                       number's delimiter, where the parse MAY be resumed.
+*
+*                   (b) No number can be parsed; 'pstr_next' points to the first character following the
+*                       last number's delimiter, i.e. to the terminating NULL character or to an invalid
+*                       character (see 'Str_ParseNbr_Int32S()  Note #2a2A').
+*
+*                   (c) A NULL pointer is passed; 'pstr_next' points to 'pstr' & 0 is returned.
+*
+*                   Example :
+*
+*                           pstr       = "  10, 20,30 ;x"
+*                           nbr_base   = 10
+*                           delim_char = ','
+*
+*                           pnbr_tbl   = { 10, 20, 30 }
+*                           return     = 3
+*                           pstr_next  = ";x"
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  Str_ParseNbrTbl_Int32S (const  CPU_CHAR     *pstr,
+                                           CPU_CHAR    **pstr_next,
+                                           CPU_INT08U    nbr_base,
+                                           CPU_CHAR      delim_char,
+                                           CPU_INT32S   *pnbr_tbl,
+                                           CPU_SIZE_T    nbr_tbl_size)
+{
+    const  CPU_CHAR     *pstr_parse;
+           CPU_CHAR     *pstr_parse_next;
+           CPU_CHAR     *pstr_parse_unused;
+           CPU_INT32S    nbr;
+           CPU_SIZE_T    nbr_ix;
+           CPU_BOOLEAN   whitespace;
+           CPU_BOOLEAN   done;
+
+
+    if (pstr_next == (CPU_CHAR **) 0) {                         /* If NOT avail, ...                                    */
+        pstr_next  = (CPU_CHAR **)&pstr_parse_unused;           /* ... re-cfg NULL rtn ptr to unused local var.         */
+       (void)&pstr_parse_unused;                                /* Prevent possible 'variable unused' warning.          */
+    }
+   *pstr_next = (CPU_CHAR *)pstr;                               /* Init rtn str for err.                                */
+
+    if (pstr == (const CPU_CHAR *)0) {                          /* Rtn zero if str ptr NULL (see Note #2c).             */
+        return (0u);
+    }
+    if (pnbr_tbl == (CPU_INT32S *)0) {                          /* Rtn zero if tbl ptr NULL (see Note #2c).             */
+        return (0u);
+    }
+
+
+    pstr_parse = pstr;
+    nbr_ix     = 0u;
+    done       = DEF_NO;
+
+    while ((done   == DEF_NO) &&                                /* Parse nbrs until tbl full (see Note #2a) ...         */
+           (nbr_ix <  nbr_tbl_size)) {
+        nbr = Str_ParseNbr_Int32S(pstr_parse, &pstr_parse_next, nbr_base);
+        if (pstr_parse_next == pstr_parse) {                    /* ... or NO nbr parsed      (see Note #2b).            */
+            done = DEF_YES;
+
+        } else {
+            pnbr_tbl[nbr_ix] = nbr;
+            nbr_ix++;
+            pstr_parse       = pstr_parse_next;
+
+            whitespace = ASCII_IsSpace(*pstr_parse);
+            while (whitespace == DEF_YES) {                     /* Ignore trailing white-space char(s) ...              */
+                pstr_parse++;
+                whitespace = ASCII_IsSpace(*pstr_parse);
+            }
+            if (( delim_char  != (CPU_CHAR)'\0') &&             /* ... & delim char          (see Note #1b).            */
+                (*pstr_parse  ==  delim_char)) {
+                pstr_parse++;
+            }
+        }
+    }
+
+   *pstr_next = (CPU_CHAR *)pstr_parse;
+
+    return (nbr_ix);
+}
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -3443,6 +3996,9 @@ CPU_INT32S  Str_ParseNbr_Int32S (const  CPU_CHAR     *pstr,
 *                          number of     =  {
 *                       question marks      {  (b)  'nbr_dig'         ,  if 'nbr_dig' > 0
 *
+*               (8) If the fast number format is enabled (see 'lib_str.h  STRING NUMBER FORMAT CONFIGURATION
+*                   Note #1a'), base-10 digits are counted by comparison with powers of 10 & formatted two at
+*                   a time; the lead characters & negative sign are then formatted as for other bases.
 *********************************************************************************************************
 */
 
@@ -3472,6 +4028,9 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
     CPU_BOOLEAN   fmt_valid          = DEF_YES;
     CPU_BOOLEAN   print_char;
     CPU_BOOLEAN   nbr_neg_fmtd       = DEF_NO;
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+    CPU_BOOLEAN   fmt_fast;
+#endif
 
 
                                                                 /* ---------------- VALIDATE FMT ARGS ----------------- */
@@ -3479,6 +4038,11 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
         return ((CPU_CHAR *)0);
     }
 
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+    fmt_fast = ((Str_FmtNbr_FastEn == DEF_ENABLED) &&           /* Fmt dec digs w/ dig tbl (see Note #8).               */
+                (nbr_base          ==         10u)) ? DEF_YES : DEF_NO;
+#endif
+
     if (nbr_dig < 1) {                                          /* If nbr digs = 0, ...                                 */
         fmt_valid = DEF_NO;                                     /* ... fmt valid str (see Note #6b).                    */
     }
@@ -3518,11 +4082,18 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
 
     if (fmt_valid == DEF_YES) {
         nbr_fmt     = nbr;
-        nbr_log     = nbr;
-        nbr_dig_max = 1u;
-        while (nbr_log >= nbr_base) {                           /* While nbr base digs avail, ...                       */
-            nbr_dig_max++;                                      /* ... calc max nbr digs.                               */
-            nbr_log /= nbr_base;
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+        if (fmt_fast == DEF_YES) {
+            nbr_dig_max = Str_FmtNbr_DecDigCnt(nbr);
+        } else
+#endif
+        {
+            nbr_log     = nbr;
+            nbr_dig_max = 1u;
+            while (nbr_log >= nbr_base) {                       /* While nbr base digs avail, ...                       */
+                nbr_dig_max++;                                  /* ... calc max nbr digs.                               */
+                nbr_log /= nbr_base;
+            }
         }
 
         nbr_neg_sign = (nbr_neg == DEF_YES) ? 1u : 0u;
@@ -3562,8 +4133,18 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
     }
     pstr_fmt--;
 
+    i = 0u;
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+    if ((fmt_valid == DEF_YES) &&                               /* If fast fmt, fmt all nbr digs (see Note #8) ...      */
+        (fmt_fast  == DEF_YES)) {
+        pstr_fmt -= nbr_dig_max;
+        Str_FmtNbr_Dec(nbr_fmt, nbr_dig_max, pstr_fmt + 1);
+        nbr_fmt   = 0u;                                         /* ... & fmt lead chars & neg sign below.               */
+        i         = nbr_dig_max;
+    }
+#endif
 
-    for (i = 0u; i < nbr_dig_fmtd; i++) {                       /* Fmt str for desired nbr digs :                       */
+    for (; i < nbr_dig_fmtd; i++) {                             /* Fmt str for desired nbr digs :                       */
         if (fmt_valid == DEF_YES) {
             if ((nbr_fmt > 0) ||                                /* If fmt nbr > 0                               ...     */
                 (i == 0u)) {                                    /* ... OR on one's  dig to fmt (see Note #3c1), ...     */
@@ -3611,36 +4192,122 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
 
 /*
 *********************************************************************************************************
-*                                        Str_ParseNbr_Int32()
+*                                       Str_FmtNbr_DecDigCnt()
 *
-* Description : Parse 32-bit integer from string.
+* Description : Count decimal digits of a 32-bit unsigned integer.
 *
-* Argument(s) : pstr            Pointer to string (see Notes #1 & #2a).
+* Argument(s) : nbr         Number to count digits of.
 *
-*               pstr_next       Optional pointer to a variable to ... :
+* Return(s)   : Number of decimal digits, from 1 (for 0 to 9) to 10.
 *
-*                                   (a) Return a pointer to first character following the integer string,
-*                                           if NO error(s) [see Note #2a2B2];
-*                                   (b) Return a pointer to 'pstr',
-*                                           otherwise      (see Note #2a2A2).
+* Caller(s)   : Str_FmtNbr_Int32(),
+*               Str_FmtNbr_32().
 *
-*               nbr_base        Base of number to parse (see Notes #2a1B1 & #2a2B1).
+* Note(s)     : (1) The number is compared with the powers of 10; NO division is performed.
+*********************************************************************************************************
+*/
+
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+static  CPU_INT08U  Str_FmtNbr_DecDigCnt (CPU_INT32U  nbr)
+{
+    CPU_INT08U  nbr_dig;
+
+
+    nbr_dig = 1u;
+    while ((nbr_dig <  (sizeof(Str_FmtNbr_Pwr10Tbl) / sizeof(Str_FmtNbr_Pwr10Tbl[0]))) &&
+           (nbr     >=  Str_FmtNbr_Pwr10Tbl[nbr_dig])) {
+        nbr_dig++;
+    }
+
+    return (nbr_dig);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          Str_FmtNbr_Dec()
 *
-*               nbr_signed      Indicates whether number to parse is signed :
+* Description : Format the decimal digits of a 32-bit unsigned integer, two digits at a time.
 *
-*                                   DEF_NO                  Number is unsigned.
-*                                   DEF_YES                 Number is   signed.
+* Argument(s) : nbr         Number to format.
 *
-*               pnbr_neg        Pointer to a variable to return if the parsed (signed) number is negative :
+*               nbr_dig     Number of digits of the number (see Note #1).
 *
-*                                   DEF_NO                  Number is non-negative.
-*                                   DEF_YES                 Number is     negative.
+*               pstr        Pointer to character array to receive the 'nbr_dig' digits.
 *
-* Return(s)   : Parsed integer,      if integer parsed with NO overflow   (see Note #2a3A).
+* Return(s)   : none.
 *
-*               DEF_INT_32U_MAX_VAL, if integer parsed but     overflowed (see Note #2a3A1).
+* Caller(s)   : Str_FmtNbr_Int32(),
+*               Str_FmtNbr_32().
 *
-*               0,                   otherwise                            (see Note #2a3B).
+* Note(s)     : (1) 'nbr_dig' MUST be the number of decimal digits of 'nbr' (see Str_FmtNbr_DecDigCnt()).
+*
+*               (2) NO terminating NULL character is appended.
+*********************************************************************************************************
+*/
+
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+static  void  Str_FmtNbr_Dec (CPU_INT32U   nbr,
+                              CPU_INT08U   nbr_dig,
+                              CPU_CHAR    *pstr)
+{
+    CPU_CHAR    *pstr_fmt;
+    CPU_INT32U   ix;
+
+
+    pstr_fmt = pstr + nbr_dig;                                  /* Start fmt @ least-sig dig.                           */
+
+    while (nbr >= 100u) {                                       /* Fmt two digs per div.                                */
+        ix          = (nbr % 100u) * 2u;
+        nbr        /=  100u;
+       *--pstr_fmt  =  Str_FmtNbr_Dig2Tbl[ix + 1u];
+       *--pstr_fmt  =  Str_FmtNbr_Dig2Tbl[ix];
+    }
+
+    if (nbr >= 10u) {                                           /* Fmt most-sig dig(s).                                 */
+        ix          =  nbr * 2u;
+       *--pstr_fmt  =  Str_FmtNbr_Dig2Tbl[ix + 1u];
+       *--pstr_fmt  =  Str_FmtNbr_Dig2Tbl[ix];
+    } else {
+       *--pstr_fmt  = (CPU_CHAR)(nbr + '0');
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Str_ParseNbr_Int32()
+*
+* Description : Parse 32-bit integer from string.
+*
+* Argument(s) : pstr            Pointer to string (see Notes #1 & #2a).
+*
+*               pstr_next       Optional pointer to a variable to ... :
+*
+*                                   (a) Return a pointer to first character following the integer string,
+*                                           if NO error(s) [see Note #2a2B2];
+*                                   (b) Return a pointer to 'pstr',
+*                                           otherwise      (see Note #2a2A2).
+*
+*               nbr_base        Base of number to parse (see Notes #2a1B1 & #2a2B1).
+*
+*               nbr_signed      Indicates whether number to parse is signed :
+*
+*                                   DEF_NO                  Number is unsigned.
+*                                   DEF_YES                 Number is   signed.
+*
+*               pnbr_neg        Pointer to a variable to return if the parsed (signed) number is negative :
+*
+*                                   DEF_NO                  Number is non-negative.
+*                                   DEF_YES                 Number is     negative.
+*
+* Return(s)   : Parsed integer,      if integer parsed with NO overflow   (see Note #2a3A).
+*
+*               DEF_INT_32U_MAX_VAL, if integer parsed but     overflowed (see Note #2a3A1).
+*
+*               0,                   otherwise                            (see Note #2a3B).
 *
 * Caller(s)   : Str_ParseNbr_Int32U(),
 *               Str_ParseNbr_Int32S().
@@ -3832,6 +4499,10 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
 *
 *               (5) Pointers to variables that return values MUST be initialized PRIOR to all other
 *                   validation or function handling in case of any error(s).
+*
+*               (6) If the fast number parse is enabled (see 'lib_str.h  STRING NUMBER PARSE CONFIGURATION
+*                   Note #1'), base-10 & base-16 digits are first merged four at a time while the number can
+*                   NOT overflow; the remaining digits, & any overflow, are then parsed one at a time.
 *********************************************************************************************************
 */
 
@@ -3856,6 +4527,9 @@ static  CPU_INT32U  Str_ParseNbr_Int32 (const  CPU_CHAR      *pstr,
            CPU_BOOLEAN   neg;
            CPU_BOOLEAN   ovf;
            CPU_BOOLEAN   done;
+#if (LIB_STR_CFG_PARSE_FAST_EN == DEF_ENABLED)
+           CPU_BOOLEAN   parse_fast;
+#endif
 
                                                                 /* --------------- VALIDATE PARSE ARGS ---------------- */
     if (pstr_next == (CPU_CHAR **) 0) {                         /* If NOT avail, ...                                    */
@@ -3979,6 +4653,17 @@ static  CPU_INT32U  Str_ParseNbr_Int32 (const  CPU_CHAR      *pstr,
     ovf  = DEF_NO;
     done = DEF_NO;
 
+#if (LIB_STR_CFG_PARSE_FAST_EN == DEF_ENABLED)
+    parse_fast = ((nbr_base == 10u) ||                          /* Parse dec & hex digs by 4 (see Note #6).             */
+                  (nbr_base == 16u)) ? DEF_YES : DEF_NO;
+    while (parse_fast == DEF_YES) {
+        parse_fast = Str_ParseNbr_Dig4(pstr_parse, nbr_base, &nbr);
+        if (parse_fast == DEF_YES) {
+            pstr_parse += 4u;
+        }
+    }
+#endif
+
     while (done == DEF_NO) {                                    /* Parse str for desired nbr base digs (see Note #2a2). */
         parse_char = (CPU_CHAR)*pstr_parse;
         nbr_alpha  =  ASCII_IsAlphaNum(parse_char);
@@ -4037,3 +4722,669 @@ static  CPU_INT32U  Str_ParseNbr_Int32 (const  CPU_CHAR      *pstr,
     return (nbr);
 }
 
+
+/*
+*********************************************************************************************************
+*                                         Str_ParseNbr_Dig4()
+*
+* Description : Merge the next four decimal or hexadecimal digits of a string into a number.
+*
+* Argument(s) : pstr            Pointer to the next character to parse; MUST NOT be NULL.
+*
+*               nbr_base        Base of number to parse; MUST be 10 or 16.
+*
+*               pnbr            Pointer to the number parsed so far; updated only if four digits merged.
+*
+* Return(s)   : DEF_YES, if four digits merged into the number;
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Str_ParseNbr_Int32().
+*
+* Note(s)     : (1) The four characters are loaded into one 32-bit word, first character in the least
+*                   significant octet, & are ALL validated at once :
+*
+*                   (a) Octets with the most significant bit set are NOT ASCII digits.
+*
+*                   (b) For 7-bit octets, STR_PARSE_NBR_FAST_IN_RANGE() sets the most significant bit of
+*                       each octet within a character range, with NO carry between octets.
+*
+*               (2) The word is NOT loaded if it would cross a page boundary, so that NO page is accessed
+*                   that the portable parse would NOT access.
+*
+*               (3) Digits are NOT merged if the number could overflow; the portable parse then handles
+*                   the overflow (see 'Str_ParseNbr_Int32()  Note #2a3A1').
+*
+*               (4) Digit values are combined in pairs, then the two pairs, with NO carry between octets :
+*
+*                       decimal     : (d0 * 10 + d1) * 100 + (d2 * 10 + d3)
+*                       hexadecimal : (d0 * 16 + d1) * 256 + (d2 * 16 + d3)
+*********************************************************************************************************
+*/
+
+#if (LIB_STR_CFG_PARSE_FAST_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  Str_ParseNbr_Dig4 (const  CPU_CHAR     *pstr,
+                                               CPU_INT08U    nbr_base,
+                                               CPU_INT32U   *pnbr)
+{
+    const  CPU_INT08U  *p_octet;
+           CPU_INT32U   word;
+           CPU_INT32U   dig;
+           CPU_INT32U   alpha;
+           CPU_INT32U   val;
+
+
+    if (((CPU_ADDR)pstr % STR_PARSE_NBR_FAST_PAGE_SIZE) >       /* Rtn if word crosses a page (see Note #2).            */
+                         (STR_PARSE_NBR_FAST_PAGE_SIZE - 4u)) {
+        return (DEF_NO);
+    }
+
+    p_octet = (const CPU_INT08U *)pstr;                         /* Load 4 chars, 1st char in LSO (see Note #1).         */
+    word    =  (CPU_INT32U)p_octet[0]         |
+              ((CPU_INT32U)p_octet[1] <<  8u) |
+              ((CPU_INT32U)p_octet[2] << 16u) |
+              ((CPU_INT32U)p_octet[3] << 24u);
+    if ((word & 0x80808080u) != 0u) {                           /* Rtn if any non-ASCII char   (see Note #1a).          */
+        return (DEF_NO);
+    }
+
+    dig = STR_PARSE_NBR_FAST_IN_RANGE(word, (CPU_INT32U)'0', (CPU_INT32U)'9');
+
+    if (nbr_base == 10u) {
+        if ((dig  != 0x80808080u) ||                            /* Rtn if any non-dec dig      (see Note #1b) ...       */
+            (*pnbr > STR_PARSE_NBR_FAST_OVF_TH_DEC)) {          /* ... or if nbr could ovf     (see Note #3).           */
+            return (DEF_NO);
+        }
+        val   =  word & 0x0F0F0F0Fu;                            /* Combine dig vals            (see Note #4).           */
+        val   = ((val * 10u) + (val >> 8u)) & 0x00FF00FFu;
+        val   = ((val & 0xFFu) * 100u) + (val >> 16u);
+       *pnbr  = (*pnbr * 10000u) + val;
+
+    } else {                                                    /* Dec digs & upper/lower case 'a' .. 'f'.              */
+        alpha = STR_PARSE_NBR_FAST_IN_RANGE(word | 0x20202020u, (CPU_INT32U)'a', (CPU_INT32U)'f');
+        if (((dig | alpha) != 0x80808080u) ||                   /* Rtn if any non-hex dig      (see Note #1b) ...       */
+             (*pnbr > STR_PARSE_NBR_FAST_OVF_TH_HEX)) {         /* ... or if nbr could ovf     (see Note #3).           */
+            return (DEF_NO);
+        }
+        val   = (word & 0x0F0F0F0Fu) + ((alpha >> 7u) * 9u);    /* 'a' & 'A' low nibble is 1 : add 9 for 10.            */
+        val   = ((val << 4u) + (val >> 8u)) & 0x00FF00FFu;      /* Combine dig vals            (see Note #4).           */
+        val   = ((val & 0xFFu) << 8u) | (val >> 16u);
+       *pnbr  = (*pnbr << 16u) | val;
+    }
+
+    return (DEF_YES);
+}
+#endif
+
+
+
+/*
+*********************************************************************************************************
+*                                           Str_SIMD_Span()
+*
+* Description : Count the characters at the start of a string that are neither the NULL character nor a
+*               search character, using vector compares.
+*
+* Argument(s) : pstr            Pointer to string; MUST NOT be NULL.
+*
+*               len_max         Maximum number of characters to count.
+*
+*               srch_char       Search character.
+*
+* Return(s)   : Number of characters before the first NULL or search character, if any within 'len_max'
+*                   number of characters & before the NULL address (see Note #1);
+*
+*               Maximum number of characters to count, otherwise.
+*
+*               0, if the portable string functions are used.
+*
+* Caller(s)   : Str_Len_N(),
+*               Str_Char_N().
+*
+* Note(s)     : (1) The count stops before the NULL address so that the caller's character loop still
+*                   detects strings that overlap with the NULL address.
+*********************************************************************************************************
+*/
+
+#if (LIB_STR_CFG_SIMD_EN == DEF_ENABLED)
+static  CPU_SIZE_T  Str_SIMD_Span (const  CPU_CHAR    *pstr,
+                                          CPU_SIZE_T   len_max,
+                                          CPU_CHAR     srch_char)
+{
+    CPU_ADDR    len_addr;
+    CPU_SIZE_T  len;
+
+
+    len_addr = (CPU_ADDR)0 - (CPU_ADDR)pstr;                    /* Lim cnt to chars before NULL addr (see Note #1).     */
+    if (len_addr < len_max) {
+        len_max = (CPU_SIZE_T)len_addr;
+    }
+
+    len = 0u;
+    if (len_max > 0u) {
+        switch (Mem_SIMD_ImplGet()) {
+#if (LIB_STR_SIMD_ARCH == LIB_STR_SIMD_ARCH_X86)
+            case LIB_MEM_SIMD_IMPL_AVX2:
+                 len = Str_SIMD_Span_AVX2(pstr, len_max, srch_char);
+                 break;
+
+            case LIB_MEM_SIMD_IMPL_SSE2:
+                 len = Str_SIMD_Span_SSE2(pstr, len_max, srch_char);
+                 break;
+#endif
+
+            default:                                            /* Portable fncts cnt ALL chars.                        */
+                 break;
+        }
+    }
+
+    return (len);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Str_SIMD_SpanCmp()
+*
+* Description : Count the identical, non-NULL characters at the start of two strings, using vector
+*               compares.
+*
+* Argument(s) : p1_str          Pointer to first  string; MUST NOT be NULL.
+*
+*               p2_str          Pointer to second string; MUST NOT be NULL.
+*
+*               len_max         Maximum number of characters to count.
+*
+* Return(s)   : Number of identical, non-NULL characters, up to 'len_max' number of characters & up to
+*                   the character before the NULL address in either string (see Note #1);
+*
+*               0, if the portable string functions are used.
+*
+* Caller(s)   : Str_Cmp_N().
+*
+* Note(s)     : (1) The count stops so that neither string's next character pointer points to the NULL
+*                   address; the caller's character loop still detects strings that overlap with it.
+*********************************************************************************************************
+*/
+
+#if (LIB_STR_CFG_SIMD_EN == DEF_ENABLED)
+static  CPU_SIZE_T  Str_SIMD_SpanCmp (const  CPU_CHAR    *p1_str,
+                                      const  CPU_CHAR    *p2_str,
+                                             CPU_SIZE_T   len_max)
+{
+    CPU_ADDR    len_addr_1;
+    CPU_ADDR    len_addr_2;
+    CPU_SIZE_T  len;
+
+                                                                /* Lim cnt to chars before NULL addr (see Note #1).     */
+    len_addr_1 = (CPU_ADDR)0 - (CPU_ADDR)p1_str - 1u;
+    len_addr_2 = (CPU_ADDR)0 - (CPU_ADDR)p2_str - 1u;
+    if (len_addr_1 < len_max) {
+        len_max = (CPU_SIZE_T)len_addr_1;
+    }
+    if (len_addr_2 < len_max) {
+        len_max = (CPU_SIZE_T)len_addr_2;
+    }
+
+    len = 0u;
+    if (len_max > 0u) {
+        switch (Mem_SIMD_ImplGet()) {
+#if (LIB_STR_SIMD_ARCH == LIB_STR_SIMD_ARCH_X86)
+            case LIB_MEM_SIMD_IMPL_AVX2:
+                 len = Str_SIMD_SpanCmp_AVX2(p1_str, p2_str, len_max);
+                 break;
+
+            case LIB_MEM_SIMD_IMPL_SSE2:
+                 len = Str_SIMD_SpanCmp_SSE2(p1_str, p2_str, len_max);
+                 break;
+#endif
+
+            default:                                            /* Portable fncts cmp ALL chars.                        */
+                 break;
+        }
+    }
+
+    return (len);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Str_SIMD_Srch()
+*
+* Description : Find the first position of a search string in a string, using vector compares of the
+*               search string's first & last characters.
+*
+* Argument(s) : pstr            Pointer to string, with NO NULL character in its first
+*                                   ('srch_len' + 'len_srch') characters.
+*
+*               srch_len        Last position to search.
+*
+*               pstr_srch       Pointer to search string.
+*
+*               len_srch        Length of search string; MUST be > 0.
+*
+* Return(s)   : Position of the first occurrence of the search string, if found;
+*
+*               First position NOT yet searched, otherwise ('srch_len' + 1 if ALL positions searched).
+*
+* Caller(s)   : Str_Str_N().
+*
+* Note(s)     : (1) Vectors are loaded only within the string's first ('srch_len' + 'len_srch') characters;
+*                   the remaining positions are searched by the caller.
+*********************************************************************************************************
+*/
+
+#if (LIB_STR_CFG_SIMD_EN == DEF_ENABLED)
+static  CPU_SIZE_T  Str_SIMD_Srch (const  CPU_CHAR    *pstr,
+                                          CPU_SIZE_T   srch_len,
+                                   const  CPU_CHAR    *pstr_srch,
+                                          CPU_SIZE_T   len_srch)
+{
+    CPU_SIZE_T  srch_ix;
+
+
+    srch_ix = 0u;
+    switch (Mem_SIMD_ImplGet()) {
+#if (LIB_STR_SIMD_ARCH == LIB_STR_SIMD_ARCH_X86)
+        case LIB_MEM_SIMD_IMPL_AVX2:
+             srch_ix = Str_SIMD_Srch_AVX2(pstr, srch_len, pstr_srch, len_srch);
+             break;
+
+        case LIB_MEM_SIMD_IMPL_SSE2:
+             srch_ix = Str_SIMD_Srch_SSE2(pstr, srch_len, pstr_srch, len_srch);
+             break;
+#endif
+
+        default:                                                /* Portable fncts srch ALL positions.                   */
+             break;
+    }
+
+    return (srch_ix);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Str_SIMD_Span_SSE2()
+*                                        Str_SIMD_Span_AVX2()
+*
+* Description : Count the characters at the start of a string that are neither the NULL character nor a
+*               search character, using vector compares.
+*
+* Argument(s) : pstr            Pointer to string.
+*
+*               len_max         Maximum number of characters to count; MUST be > 0.
+*
+*               srch_char       Search character.
+*
+* Return(s)   : Number of characters before the first NULL or search character, if any within 'len_max'
+*                   number of characters;
+*
+*               Maximum number of characters to count, otherwise.
+*
+* Caller(s)   : Str_SIMD_Span().
+*
+* Note(s)     : (1) Vectors are loaded from aligned addresses, which never cross a page boundary.  Each
+*                   vector holds at least one character that the portable functions would read, so the
+*                   vector's page is readable; characters before the string or past its end are ignored.
+*********************************************************************************************************
+*/
+
+#if ((LIB_STR_CFG_SIMD_EN == DEF_ENABLED) && \
+     (LIB_STR_SIMD_ARCH   == LIB_STR_SIMD_ARCH_X86))
+LIB_STR_SIMD_TGT("sse2")
+static  CPU_SIZE_T  Str_SIMD_Span_SSE2 (const  CPU_CHAR    *pstr,
+                                               CPU_SIZE_T   len_max,
+                                               CPU_CHAR     srch_char)
+{
+    const  CPU_CHAR    *p_blk;
+           __m128i      vect;
+           __m128i      vect_char;
+           __m128i      vect_zero;
+           CPU_INT32U   mask;
+           CPU_SIZE_T   len;
+
+
+    vect_zero = _mm_setzero_si128();
+    vect_char = _mm_set1_epi8((char)srch_char);
+                                                                /* Load aligned vects (see Note #1) ...                 */
+    p_blk     = pstr - ((CPU_ADDR)pstr % 16u);
+    vect      = _mm_load_si128((const __m128i *)p_blk);
+    mask      = (CPU_INT32U)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(vect, vect_zero),
+                                                           _mm_cmpeq_epi8(vect, vect_char)));
+    mask     &= 0xFFFFu << ((CPU_ADDR)pstr % 16u);              /* ... ignoring chars before str.                       */
+
+    while ((mask == 0u) &&
+           ((CPU_SIZE_T)((p_blk + 16u) - pstr) < len_max)) {
+        p_blk += 16u;
+        vect   = _mm_load_si128((const __m128i *)p_blk);
+        mask   = (CPU_INT32U)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(vect, vect_zero),
+                                                            _mm_cmpeq_epi8(vect, vect_char)));
+    }
+
+    len = len_max;
+    if (mask != 0u) {                                           /* If NULL or srch char found, ...                      */
+        len = (CPU_SIZE_T)((p_blk + CPU_CntTrailZeros32(mask)) - pstr);
+        if (len > len_max) {                                    /* ... past max nbr chars, rtn max.                     */
+            len = len_max;
+        }
+    }
+
+    return (len);
+}
+
+
+LIB_STR_SIMD_TGT("avx2")
+static  CPU_SIZE_T  Str_SIMD_Span_AVX2 (const  CPU_CHAR    *pstr,
+                                               CPU_SIZE_T   len_max,
+                                               CPU_CHAR     srch_char)
+{
+    const  CPU_CHAR    *p_blk;
+           __m256i      vect;
+           __m256i      vect_char;
+           __m256i      vect_zero;
+           CPU_INT32U   mask;
+           CPU_SIZE_T   len;
+
+
+    vect_zero = _mm256_setzero_si256();
+    vect_char = _mm256_set1_epi8((char)srch_char);
+                                                                /* Load aligned vects (see Note #1) ...                 */
+    p_blk     = pstr - ((CPU_ADDR)pstr % 32u);
+    vect      = _mm256_load_si256((const __m256i *)p_blk);
+    mask      = (CPU_INT32U)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(vect, vect_zero),
+                                                                 _mm256_cmpeq_epi8(vect, vect_char)));
+    mask     &= 0xFFFFFFFFu << ((CPU_ADDR)pstr % 32u);          /* ... ignoring chars before str.                       */
+
+    while ((mask == 0u) &&
+           ((CPU_SIZE_T)((p_blk + 32u) - pstr) < len_max)) {
+        p_blk += 32u;
+        vect   = _mm256_load_si256((const __m256i *)p_blk);
+        mask   = (CPU_INT32U)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(vect, vect_zero),
+                                                                  _mm256_cmpeq_epi8(vect, vect_char)));
+    }
+
+    len = len_max;
+    if (mask != 0u) {                                           /* If NULL or srch char found, ...                      */
+        len = (CPU_SIZE_T)((p_blk + CPU_CntTrailZeros32(mask)) - pstr);
+        if (len > len_max) {                                    /* ... past max nbr chars, rtn max.                     */
+            len = len_max;
+        }
+    }
+
+    return (len);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       Str_SIMD_SpanCmp_SSE2()
+*                                       Str_SIMD_SpanCmp_AVX2()
+*
+* Description : Count the identical, non-NULL characters at the start of two strings, using vector
+*               compares.
+*
+* Argument(s) : p1_str          Pointer to first  string.
+*
+*               p2_str          Pointer to second string.
+*
+*               len_max         Maximum number of characters to count; MUST be > 0.
+*
+* Return(s)   : Number of identical, non-NULL characters, up to 'len_max' number of characters.
+*
+* Caller(s)   : Str_SIMD_SpanCmp().
+*
+* Note(s)     : (1) The first string's vectors are loaded from aligned addresses (see 'Str_SIMD_Span_SSE2()
+*                   Note #1'); characters are compared one at a time until it is aligned.
+*
+*               (2) The second string's vectors are loaded from unaligned addresses; characters are
+*                   compared one at a time wherever its vector would cross a page boundary, since the
+*                   next page may NOT be readable.
+*********************************************************************************************************
+*/
+
+#if ((LIB_STR_CFG_SIMD_EN == DEF_ENABLED) && \
+     (LIB_STR_SIMD_ARCH   == LIB_STR_SIMD_ARCH_X86))
+LIB_STR_SIMD_TGT("sse2")
+static  CPU_SIZE_T  Str_SIMD_SpanCmp_SSE2 (const  CPU_CHAR    *p1_str,
+                                           const  CPU_CHAR    *p2_str,
+                                                  CPU_SIZE_T   len_max)
+{
+    __m128i      vect_1;
+    __m128i      vect_2;
+    __m128i      vect_zero;
+    CPU_INT32U   mask;
+    CPU_SIZE_T   len;
+    CPU_BOOLEAN  done;
+
+
+    vect_zero = _mm_setzero_si128();
+    len       = 0u;
+    done      = DEF_NO;
+
+    while ((done == DEF_NO) &&
+           (len  <  len_max)) {
+                                                                /* Cmp one char at a time until p1 aligned ...          */
+                                                                /* ... (see Note #1) or where p2 vect would cross a ... */
+                                                                /* ... page (see Note #2).                              */
+        if ((((CPU_ADDR)(p1_str + len) % 16u) != 0u) ||
+            (((CPU_ADDR)(p2_str + len) % LIB_STR_SIMD_PAGE_SIZE) > (LIB_STR_SIMD_PAGE_SIZE - 16u))) {
+            if ((p1_str[len] != p2_str[len]) ||
+                (p1_str[len] == (CPU_CHAR)'\0')) {
+                done = DEF_YES;
+            } else {
+                len++;
+            }
+
+        } else {
+            vect_1 = _mm_load_si128((const __m128i *)(p1_str + len));
+            vect_2 = _mm_loadu_si128((const __m128i *)(p2_str + len));
+                                                                /* Find mismatched chars or NULL chars.                 */
+            mask   = ((CPU_INT32U)_mm_movemask_epi8(_mm_cmpeq_epi8(vect_1, vect_2))    ^ 0xFFFFu) |
+                      (CPU_INT32U)_mm_movemask_epi8(_mm_cmpeq_epi8(vect_1, vect_zero));
+            if (mask != 0u) {
+                len  += CPU_CntTrailZeros32(mask);
+                done  = DEF_YES;
+            } else {
+                len  += 16u;
+            }
+        }
+    }
+
+    if (len > len_max) {
+        len = len_max;
+    }
+
+    return (len);
+}
+
+
+LIB_STR_SIMD_TGT("avx2")
+static  CPU_SIZE_T  Str_SIMD_SpanCmp_AVX2 (const  CPU_CHAR    *p1_str,
+                                           const  CPU_CHAR    *p2_str,
+                                                  CPU_SIZE_T   len_max)
+{
+    __m256i      vect_1;
+    __m256i      vect_2;
+    __m256i      vect_zero;
+    CPU_INT32U   mask;
+    CPU_SIZE_T   len;
+    CPU_BOOLEAN  done;
+
+
+    vect_zero = _mm256_setzero_si256();
+    len       = 0u;
+    done      = DEF_NO;
+
+    while ((done == DEF_NO) &&
+           (len  <  len_max)) {
+                                                                /* Cmp one char at a time until p1 aligned ...          */
+                                                                /* ... (see Note #1) or where p2 vect would cross a ... */
+                                                                /* ... page (see Note #2).                              */
+        if ((((CPU_ADDR)(p1_str + len) % 32u) != 0u) ||
+            (((CPU_ADDR)(p2_str + len) % LIB_STR_SIMD_PAGE_SIZE) > (LIB_STR_SIMD_PAGE_SIZE - 32u))) {
+            if ((p1_str[len] != p2_str[len]) ||
+                (p1_str[len] == (CPU_CHAR)'\0')) {
+                done = DEF_YES;
+            } else {
+                len++;
+            }
+
+        } else {
+            vect_1 = _mm256_load_si256((const __m256i *)(p1_str + len));
+            vect_2 = _mm256_loadu_si256((const __m256i *)(p2_str + len));
+                                                                /* Find mismatched chars or NULL chars.                 */
+            mask   = ((CPU_INT32U)_mm256_movemask_epi8(_mm256_cmpeq_epi8(vect_1, vect_2))    ^ 0xFFFFFFFFu) |
+                      (CPU_INT32U)_mm256_movemask_epi8(_mm256_cmpeq_epi8(vect_1, vect_zero));
+            if (mask != 0u) {
+                len  += CPU_CntTrailZeros32(mask);
+                done  = DEF_YES;
+            } else {
+                len  += 32u;
+            }
+        }
+    }
+
+    if (len > len_max) {
+        len = len_max;
+    }
+
+    return (len);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Str_SIMD_Srch_SSE2()
+*                                        Str_SIMD_Srch_AVX2()
+*
+* Description : Find the first position of a search string in a string, using vector compares of the
+*               search string's first & last characters.
+*
+* Argument(s) : pstr            Pointer to string, with NO NULL character in its first
+*                                   ('srch_len' + 'len_srch') characters.
+*
+*               srch_len        Last position to search.
+*
+*               pstr_srch       Pointer to search string.
+*
+*               len_srch        Length of search string; MUST be > 0.
+*
+* Return(s)   : Position of the first occurrence of the search string, if found;
+*
+*               First position NOT yet searched, otherwise.
+*
+* Caller(s)   : Str_SIMD_Srch().
+*
+* Note(s)     : (1) Each vector compares the first & last characters at 16 (or 32) consecutive positions;
+*                   positions where both match are compared in full with Mem_Cmp().
+*********************************************************************************************************
+*/
+
+#if ((LIB_STR_CFG_SIMD_EN == DEF_ENABLED) && \
+     (LIB_STR_SIMD_ARCH   == LIB_STR_SIMD_ARCH_X86))
+LIB_STR_SIMD_TGT("sse2")
+static  CPU_SIZE_T  Str_SIMD_Srch_SSE2 (const  CPU_CHAR    *pstr,
+                                               CPU_SIZE_T   srch_len,
+                                        const  CPU_CHAR    *pstr_srch,
+                                               CPU_SIZE_T   len_srch)
+{
+    const  CPU_CHAR    *p_first;
+    const  CPU_CHAR    *p_last;
+           __m128i      vect_first;
+           __m128i      vect_last;
+           __m128i      vect_eq;
+           CPU_INT32U   mask;
+           CPU_DATA     pos;
+           CPU_SIZE_T   srch_ix;
+           CPU_BOOLEAN  found;
+
+
+    vect_first = _mm_set1_epi8((char)pstr_srch[0]);
+    vect_last  = _mm_set1_epi8((char)pstr_srch[len_srch - 1u]);
+    srch_ix    = 0u;
+    found      = DEF_NO;
+
+    while ((found           == DEF_NO) &&                       /* Srch while a whole vect of positions remains.        */
+           ((srch_ix + 15u) <= srch_len)) {
+        p_first = pstr    + srch_ix;
+        p_last  = p_first + len_srch - 1u;
+        vect_eq = _mm_and_si128(_mm_cmpeq_epi8(vect_first, _mm_loadu_si128((const __m128i *)p_first)),
+                                _mm_cmpeq_epi8(vect_last,  _mm_loadu_si128((const __m128i *)p_last)));
+        mask    = (CPU_INT32U)_mm_movemask_epi8(vect_eq);
+
+        while ((found == DEF_NO) &&                             /* Cmp candidate positions (see Note #1).               */
+               (mask  != 0u)) {
+            pos = CPU_CntTrailZeros32(mask);
+            if (Mem_Cmp(pstr + srch_ix + pos, pstr_srch, len_srch) == DEF_YES) {
+                srch_ix += pos;
+                found    = DEF_YES;
+            } else {
+                mask    &= mask - 1u;
+            }
+        }
+
+        if (found == DEF_NO) {
+            srch_ix += 16u;
+        }
+    }
+
+    return (srch_ix);
+}
+
+
+LIB_STR_SIMD_TGT("avx2")
+static  CPU_SIZE_T  Str_SIMD_Srch_AVX2 (const  CPU_CHAR    *pstr,
+                                               CPU_SIZE_T   srch_len,
+                                        const  CPU_CHAR    *pstr_srch,
+                                               CPU_SIZE_T   len_srch)
+{
+    const  CPU_CHAR    *p_first;
+    const  CPU_CHAR    *p_last;
+           __m256i      vect_first;
+           __m256i      vect_last;
+           __m256i      vect_eq;
+           CPU_INT32U   mask;
+           CPU_DATA     pos;
+           CPU_SIZE_T   srch_ix;
+           CPU_BOOLEAN  found;
+
+
+    vect_first = _mm256_set1_epi8((char)pstr_srch[0]);
+    vect_last  = _mm256_set1_epi8((char)pstr_srch[len_srch - 1u]);
+    srch_ix    = 0u;
+    found      = DEF_NO;
+
+    while ((found           == DEF_NO) &&                       /* Srch while a whole vect of positions remains.        */
+           ((srch_ix + 31u) <= srch_len)) {
+        p_first = pstr    + srch_ix;
+        p_last  = p_first + len_srch - 1u;
+        vect_eq = _mm256_and_si256(_mm256_cmpeq_epi8(vect_first, _mm256_loadu_si256((const __m256i *)p_first)),
+                                   _mm256_cmpeq_epi8(vect_last,  _mm256_loadu_si256((const __m256i *)p_last)));
+        mask    = (CPU_INT32U)_mm256_movemask_epi8(vect_eq);
+
+        while ((found == DEF_NO) &&                             /* Cmp candidate positions (see Note #1).               */
+               (mask  != 0u)) {
+            pos = CPU_CntTrailZeros32(mask);
+            if (Mem_Cmp(pstr + srch_ix + pos, pstr_srch, len_srch) == DEF_YES) {
+                srch_ix += pos;
+                found    = DEF_YES;
+            } else {
+                mask    &= mask - 1u;
+            }
+        }
+
+        if (found == DEF_NO) {
+            srch_ix += 32u;
+        }
+    }
+
+    return (srch_ix);
+}
+#endif
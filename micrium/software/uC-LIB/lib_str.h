@@ -211,6 +211,80 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                STRING NUMBER FORMAT CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_STR_CFG_FMT_FAST_EN to enable/disable the fast number format core used by
+*               Str_FmtNbr_Int32U(), Str_FmtNbr_Int32S() & Str_FmtNbr_32() :
+*
+*               (a) Decimal integer digits are formatted two at a time from a look-up table, after a
+*                   single digit count, instead of one division per digit.
+*
+*               (b) The integer part of floating point numbers is formatted with integer arithmetic
+*                   whenever it is provably identical to the floating point divisions.
+*
+*               Formatted strings are identical, character for character, to the portable format.
+*********************************************************************************************************
+*/
+
+                                                                /* Configure fast number format (see Note #1) :         */
+#ifndef  LIB_STR_CFG_FMT_FAST_EN
+#define  LIB_STR_CFG_FMT_FAST_EN                DEF_DISABLED
+                                                                /*   DEF_DISABLED     Portable number format            */
+                                                                /*   DEF_ENABLED      Fast     number format            */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 STRING NUMBER PARSE CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_STR_CFG_PARSE_FAST_EN to enable/disable the fast number parse core used by
+*               Str_ParseNbr_Int32U(), Str_ParseNbr_Int32S() & the number table parse functions :
+*
+*               (a) Decimal & hexadecimal digits are validated & converted four at a time, in a single
+*                   32-bit word (SWAR), while the parsed number can NOT overflow.
+*
+*               (b) Word loads never cross a page boundary, but MAY read octets past the end of a
+*                   string within the same page.
+*
+*               Parsed numbers & next string pointers are identical to the portable parse.
+*********************************************************************************************************
+*/
+
+                                                                /* Configure fast number parse (see Note #1) :          */
+#ifndef  LIB_STR_CFG_PARSE_FAST_EN
+#define  LIB_STR_CFG_PARSE_FAST_EN              DEF_DISABLED
+                                                                /*   DEF_DISABLED     Portable number parse             */
+                                                                /*   DEF_ENABLED      Fast     number parse             */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     STRING SIMD CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_STR_CFG_SIMD_EN to enable/disable the vectorized Str_Len(), Str_Char(),
+*               Str_Cmp(), Str_Str() & their '_N' variants :
+*
+*               (a) The SSE2 or AVX2 implementation is the one selected for the memory functions (see
+*                   'lib_mem.h  MEMORY LIBRARY SIMD OPTIMIZATION CONFIGURATION') & so requires
+*                   LIB_MEM_CFG_SIMD_EN; other implementations use the portable functions.
+*
+*               (b) Vector loads never cross a page boundary that the portable functions would NOT
+*                   cross, but MAY read octets past the end of a string within the same page.
+*********************************************************************************************************
+*/
+
+                                                                /* Configure SIMD string functions (see Note #1) :      */
+#ifndef  LIB_STR_CFG_SIMD_EN
+#define  LIB_STR_CFG_SIMD_EN                    DEF_DISABLED
+                                                                /*   DEF_DISABLED     Portable   string functions       */
+                                                                /*   DEF_ENABLED      Vectorized string functions       */
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                               DEFINES
@@ -370,6 +444,12 @@ CPU_CHAR    *Str_FmtNbr_32      (       CPU_FP32       nbr,
                                         CPU_CHAR      *pstr);
 #endif
 
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+CPU_BOOLEAN  Str_FmtNbr_FastGet (       void);
+
+void         Str_FmtNbr_FastSet (       CPU_BOOLEAN    en);
+#endif
+
 
                                                                        /* ----------------- STR PARSE FNCTS ------------------ */
 CPU_INT32U   Str_ParseNbr_Int32U(const  CPU_CHAR      *pstr,
@@ -380,6 +460,20 @@ CPU_INT32S   Str_ParseNbr_Int32S(const  CPU_CHAR      *pstr,
                                         CPU_CHAR     **pstr_next,
                                         CPU_INT08U     nbr_base);
 
+CPU_SIZE_T   Str_ParseNbrTbl_Int32U(const  CPU_CHAR      *pstr,
+                                           CPU_CHAR     **pstr_next,
+                                           CPU_INT08U     nbr_base,
+                                           CPU_CHAR       delim_char,
+                                           CPU_INT32U    *pnbr_tbl,
+                                           CPU_SIZE_T     nbr_tbl_size);
+
+CPU_SIZE_T   Str_ParseNbrTbl_Int32S(const  CPU_CHAR      *pstr,
+                                           CPU_CHAR     **pstr_next,
+                                           CPU_INT08U     nbr_base,
+                                           CPU_CHAR       delim_char,
+                                           CPU_INT32S    *pnbr_tbl,
+                                           CPU_SIZE_T     nbr_tbl_size);
+
 
 /*
 *********************************************************************************************************
@@ -417,6 +511,45 @@ CPU_INT32S   Str_ParseNbr_Int32S(const  CPU_CHAR      *pstr,
 #endif
 
 
+#ifndef  LIB_STR_CFG_SIMD_EN
+#error  "LIB_STR_CFG_SIMD_EN                   not #define'd in 'lib_cfg.h'"
+#error  "                                [MUST be  DEF_DISABLED]           "
+#error  "                                [     ||  DEF_ENABLED ]           "
+
+#elif  ((LIB_STR_CFG_SIMD_EN != DEF_DISABLED) && \
+        (LIB_STR_CFG_SIMD_EN != DEF_ENABLED ))
+#error  "LIB_STR_CFG_SIMD_EN             illegally #define'd in 'lib_cfg.h'"
+#error  "                                [MUST be  DEF_DISABLED]           "
+#error  "                                [     ||  DEF_ENABLED ]           "
+#endif
+
+
+#ifndef  LIB_STR_CFG_FMT_FAST_EN
+#error  "LIB_STR_CFG_FMT_FAST_EN               not #define'd in 'lib_cfg.h'"
+#error  "                                [MUST be  DEF_DISABLED]           "
+#error  "                                [     ||  DEF_ENABLED ]           "
+
+#elif  ((LIB_STR_CFG_FMT_FAST_EN != DEF_DISABLED) && \
+        (LIB_STR_CFG_FMT_FAST_EN != DEF_ENABLED ))
+#error  "LIB_STR_CFG_FMT_FAST_EN         illegally #define'd in 'lib_cfg.h'"
+#error  "                                [MUST be  DEF_DISABLED]           "
+#error  "                                [     ||  DEF_ENABLED ]           "
+#endif
+
+
+#ifndef  LIB_STR_CFG_PARSE_FAST_EN
+#error  "LIB_STR_CFG_PARSE_FAST_EN             not #define'd in 'lib_cfg.h'"
+#error  "                                [MUST be  DEF_DISABLED]           "
+#error  "                                [     ||  DEF_ENABLED ]           "
+
+#elif  ((LIB_STR_CFG_PARSE_FAST_EN != DEF_DISABLED) && \
+        (LIB_STR_CFG_PARSE_FAST_EN != DEF_ENABLED ))
+#error  "LIB_STR_CFG_PARSE_FAST_EN       illegally #define'd in 'lib_cfg.h'"
+#error  "                                [MUST be  DEF_DISABLED]           "
+#error  "                                [     ||  DEF_ENABLED ]           "
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             MODULE END
@@ -1184,6 +1184,9 @@ CPU_BOOLEAN  OSIntCurTaskResume (void)
 * Arguments  : p_arg        Pointer to argument of the task.
 *
 * Note(s)    : 1) Priorities of these tasks are very important.
+*
+*              2) ISRs emulated by the BSP (see 'bsp_int.c') run with the critical section released, the
+*                 interrupted task being already suspended; the tick is then nested in the ISR in progress.
 *********************************************************************************************************
 */
 
@@ -1217,12 +1220,18 @@ static  DWORD  WINAPI  OSTickW32 (LPVOID  p_arg)
 #endif
                  CPU_CRITICAL_ENTER();
 
-                 suspended = OSIntCurTaskSuspend();
-                 if (suspended == DEF_TRUE) {
+                 if (OSIntNestingCtr > 0u) {                /* Nested in an emulated ISR (see Note #2).               */
                      OSIntEnter();
                      OSTimeTick();
                      OSIntExit();
-                     OSIntCurTaskResume();
+                 } else {
+                     suspended = OSIntCurTaskSuspend();
+                     if (suspended == DEF_TRUE) {
+                         OSIntEnter();
+                         OSTimeTick();
+                         OSIntExit();
+                         OSIntCurTaskResume();
+                     }
                  }
 
                  CPU_CRITICAL_EXIT();
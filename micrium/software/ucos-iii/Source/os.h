@@ -188,6 +188,8 @@ extern "C" {
 #define  OS_TASK_PEND_ON_SEM                  (OS_STATE)(  6u)  /* Pending on semaphore                               */
 #define  OS_TASK_PEND_ON_TASK_SEM             (OS_STATE)(  7u)  /* Pending on signal  to be sent to task              */
 #define  OS_TASK_PEND_ON_COND_VAR             (OS_STATE)(  8u)  /* Pending on condition variable                      */
+#define  OS_TASK_PEND_ON_Q_SPACE              (OS_STATE)(  9u)  /* Pending on space in a full queue                   */
+#define  OS_TASK_PEND_ON_TASK_Q_SPACE         (OS_STATE)( 10u)  /* Pending on space in a full task queue              */
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -267,6 +269,9 @@ extern "C" {
 #define  OS_OPT_PEND_BLOCKING                (OS_OPT)(0x0000u)
 #define  OS_OPT_PEND_NON_BLOCKING            (OS_OPT)(0x8000u)
 
+#define  OS_OPT_PEND_COALESCE                (OS_OPT)(0x0200u)  /* Wake after N messages or T ticks (queues only)     */
+#define  OS_OPT_PEND_SPIN                    (OS_OPT)(0x0400u)  /* Poll for a while before blocking (queues, sems)    */
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                  PEND ABORT OPTIONS
@@ -292,6 +297,7 @@ extern "C" {
 #define  OS_OPT_POST_LIFO                    (OS_OPT)(0x0010u)  /* Post to highest priority task waiting              */
 #define  OS_OPT_POST_1                       (OS_OPT)(0x0000u)  /* Post message to highest priority task waiting      */
 #define  OS_OPT_POST_ALL                     (OS_OPT)(0x0200u)  /* Broadcast message to ALL tasks waiting             */
+#define  OS_OPT_POST_BLOCKING                (OS_OPT)(0x0400u)  /* Wait for space if the queue is full                */
 
 #define  OS_OPT_POST_NO_SCHED                (OS_OPT)(0x8000u)  /* Do not call the scheduler if this is selected      */
 
@@ -927,6 +933,13 @@ struct  os_q {                                              /* Message Queue
 #endif
                                                             /* ------------------ SPECIFIC MEMBERS ------------------ */
     OS_MSG_Q             MsgQ;                              /* List of messages                                       */
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED)
+    OS_PEND_OBJ          PostPendObj;                       /* Tasks waiting for space in the queue (producers)       */
+#endif
+#if (OS_CFG_Q_COALESCE_EN == DEF_ENABLED)
+    OS_MSG_QTY           CoalesceNbr;                       /* OS_OPT_PEND_COALESCE: wake after this many messages ...*/
+    OS_TICK              CoalesceHold;                      /* ... or this many ticks after the first one (0 = none)  */
+#endif
 };
 
 
@@ -1042,6 +1055,10 @@ struct os_tcb {
     OS_PEND_OBJ         *PendObjPtr;                        /* Pointer to object pended on.                           */
     OS_STATE             PendOn;                            /* Indicates what task is pending on                      */
     OS_STATUS            PendStatus;                        /* Pend status                                            */
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+    CPU_TS               PendSpinAvg;                       /* OS_OPT_PEND_SPIN: average wait (in CPU_TS counts) ...  */
+    CPU_TS               PendSpinBudget;                    /* ... and time to poll before blocking                   */
+#endif
 
     OS_STATE             TaskState;                         /* See OS_TASK_STATE_xxx                                  */
     OS_PRIO              Prio;                              /* Task priority (0 == highest)                           */
@@ -1078,6 +1095,9 @@ struct os_tcb {
     void                *MsgPtr;                            /* Message received                                       */
     OS_MSG_SIZE          MsgSize;
 #endif
+#if (OS_CFG_Q_COALESCE_EN == DEF_ENABLED) || (OS_CFG_TASK_Q_COALESCE_EN == DEF_ENABLED)
+    CPU_BOOLEAN          MsgCoalesce;                       /* Task is pending with OS_OPT_PEND_COALESCE              */
+#endif
 
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
     OS_MSG_Q             MsgQ;                              /* Message queue associated with task                     */
@@ -1085,6 +1105,13 @@ struct os_tcb {
     CPU_TS               MsgQPendTime;                      /* Time it took for signal to be received                 */
     CPU_TS               MsgQPendTimeMax;                   /* Max amount of time it took for signal to be received   */
 #endif
+#if (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED)
+    OS_PEND_OBJ          MsgQPostPendObj;                   /* Tasks waiting for space in the task's queue            */
+#endif
+#if (OS_CFG_TASK_Q_COALESCE_EN == DEF_ENABLED)
+    OS_MSG_QTY           MsgQCoalesceNbr;                   /* OS_OPT_PEND_COALESCE: wake after this many messages ...*/
+    OS_TICK              MsgQCoalesceHold;                  /* ... or this many ticks after the first one (0 = none)  */
+#endif
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -1411,6 +1438,8 @@ extern  CPU_INT32U    const OSCfg_StatTaskStkSizeRAM;
 
 extern  CPU_STK_SIZE  const OSCfg_StkSizeMin;
 
+extern  CPU_INT32U    const OSCfg_PendSpinMax_us;
+
 extern  OS_RATE_HZ    const OSCfg_TickRate_Hz;
 extern  OS_PRIO       const OSCfg_TickTaskPrio;
 extern  CPU_STK     * const OSCfg_TickTaskStkBasePtr;
@@ -1662,6 +1691,13 @@ OS_MSG_QTY    OSQFlush                  (OS_Q                  *p_q,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_Q_COALESCE_EN == DEF_ENABLED)
+void          OSQCoalesceSet            (OS_Q                  *p_q,
+                                         OS_MSG_QTY             nbr,
+                                         OS_TICK                hold,
+                                         OS_ERR                *p_err);
+#endif
+
 void         *OSQPend                   (OS_Q                  *p_q,
                                          OS_TICK                timeout,
                                          OS_OPT                 opt,
@@ -1681,10 +1717,26 @@ void          OSQPost                   (OS_Q                  *p_q,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED)
+void          OSQPostTimeout            (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         OS_TICK                timeout,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_QClr                   (OS_Q                  *p_q);
 
+void          OS_QPost                  (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         OS_TICK                timeout,
+                                         OS_ERR                *p_err);
+
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
 void          OS_QDbgListAdd            (OS_Q                  *p_q);
 
@@ -1776,6 +1828,13 @@ void          OSTaskDel                 (OS_TCB                *p_tcb,
 #endif
 
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
+#if (OS_CFG_TASK_Q_COALESCE_EN == DEF_ENABLED)
+void          OSTaskQCoalesceSet        (OS_TCB                *p_tcb,
+                                         OS_MSG_QTY             nbr,
+                                         OS_TICK                hold,
+                                         OS_ERR                *p_err);
+#endif
+
 OS_MSG_QTY    OSTaskQFlush              (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 
@@ -1795,6 +1854,15 @@ void          OSTaskQPost               (OS_TCB                *p_tcb,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED)
+void          OSTaskQPostTimeout        (OS_TCB                *p_tcb,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         OS_TICK                timeout,
+                                         OS_ERR                *p_err);
+#endif
+
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -1873,6 +1941,15 @@ void          OS_TaskInit               (OS_ERR                *p_err);
 
 void          OS_TaskInitTCB            (OS_TCB                *p_tcb);
 
+#if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
+void          OS_TaskQPost              (OS_TCB                *p_tcb,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         OS_TICK                timeout,
+                                         OS_ERR                *p_err);
+#endif
+
 void          OS_TaskReturn             (void);
 
 #if (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED)
@@ -2129,12 +2206,41 @@ void          OS_MsgQPut                (OS_MSG_Q              *p_msg_q,
                                          CPU_TS                 ts,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED) || (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED)
+CPU_BOOLEAN   OS_MsgQSpaceRdy           (OS_PEND_OBJ           *p_obj,
+                                         OS_MSG_QTY             nbr_free);
+
+OS_OBJ_QTY    OS_MsgQSpaceAbort         (OS_PEND_OBJ           *p_obj,
+                                         CPU_TS                 ts,
+                                         OS_STATUS              reason);
+
+CPU_BOOLEAN   OS_MsgQSpaceWoken         (OS_TICK               *p_timeout,
+                                         OS_TICK                tick_start,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_Q_COALESCE_EN == DEF_ENABLED) || (OS_CFG_TASK_Q_COALESCE_EN == DEF_ENABLED)
+CPU_BOOLEAN   OS_MsgQCoalescePost       (OS_MSG_Q              *p_msg_q,
+                                         OS_PEND_OBJ           *p_obj,
+                                         OS_TCB                *p_tcb,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_MSG_QTY             nbr,
+                                         OS_TICK                hold);
+#endif
+
 /* ---------------------------------------------- PEND/POST MANAGEMENT ---------------------------------------------- */
 
 void          OS_Pend                   (OS_PEND_OBJ           *p_obj,
                                          OS_STATE               pending_on,
                                          OS_TICK                timeout);
 
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+void          OS_PendSpinLearn          (CPU_TS                 ts_start);
+#endif
+
 void          OS_PendAbort              (OS_TCB                *p_tcb,
                                          CPU_TS                 ts,
                                          OS_STATUS              reason);
@@ -2263,6 +2369,16 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #endif
 
 
+#ifndef OS_CFG_PEND_SPIN_EN
+#error  "OS_CFG.H, Missing OS_CFG_PEND_SPIN_EN: Include code for OS_OPT_PEND_SPIN"
+#else
+#if    (OS_CFG_PEND_SPIN_EN == DEF_ENABLED) && \
+       (OS_CFG_TS_EN        == DEF_DISABLED)
+#error  "OS_CFG.H, OS_CFG_TS_EN must be Enabled (1) to use OS_OPT_PEND_SPIN"
+#endif
+#endif
+
+
 #if     OS_CFG_PRIO_MAX < 8u
 #error  "OS_CFG.H,         OS_CFG_PRIO_MAX must be >= 8"
 #endif
@@ -2366,6 +2482,14 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
     #ifndef OS_CFG_Q_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_Q_PEND_ABORT_EN: Include code for OSQPendAbort()"
     #endif
+
+    #ifndef OS_CFG_Q_POST_BLOCKING_EN
+    #error  "OS_CFG.H, Missing OS_CFG_Q_POST_BLOCKING_EN: Include code for OS_OPT_POST_BLOCKING on message queues"
+    #endif
+
+    #ifndef OS_CFG_Q_COALESCE_EN
+    #error  "OS_CFG.H, Missing OS_CFG_Q_COALESCE_EN: Include code for OS_OPT_PEND_COALESCE on message queues"
+    #endif
 #endif
 
 /*
@@ -2420,6 +2544,14 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_TASK_Q_PEND_ABORT_EN: Include code for OSTaskQPendAbort()"
 #endif
 
+#ifndef OS_CFG_TASK_Q_POST_BLOCKING_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_Q_POST_BLOCKING_EN: Include code for OS_OPT_POST_BLOCKING on task queues"
+#endif
+
+#ifndef OS_CFG_TASK_Q_COALESCE_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_Q_COALESCE_EN: Include code for OS_OPT_PEND_COALESCE on task queues"
+#endif
+
 #ifndef OS_CFG_TASK_PROFILE_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_PROFILE_EN: Include code for task profiling"
 #else
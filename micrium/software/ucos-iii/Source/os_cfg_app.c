@@ -147,6 +147,12 @@ CPU_INT32U     const  OSCfg_StatTaskStkSizeRAM   =            0u;
 
 CPU_STK_SIZE   const  OSCfg_StkSizeMin           =  OS_CFG_STK_SIZE_MIN;
 
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+CPU_INT32U     const  OSCfg_PendSpinMax_us       =  OS_CFG_PEND_SPIN_MAX_US;
+#else
+CPU_INT32U     const  OSCfg_PendSpinMax_us       =            0u;
+#endif
+
 
 #if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
 OS_PRIO        const  OSCfg_TickTaskPrio         =  OS_CFG_TICK_TASK_PRIO;
@@ -269,6 +275,8 @@ void  OSCfg_Init (void)
 
     (void)OSCfg_StkSizeMin;
 
+    (void)OSCfg_PendSpinMax_us;
+
     (void)OSCfg_TickRate_Hz;
     (void)OSCfg_TickTaskPrio;
     (void)OSCfg_TickTaskStkBasePtr;
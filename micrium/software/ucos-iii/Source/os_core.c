@@ -1037,6 +1037,55 @@ void  OS_Pend (OS_PEND_OBJ  *p_obj,
 }
 
 
+/*
+************************************************************************************************************************
+*                                           LEARN THE SPIN-THEN-BLOCK BUDGET
+*
+* Description: This function is called by OSQPend(), OSSemPend() and OSTaskQPend() at the end of a pend with
+*              OS_OPT_PEND_SPIN that found the object empty.  The time waited is added to an average kept in the
+*              current task's TCB, and the time the task will poll the object before blocking next time is set to twice
+*              that average.  When the average wait goes over half of OS_CFG_PEND_SPIN_MAX_US, the budget drops to 0
+*              and the task blocks right away: polling only pays off when the next post is expected soon.
+*
+* Arguments  : ts_start       is the timestamp taken when the pend found the object empty
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Waits are capped at 4 times the maximum budget so that a single long wait doesn't stop the task
+*                 from spinning for long.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+void  OS_PendSpinLearn (CPU_TS  ts_start)
+{
+    CPU_TS           wait;
+    CPU_TS           avg;
+    CPU_TS           max;
+    CPU_TS_TMR_FREQ  freq;
+    CPU_ERR          err;
+
+
+    freq = CPU_TS_TmrFreqGet(&err);                             /* Maximum budget in CPU_TS counts                      */
+    max  = (CPU_TS)(((CPU_INT64U)OSCfg_PendSpinMax_us * freq) / 1000000u);
+    wait = OS_TS_GET() - ts_start;
+    if (wait > (max * 4u)) {
+        wait = max * 4u;
+    }
+    avg  = OSTCBCurPtr->PendSpinAvg;                            /* Average over the last 8 waits or so                  */
+    avg  = (avg - (avg >> 3u)) + (wait >> 3u);
+    OSTCBCurPtr->PendSpinAvg = avg;
+    if (avg <= (max / 2u)) {
+        OSTCBCurPtr->PendSpinBudget = avg * 2u;
+    } else {
+        OSTCBCurPtr->PendSpinBudget = 0u;
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                    CANCEL PENDING
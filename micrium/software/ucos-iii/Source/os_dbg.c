@@ -111,6 +111,7 @@ CPU_INT08U  const  OSDbg_ObjTypeChkEn          = OS_CFG_OBJ_TYPE_CHK_EN;
 
 CPU_INT16U  const  OSDbg_PendListSize          = sizeof(OS_PEND_LIST);
 CPU_INT16U  const  OSDbg_PendObjSize           = sizeof(OS_PEND_OBJ);
+CPU_INT08U  const  OSDbg_PendSpinEn            = OS_CFG_PEND_SPIN_EN;
 
 
 CPU_INT16U  const  OSDbg_PrioMax               = OS_CFG_PRIO_MAX;              /* Maximum number of priorities        */
@@ -125,11 +126,15 @@ CPU_INT08U  const  OSDbg_QEn                   = OS_CFG_Q_EN;
 CPU_INT08U  const  OSDbg_QDelEn                = OS_CFG_Q_DEL_EN;
 CPU_INT08U  const  OSDbg_QFlushEn              = OS_CFG_Q_FLUSH_EN;
 CPU_INT08U  const  OSDbg_QPendAbortEn          = OS_CFG_Q_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_QPostBlockingEn       = OS_CFG_Q_POST_BLOCKING_EN;
+CPU_INT08U  const  OSDbg_QCoalesceEn           = OS_CFG_Q_COALESCE_EN;
 CPU_INT16U  const  OSDbg_QSize                 = sizeof(OS_Q);                 /* Size in bytes of OS_Q structure     */
 #else
 CPU_INT08U  const  OSDbg_QDelEn                = 0u;
 CPU_INT08U  const  OSDbg_QFlushEn              = 0u;
 CPU_INT08U  const  OSDbg_QPendAbortEn          = 0u;
+CPU_INT08U  const  OSDbg_QPostBlockingEn       = 0u;
+CPU_INT08U  const  OSDbg_QCoalesceEn           = 0u;
 CPU_INT16U  const  OSDbg_QSize                 = 0u;
 #endif
 
@@ -164,6 +169,8 @@ CPU_INT08U  const  OSDbg_TaskChangePrioEn      = OS_CFG_TASK_CHANGE_PRIO_EN;
 CPU_INT08U  const  OSDbg_TaskDelEn             = OS_CFG_TASK_DEL_EN;
 CPU_INT08U  const  OSDbg_TaskQEn               = OS_CFG_TASK_Q_EN;
 CPU_INT08U  const  OSDbg_TaskQPendAbortEn      = OS_CFG_TASK_Q_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_TaskQPostBlockingEn   = OS_CFG_TASK_Q_POST_BLOCKING_EN;
+CPU_INT08U  const  OSDbg_TaskQCoalesceEn       = OS_CFG_TASK_Q_COALESCE_EN;
 CPU_INT08U  const  OSDbg_TaskProfileEn         = OS_CFG_TASK_PROFILE_EN;
 CPU_INT16U  const  OSDbg_TaskRegTblSize        = OS_CFG_TASK_REG_TBL_SIZE;
 CPU_INT08U  const  OSDbg_TaskSemPendAbortEn    = OS_CFG_TASK_SEM_PEND_ABORT_EN;
@@ -437,6 +444,7 @@ void  OS_Dbg_Init (void)
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_PendListSize;
     p_temp16 = (CPU_INT16U const *)&OSDbg_PendObjSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_PendSpinEn;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_PrioMax;
     p_temp16 = (CPU_INT16U const *)&OSDbg_PrioTblSize;
@@ -449,6 +457,8 @@ void  OS_Dbg_Init (void)
     p_temp08 = (CPU_INT08U const *)&OSDbg_QDelEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_QFlushEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_QPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_QPostBlockingEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_QCoalesceEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_QSize;
 #endif
 
@@ -475,6 +485,8 @@ void  OS_Dbg_Init (void)
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskDelEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskQEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskQPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskQPostBlockingEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskQCoalesceEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskProfileEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_TaskRegTblSize;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskSemPendAbortEn;
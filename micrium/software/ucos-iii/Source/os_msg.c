@@ -355,4 +355,295 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
 #endif
    *p_err          = OS_ERR_NONE;
 }
+
+/*
+************************************************************************************************************************
+*                                        READY TASKS WAITING FOR SPACE IN A QUEUE
+*
+* Description: This function is called when messages are removed from a queue to ready the producers that are blocked
+*              on the queue's 'space available' wait list (OS_OPT_POST_BLOCKING).
+*
+* Arguments  : p_obj       is a pointer to the wait list of the producers (OS_Q.PostPendObj or OS_TCB.MsgQPostPendObj)
+*              -----
+*
+*              nbr_free    is the number of entries that were freed.  At most that many producers are readied, highest
+*                          priority first.
+*
+* Returns    : DEF_TRUE    if at least one task was readied (the caller should run the scheduler)
+*              DEF_FALSE   otherwise
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+*
+*              3) A readied producer retries its post.  If another task filled the queue in the meantime, the producer
+*                 blocks again for the rest of its timeout.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED) || (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED)
+CPU_BOOLEAN  OS_MsgQSpaceRdy (OS_PEND_OBJ  *p_obj,
+                              OS_MSG_QTY    nbr_free)
+{
+    OS_TCB       *p_tcb;
+    CPU_BOOLEAN   rdy;
+
+
+    rdy = DEF_FALSE;
+    while ((nbr_free > 0u) &&
+           (p_obj->PendList.HeadPtr != (OS_TCB *)0)) {          /* The pend list is sorted by priority                  */
+        p_tcb = p_obj->PendList.HeadPtr;
+        OS_Post(p_obj,
+                p_tcb,
+                (void *)0,
+                0u,
+                0u);
+        nbr_free--;
+        rdy = DEF_TRUE;
+    }
+    return (rdy);
+}
+
+
+/*
+************************************************************************************************************************
+*                                     ABORT TASKS WAITING FOR SPACE IN A QUEUE
+*
+* Description: This function is called when a queue (or the task owning a task queue) is deleted, to ready all the
+*              producers that are blocked on its 'space available' wait list.
+*
+* Arguments  : p_obj       is a pointer to the wait list of the producers
+*              -----
+*
+*              ts          is the timestamp returned to the producers
+*
+*              reason      is the pend status given to the producers (OS_STATUS_PEND_DEL or OS_STATUS_PEND_ABORT)
+*
+* Returns    : The number of tasks readied
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OS_MsgQSpaceAbort (OS_PEND_OBJ  *p_obj,
+                               CPU_TS        ts,
+                               OS_STATUS     reason)
+{
+    OS_OBJ_QTY  nbr_tasks;
+
+
+    nbr_tasks = 0u;
+    while (p_obj->PendList.HeadPtr != (OS_TCB *)0) {
+        OS_PendAbort(p_obj->PendList.HeadPtr,
+                     ts,
+                     reason);
+        nbr_tasks++;
+    }
+    return (nbr_tasks);
+}
+
+
+/*
+************************************************************************************************************************
+*                                    CHECK WHY A PRODUCER WAITING FOR SPACE WAS READIED
+*
+* Description: This function is called by a producer that blocked on a full queue, once it runs again, to find out
+*              whether it should retry its post.
+*
+* Arguments  : p_timeout   is a pointer to the timeout of the post.  On a retry, it is reduced by the time already
+*              ---------   spent waiting so that the total wait does not exceed the timeout given by the caller.
+*
+*              tick_start  is the value of OSTickCtr when the producer blocked
+*
+*              p_err       is a pointer to a variable that will receive the error code when no retry is possible:
+*
+*                              OS_ERR_OBJ_DEL         the queue (or the task owning the task queue) was deleted
+*                              OS_ERR_PEND_ABORT      the wait was aborted
+*                              OS_ERR_STATUS_INVALID  the pend status is invalid
+*                              OS_ERR_TIMEOUT         no space became available within the timeout
+*
+* Returns    : DEF_TRUE    if space was freed and the post must be retried
+*              DEF_FALSE   otherwise
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_MsgQSpaceWoken (OS_TICK  *p_timeout,
+                                OS_TICK   tick_start,
+                                OS_ERR   *p_err)
+{
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+    OS_TICK  elapsed;
+#else
+    (void)tick_start;
+#endif
+
+
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Space was freed by a consumer                        */
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+             if (*p_timeout != 0u) {                            /* Charge the time already spent waiting                */
+                 elapsed = OSTickCtr - tick_start;
+                 if (elapsed < *p_timeout) {
+                    *p_timeout -= elapsed;
+                 } else {
+                    *p_timeout  = 1u;                           /* Out of time: wait at most one more tick              */
+                 }
+             }
+#endif
+            *p_err = OS_ERR_NONE;
+             return (DEF_TRUE);
+
+        case OS_STATUS_PEND_ABORT:
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    return (DEF_FALSE);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        HOLD BACK A MESSAGE FOR A COALESCING TASK
+*
+* Description: This function is called by OS_QPost() and OS_TaskQPost() when the task that would receive the message
+*              pends with OS_OPT_PEND_COALESCE.  The message is placed in the queue instead of being handed to the
+*              task, and the task is only readied once 'nbr' messages are queued.  The first message held back starts
+*              the hold time: the task's timeout is shortened to 'hold' ticks so that it wakes up and collects the
+*              messages even if the threshold is never reached.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue
+*
+*              p_obj       is a pointer to the object posted to (NULL for a task queue)
+*
+*              p_tcb       is a pointer to the TCB of the pending task
+*
+*              p_void      is a pointer to the message
+*
+*              msg_size    is the size of the message (in bytes)
+*
+*              opt         specifies whether the message is placed in FIFO or LIFO order
+*
+*              ts          is the timestamp of the post
+*
+*              nbr         is the number of queued messages that wakes up the task
+*
+*              hold        is the maximum number of ticks a message is held back (0 means no limit)
+*
+* Returns    : DEF_TRUE    if the task was readied
+*              DEF_FALSE   if the message was only queued
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+*
+*              3) If the message cannot be queued, it is handed to the task right away.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_COALESCE_EN == DEF_ENABLED) || (OS_CFG_TASK_Q_COALESCE_EN == DEF_ENABLED)
+CPU_BOOLEAN  OS_MsgQCoalescePost (OS_MSG_Q     *p_msg_q,
+                                  OS_PEND_OBJ  *p_obj,
+                                  OS_TCB       *p_tcb,
+                                  void         *p_void,
+                                  OS_MSG_SIZE   msg_size,
+                                  OS_OPT        opt,
+                                  CPU_TS        ts,
+                                  OS_MSG_QTY    nbr,
+                                  OS_TICK       hold)
+{
+    OS_ERR   err;
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+    OS_TCB  *p_tcb1;
+    OS_TICK  remain;
+#else
+    (void)hold;
+#endif
+
+
+    OS_MsgQPut(p_msg_q,                                         /* Hold the message back in the queue                   */
+               p_void,
+               msg_size,
+               opt,
+               ts,
+              &err);
+    if (err != OS_ERR_NONE) {                                   /* Can't hold it back: deliver it now                   */
+        OS_Post(p_obj,
+                p_tcb,
+                p_void,
+                msg_size,
+                ts);
+        return (DEF_TRUE);
+    }
+
+    if (p_msg_q->NbrEntries >= nbr) {                           /* Threshold reached: give the oldest message to task   */
+        p_void = OS_MsgQGet(p_msg_q,
+                           &msg_size,
+                           &ts,
+                           &err);
+        OS_Post(p_obj,
+                p_tcb,
+                p_void,
+                msg_size,
+                ts);
+        return (DEF_TRUE);
+    }
+
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+    if ((p_msg_q->NbrEntries == 1u) &&                          /* First message held back: start the hold time         */
+        (hold            > 0u)) {
+#if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
+        hold += BSP_OS_TickGet() - OSTickCtr;
+#endif
+        switch (p_tcb->TaskState) {
+            case OS_TASK_STATE_PEND_TIMEOUT:
+            case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+                 remain = 0u;                                   /* Timeout left is the sum of the deltas up to the task */
+                 p_tcb1 = p_tcb;
+                 while (p_tcb1 != (OS_TCB *)0) {
+                     remain += p_tcb1->TickRemain;
+                     p_tcb1  = p_tcb1->TickPrevPtr;
+                 }
+                 if (remain > hold) {                           /* Shorten the timeout to the hold time                 */
+                     OS_TickListRemove(p_tcb);
+                     OS_TickListInsert(&OSTickListTimeout, p_tcb, hold);
+                 }
+                 break;
+
+            case OS_TASK_STATE_PEND:
+                 OS_TickListInsert(&OSTickListTimeout, p_tcb, hold);
+                 p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT;
+                 break;
+
+            case OS_TASK_STATE_PEND_SUSPENDED:
+                 OS_TickListInsert(&OSTickListTimeout, p_tcb, hold);
+                 p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED;
+                 break;
+
+            default:
+                 break;
+        }
+    }
+#endif
+    return (DEF_FALSE);
+}
+#endif
 #endif
@@ -123,6 +123,19 @@ void  OSQCreate (OS_Q        *p_q,
     OS_MsgQInit(&p_q->MsgQ,                                     /* Initialize the queue                                 */
                 max_qty);
     OS_PendListInit(&p_q->PendList);                            /* Initialize the waiting list                          */
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED)
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    p_q->PostPendObj.Type    = OS_OBJ_TYPE_Q;
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_q->PostPendObj.NamePtr = p_name;
+#endif
+    OS_PendListInit(&p_q->PostPendObj.PendList);                /* Initialize the list of producers waiting for space   */
+#endif
+#if (OS_CFG_Q_COALESCE_EN == DEF_ENABLED)
+    p_q->CoalesceNbr  = 1u;                                     /* OS_OPT_PEND_COALESCE wakes on every message ...      */
+    p_q->CoalesceHold = 0u;                                     /* ... until OSQCoalesceSet() is called                 */
+#endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_QDbgListAdd(p_q);
@@ -237,7 +250,12 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
     nbr_tasks   = 0u;
     switch (opt) {
         case OS_OPT_DEL_NO_PEND:                                /* Delete message queue only if no task waiting         */
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED)
+             if ((p_pend_list->HeadPtr == (OS_TCB *)0) &&
+                 (p_q->PostPendObj.PendList.HeadPtr == (OS_TCB *)0)) {
+#else
              if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
                  OS_QDbgListRemove(p_q);
                  OSQQty--;
@@ -265,6 +283,11 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
                               OS_STATUS_PEND_DEL);
                  nbr_tasks++;
              }
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED)
+             nbr_tasks += OS_MsgQSpaceAbort(&p_q->PostPendObj,  /* Ready the producers waiting for space               */
+                                            ts,
+                                            OS_STATUS_PEND_DEL);
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
              OS_QDbgListRemove(p_q);
              OSQQty--;
@@ -359,6 +382,14 @@ OS_MSG_QTY  OSQFlush (OS_Q    *p_q,
 
     CPU_CRITICAL_ENTER();
     entries = OS_MsgQFreeAll(&p_q->MsgQ);                       /* Return all OS_MSGs to the OS_MSG pool                */
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED)
+    if (OS_MsgQSpaceRdy(&p_q->PostPendObj, entries) == DEF_TRUE) {
+        CPU_CRITICAL_EXIT();
+        OSSched();                                              /* Producers waiting for space were readied             */
+       *p_err = OS_ERR_NONE;
+        return (entries);
+    }
+#endif
     CPU_CRITICAL_EXIT();
    *p_err   = OS_ERR_NONE;
     return (entries);
@@ -366,6 +397,81 @@ OS_MSG_QTY  OSQFlush (OS_Q    *p_q,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                         SET THE WAKE-UP COALESCING OF A QUEUE
+*
+* Description: This function sets when a task pending on the queue with OS_OPT_PEND_COALESCE is woken up: once 'nbr'
+*              messages are queued or 'hold' ticks after the first of them was posted, whichever comes first.  This
+*              trades a bounded latency for fewer context switches when messages arrive in bursts.
+*
+* Arguments  : p_q        is a pointer to the message queue
+*
+*              nbr        is the number of queued messages that wakes up the task (1 wakes it up on every message).  It
+*                         is limited to the size of the queue.
+*
+*              hold       is the maximum amount of time (in clock ticks) a message is held back.  If 0, the task is only
+*                         woken up by the threshold or by the timeout of its pend.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE              The call was successful
+*                             OS_ERR_OBJ_PTR_NULL      If you pass a NULL pointer for 'p_q'
+*                             OS_ERR_OBJ_TYPE          If the message queue was not created
+*                             OS_ERR_Q_SIZE            If 'nbr' is 0
+*
+* Returns    : none
+*
+* Note(s)    : 1) The new setting applies to the next message posted to the queue.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_COALESCE_EN == DEF_ENABLED)
+void  OSQCoalesceSet (OS_Q        *p_q,
+                      OS_MSG_QTY   nbr,
+                      OS_TICK      hold,
+                      OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (nbr == 0u) {
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (nbr > p_q->MsgQ.NbrEntriesSize) {                       /* The queue must be able to hold the whole batch       */
+        nbr = p_q->MsgQ.NbrEntriesSize;
+    }
+    p_q->CoalesceNbr  = nbr;
+    p_q->CoalesceHold = hold;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                            PEND ON A QUEUE FOR A MESSAGE
@@ -384,6 +490,9 @@ OS_MSG_QTY  OSQFlush (OS_Q    *p_q,
 *                                OS_OPT_PEND_BLOCKING
 *                                OS_OPT_PEND_NON_BLOCKING
 *
+*                            OS_OPT_PEND_COALESCE can be added to OS_OPT_PEND_BLOCKING (see Note #1)
+*                            OS_OPT_PEND_SPIN     can be added to OS_OPT_PEND_BLOCKING (see Note #3)
+*
 *              p_msg_size    is a pointer to a variable that will receive the size of the message
 *
 *              p_ts          is a pointer to a variable that will receive the timestamp of when the message was
@@ -414,7 +523,16 @@ OS_MSG_QTY  OSQFlush (OS_Q    *p_q,
 *                            if 'p_q' is a NULL pointer or,
 *                            if you didn't pass a pointer to a queue.
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_OPT_PEND_COALESCE, a task that finds the queue empty is not woken up by every post: the
+*                 messages are held back in the queue until OSQCoalesceSet()'s threshold or hold time is reached.  The
+*                 task then receives the oldest message and should drain the others (they are returned immediately,
+*                 as long as the queue is not empty).  Only the highest priority task waiting is served this way, so
+*                 the option is meant for a queue with a single consumer.
+*
+*              2) A pend with a timeout of 0 can still return OS_ERR_TIMEOUT if the queue was flushed during the hold
+*                 time.
+*
+*              3) With OS_OPT_PEND_SPIN, a task that finds the queue empty polls it before blocking (see OSSemPend()).
 ************************************************************************************************************************
 */
 
@@ -425,7 +543,11 @@ void  *OSQPend (OS_Q         *p_q,
                 CPU_TS       *p_ts,
                 OS_ERR       *p_err)
 {
-    void  *p_void;
+    void        *p_void;
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+    CPU_BOOLEAN  spin;
+    CPU_TS       spin_start;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -468,7 +590,7 @@ void  *OSQPend (OS_Q         *p_q,
        *p_err = OS_ERR_PTR_INVALID;
         return ((void *)0);
     }
-    switch (opt) {
+    switch (opt & (OS_OPT)~(OS_OPT_PEND_COALESCE | OS_OPT_PEND_SPIN)) {
         case OS_OPT_PEND_BLOCKING:
         case OS_OPT_PEND_NON_BLOCKING:
              break;
@@ -494,13 +616,39 @@ void  *OSQPend (OS_Q         *p_q,
        *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
     }
 
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+    spin = DEF_FALSE;
+    if (((opt & OS_OPT_PEND_SPIN) != 0u) &&                     /* Poll the queue for a while before blocking           */
+        (p_q->MsgQ.NbrEntries == 0u)) {
+        spin       = DEF_TRUE;
+        spin_start = OS_TS_GET();
+        while ((p_q->MsgQ.NbrEntries == 0u) &&
+               ((CPU_TS)(OS_TS_GET() - spin_start) < OSTCBCurPtr->PendSpinBudget)) {
+            ;
+        }
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
     p_void = OS_MsgQGet(&p_q->MsgQ,                             /* Any message waiting in the message queue?            */
                         p_msg_size,
                         p_ts,
                         p_err);
     if (*p_err == OS_ERR_NONE) {
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+        if (spin == DEF_TRUE) {
+            OS_PendSpinLearn(spin_start);
+        }
+#endif
         OS_TRACE_Q_PEND(p_q);
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED)
+        if (OS_MsgQSpaceRdy(&p_q->PostPendObj, 1u) == DEF_TRUE) {
+            CPU_CRITICAL_EXIT();
+            OSSched();                                          /* A producer waiting for space was readied             */
+            OS_TRACE_Q_PEND_EXIT(OS_ERR_NONE);
+            return (p_void);
+        }
+#endif
         CPU_CRITICAL_EXIT();
         OS_TRACE_Q_PEND_EXIT(OS_ERR_NONE);
         return (p_void);                                        /* Yes, Return message received                         */
@@ -522,6 +670,11 @@ void  *OSQPend (OS_Q         *p_q,
         }
     }
 
+#if (OS_CFG_Q_COALESCE_EN == DEF_ENABLED)
+    if ((opt & OS_OPT_PEND_COALESCE) != 0u) {                   /* Let the posts batch the messages (see Note #1)       */
+        OSTCBCurPtr->MsgCoalesce = DEF_TRUE;
+    }
+#endif
     OS_Pend((OS_PEND_OBJ *)((void *)p_q),                       /* Block task pending on Message Queue                  */
             OS_TASK_PEND_ON_Q,
             timeout);
@@ -530,6 +683,35 @@ void  *OSQPend (OS_Q         *p_q,
     OSSched();                                                  /* Find the next highest priority task ready to run     */
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+    if (spin == DEF_TRUE) {                                     /* Adjust the spin budget to the time waited            */
+        OS_PendSpinLearn(spin_start);
+    }
+#endif
+#if (OS_CFG_Q_COALESCE_EN == DEF_ENABLED)
+    OSTCBCurPtr->MsgCoalesce = DEF_FALSE;
+    if ((OSTCBCurPtr->PendStatus == OS_STATUS_PEND_TIMEOUT) &&  /* Hold time over: take the oldest message held back   */
+        ((opt & OS_OPT_PEND_COALESCE) != 0u)) {
+        p_void = OS_MsgQGet(&p_q->MsgQ,
+                            p_msg_size,
+                            p_ts,
+                            p_err);
+        if (*p_err == OS_ERR_NONE) {
+            OS_TRACE_Q_PEND(p_q);
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED)
+            if (OS_MsgQSpaceRdy(&p_q->PostPendObj, 1u) == DEF_TRUE) {
+                CPU_CRITICAL_EXIT();
+                OSSched();                                      /* A producer waiting for space was readied             */
+                OS_TRACE_Q_PEND_EXIT(OS_ERR_NONE);
+                return (p_void);
+            }
+#endif
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_Q_PEND_EXIT(OS_ERR_NONE);
+            return (p_void);
+        }
+    }
+#endif
     switch (OSTCBCurPtr->PendStatus) {
         case OS_STATUS_PEND_OK:                                 /* Extract message from TCB (Put there by Post)         */
              p_void     = OSTCBCurPtr->MsgPtr;
@@ -738,10 +920,13 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
 *                                OS_OPT_POST_LIFO         POST message to the front of the queue (LIFO) and wake up
 *                                                         a single waiting task.
 *                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*                                OS_OPT_POST_BLOCKING     If the queue is full, wait until a task removes a message
+*                                                         (see OSQPostTimeout())
 *
 *                            Note(s): 1) OS_OPT_POST_NO_SCHED can be added (or OR'd) with one of the other options.
 *                                     2) OS_OPT_POST_ALL      can be added (or OR'd) with one of the other options.
-*                                     3) Possible combination of options are:
+*                                     3) OS_OPT_POST_BLOCKING can be added (or OR'd) with any of the combinations below.
+*                                     4) Possible combination of options are:
 *
 *                                        OS_OPT_POST_FIFO
 *                                        OS_OPT_POST_LIFO
@@ -756,15 +941,18 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
 *
 *                                OS_ERR_NONE              The call was successful and the message was sent
 *                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place the message into
+*                                OS_ERR_OBJ_DEL           If the queue was deleted while waiting for space
 *                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
 *                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
 *                                OS_ERR_OPT_INVALID       You specified an invalid option
 *                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
-*                                OS_ERR_Q_MAX             If the queue is full
+*                                OS_ERR_PEND_ISR          If OS_OPT_POST_BLOCKING is used from an ISR
+*                                OS_ERR_Q_MAX             If the queue is full (and OS_OPT_POST_BLOCKING is not used)
+*                                OS_ERR_SCHED_LOCKED      If the queue is full and the scheduler is locked
 *
 * Returns    : None
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_OPT_POST_BLOCKING, OSQPost() waits forever for space in the queue.
 ************************************************************************************************************************
 */
 
@@ -773,15 +961,155 @@ void  OSQPost (OS_Q         *p_q,
                OS_MSG_SIZE   msg_size,
                OS_OPT        opt,
                OS_ERR       *p_err)
+{
+    OS_QPost(p_q,
+             p_void,
+             msg_size,
+             opt,
+             0u,
+             p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                        POST MESSAGE TO A QUEUE WITH A TIMEOUT
+*
+* Description: This function sends a message to a queue like OSQPost().  If the queue is full and OS_OPT_POST_BLOCKING
+*              is specified, the calling task is placed on the queue's 'space available' wait list until a task removes
+*              a message from the queue or until the timeout expires.  This provides lossless flow control between a
+*              producer and its consumer.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_void        is a pointer to the message to send.
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              opt           determines the type of POST performed (see OSQPost()).  Add OS_OPT_POST_BLOCKING to wait
+*                            for space when the queue is full.
+*
+*              timeout       is the maximum amount of time (in clock ticks) to wait for space in the queue.  If 0, the
+*                            task waits forever.  The timeout is ignored without OS_OPT_POST_BLOCKING.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_TIMEOUT           If no space became available within the timeout
+*                                OS_ERR_PEND_ABORT        If the wait for space was aborted
+*
+*                            and the error codes of OSQPost().
+*
+* Returns    : None
+*
+* Note(s)    : 1) Producers are readied in priority order, one for each message removed from the queue.
+*
+*              2) Blocking only covers a full queue.  OS_ERR_MSG_POOL_EMPTY is still returned immediately when the
+*                 global pool of OS_MSGs is exhausted.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED)
+void  OSQPostTimeout (OS_Q         *p_q,
+                      void         *p_void,
+                      OS_MSG_SIZE   msg_size,
+                      OS_OPT        opt,
+                      OS_TICK       timeout,
+                      OS_ERR       *p_err)
+{
+    OS_QPost(p_q,
+             p_void,
+             msg_size,
+             opt,
+             timeout,
+             p_err);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        CLEAR THE CONTENTS OF A MESSAGE QUEUE
+*
+* Description: This function is called by OSQDel() to clear the contents of a message queue
+*
+
+* Argument(s): p_q      is a pointer to the queue to clear
+*              ---
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_QClr (OS_Q  *p_q)
+{
+    (void)OS_MsgQFreeAll(&p_q->MsgQ);                           /* Return all OS_MSGs to the free list                  */
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    p_q->Type    =  OS_OBJ_TYPE_NONE;                           /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_q->NamePtr = (CPU_CHAR *)((void *)"?Q");
+#endif
+    OS_MsgQInit(&p_q->MsgQ,                                     /* Initialize the list of OS_MSGs                       */
+                0u);
+    OS_PendListInit(&p_q->PendList);                            /* Initialize the waiting list                          */
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED)
+    OS_PendListInit(&p_q->PostPendObj.PendList);
+#endif
+#if (OS_CFG_Q_COALESCE_EN == DEF_ENABLED)
+    p_q->CoalesceNbr  = 1u;
+    p_q->CoalesceHold = 0u;
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                               POST MESSAGE TO A QUEUE
+*
+* Description: This function is called by OSQPost() and OSQPostTimeout() to send a message to a queue.
+*
+* Arguments  : p_q           is a pointer to a message queue
+*
+*              p_void        is a pointer to the message to send.
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              opt           determines the type of POST performed (see OSQPost())
+*
+*              timeout       is the maximum amount of time to wait for space with OS_OPT_POST_BLOCKING (0 = forever)
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+* Returns    : None
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_QPost (OS_Q         *p_q,
+                void         *p_void,
+                OS_MSG_SIZE   msg_size,
+                OS_OPT        opt,
+                OS_TICK       timeout,
+                OS_ERR       *p_err)
 {
     OS_OPT         post_type;
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     OS_TCB        *p_tcb_next;
     CPU_TS         ts;
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED)
+    OS_TICK        tick_start;
+#endif
     CPU_SR_ALLOC();
 
 
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_DISABLED)
+    (void)timeout;                                              /* Prevent compiler warning for not using 'timeout'     */
+#endif
+
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -806,7 +1134,11 @@ void  OSQPost (OS_Q         *p_q,
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return;
     }
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED)
+    switch (opt & (OS_OPT)~OS_OPT_POST_BLOCKING) {              /* Validate 'opt', OS_OPT_POST_BLOCKING can be added    */
+#else
     switch (opt) {                                              /* Validate 'opt'                                       */
+#endif
         case OS_OPT_POST_FIFO:
         case OS_OPT_POST_LIFO:
         case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
@@ -825,6 +1157,16 @@ void  OSQPost (OS_Q         *p_q,
     }
 #endif
 
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED) && (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (((opt & OS_OPT_POST_BLOCKING) != 0u) &&                 /* An ISR cannot wait for space in the queue            */
+        (OSIntNestingCtr > 0u)) {
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_PEND_ISR);
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
 #if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
     if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
         OS_TRACE_Q_POST_FAILED(p_q);
@@ -843,6 +1185,39 @@ void  OSQPost (OS_Q         *p_q,
 
     CPU_CRITICAL_ENTER();
     p_pend_list = &p_q->PendList;
+#if (OS_CFG_Q_POST_BLOCKING_EN == DEF_ENABLED)
+    while (((opt & OS_OPT_POST_BLOCKING) != 0u) &&              /* Wait while the queue is full and no task waits on it */
+           (p_pend_list->HeadPtr == (OS_TCB *)0) &&
+           (p_q->MsgQ.NbrEntries >= p_q->MsgQ.NbrEntriesSize)) {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't wait when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_Q_POST_FAILED(p_q);
+            OS_TRACE_Q_POST_EXIT(OS_ERR_SCHED_LOCKED);
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+        tick_start = OSTickCtr;
+#else
+        tick_start = 0u;
+#endif
+        OS_Pend(&p_q->PostPendObj,                              /* Block on the 'space available' wait list             */
+                OS_TASK_PEND_ON_Q_SPACE,
+                timeout);
+        CPU_CRITICAL_EXIT();
+        OSSched();                                              /* Find the next highest priority task ready to run     */
+        CPU_CRITICAL_ENTER();
+        if (OS_MsgQSpaceWoken(&timeout, tick_start, p_err) == DEF_FALSE) {
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_Q_POST_FAILED(p_q);
+            OS_TRACE_Q_POST_EXIT(*p_err);
+            return;
+        }
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        ts = OS_TS_GET();                                       /* The message is posted now                            */
+#endif
+    }
+#endif
     if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on message queue?                   */
         if ((opt & OS_OPT_POST_LIFO) == 0u) {                   /* Determine whether we post FIFO or LIFO               */
             post_type = OS_OPT_POST_FIFO;
@@ -861,6 +1236,26 @@ void  OSQPost (OS_Q         *p_q,
     }
 
     p_tcb = p_pend_list->HeadPtr;
+#if (OS_CFG_Q_COALESCE_EN == DEF_ENABLED)
+    if ((p_tcb->MsgCoalesce == DEF_TRUE) &&                     /* Does the consumer want the messages in batches?      */
+        ((opt & OS_OPT_POST_ALL) == 0u)) {
+        if (OS_MsgQCoalescePost(&p_q->MsgQ,
+                                (OS_PEND_OBJ *)((void *)p_q),
+                                p_tcb,
+                                p_void,
+                                msg_size,
+                                (OS_OPT)(opt & OS_OPT_POST_LIFO),
+                                ts,
+                                p_q->CoalesceNbr,
+                                p_q->CoalesceHold) == DEF_FALSE) {
+            CPU_CRITICAL_EXIT();                                /* Message held back until the batch is complete        */
+           *p_err = OS_ERR_NONE;
+            OS_TRACE_Q_POST_EXIT(*p_err);
+            return;
+        }
+        p_tcb = (OS_TCB *)0;                                    /* The consumer was readied                             */
+    }
+#endif
     while (p_tcb != (OS_TCB *)0) {
         p_tcb_next = p_tcb->PendNextPtr;
         OS_Post((OS_PEND_OBJ *)((void *)p_q),
@@ -885,37 +1280,6 @@ void  OSQPost (OS_Q         *p_q,
 }
 
 
-/*
-************************************************************************************************************************
-*                                        CLEAR THE CONTENTS OF A MESSAGE QUEUE
-*
-* Description: This function is called by OSQDel() to clear the contents of a message queue
-*
-
-* Argument(s): p_q      is a pointer to the queue to clear
-*              ---
-*
-* Returns    : none
-*
-* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
-************************************************************************************************************************
-*/
-
-void  OS_QClr (OS_Q  *p_q)
-{
-    (void)OS_MsgQFreeAll(&p_q->MsgQ);                           /* Return all OS_MSGs to the free list                  */
-#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
-    p_q->Type    =  OS_OBJ_TYPE_NONE;                           /* Mark the data structure as a NONE                    */
-#endif
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-    p_q->NamePtr = (CPU_CHAR *)((void *)"?Q");
-#endif
-    OS_MsgQInit(&p_q->MsgQ,                                     /* Initialize the list of OS_MSGs                       */
-                0u);
-    OS_PendListInit(&p_q->PendList);                            /* Initialize the waiting list                          */
-}
-
-
 /*
 ************************************************************************************************************************
 *                                      ADD/REMOVE MESSAGE QUEUE TO/FROM DEBUG LIST
@@ -306,6 +306,8 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
 *                                OS_OPT_PEND_BLOCKING
 *                                OS_OPT_PEND_NON_BLOCKING
 *
+*                            OS_OPT_PEND_SPIN can be added to OS_OPT_PEND_BLOCKING (see Note #1)
+*
 *              p_ts          is a pointer to a variable that will receive the timestamp of when the semaphore was posted
 *                            or pend aborted or the semaphore deleted.  If you pass a NULL pointer (i.e. (CPU_TS*)0)
 *                            then you will not get the timestamp.  In other words, passing a NULL pointer is valid
@@ -333,7 +335,9 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
 *
 * Returns    : The current value of the semaphore counter or 0 if not available.
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_OPT_PEND_SPIN, a task that finds the semaphore unavailable polls it before blocking.  The
+*                 polling time adapts to the recent waits of the task and never exceeds OS_CFG_PEND_SPIN_MAX_US (see
+*                 OS_PendSpinLearn()).  The other tasks of the same or lower priority don't run while the task polls.
 ************************************************************************************************************************
 */
 
@@ -343,7 +347,11 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
                        CPU_TS   *p_ts,
                        OS_ERR   *p_err)
 {
-    OS_SEM_CTR  ctr;
+    OS_SEM_CTR   ctr;
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+    CPU_BOOLEAN  spin;
+    CPU_TS       spin_start;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -383,7 +391,7 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return (0u);
     }
-    switch (opt) {                                              /* Validate 'opt'                                       */
+    switch (opt & (OS_OPT)~OS_OPT_PEND_SPIN) {                  /* Validate 'opt'                                       */
         case OS_OPT_PEND_BLOCKING:
         case OS_OPT_PEND_NON_BLOCKING:
              break;
@@ -405,10 +413,27 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
     }
 #endif
 
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+    spin = DEF_FALSE;
+    if (((opt & OS_OPT_PEND_SPIN) != 0u) &&                     /* Poll the semaphore for a while before blocking       */
+        (p_sem->Ctr == 0u)) {
+        spin       = DEF_TRUE;
+        spin_start = OS_TS_GET();
+        while ((p_sem->Ctr == 0u) &&
+               ((CPU_TS)(OS_TS_GET() - spin_start) < OSTCBCurPtr->PendSpinBudget)) {
+            ;
+        }
+    }
+#endif
 
     CPU_CRITICAL_ENTER();
     if (p_sem->Ctr > 0u) {                                      /* Resource available?                                  */
         p_sem->Ctr--;                                           /* Yes, caller may proceed                              */
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+        if (spin == DEF_TRUE) {
+            OS_PendSpinLearn(spin_start);
+        }
+#endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
         if (p_ts != (CPU_TS *)0) {
            *p_ts = p_sem->TS;                                   /* get timestamp of last post                           */
@@ -457,6 +482,11 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
     OSSched();                                                  /* Find the next highest priority task ready to run     */
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+    if (spin == DEF_TRUE) {                                     /* Adjust the spin budget to the time waited            */
+        OS_PendSpinLearn(spin_start);
+    }
+#endif
     switch (OSTCBCurPtr->PendStatus) {
         case OS_STATUS_PEND_OK:                                 /* We got the semaphore                                 */
 #if (OS_CFG_TS_EN == DEF_ENABLED)
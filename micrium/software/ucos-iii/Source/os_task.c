@@ -421,6 +421,9 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
     OS_MsgQInit(&p_tcb->MsgQ,                                   /* Initialize the task's message queue                  */
                 q_size);
+#if (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED) && (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_tcb->MsgQPostPendObj.NamePtr = p_name;
+#endif
 #else
     (void)q_size;
 #endif
@@ -571,6 +574,8 @@ void  OSTaskDel (OS_TCB  *p_tcb,
                  case OS_TASK_PEND_ON_FLAG:                     /* Remove from pend list                                */
                  case OS_TASK_PEND_ON_Q:
                  case OS_TASK_PEND_ON_SEM:
+                 case OS_TASK_PEND_ON_Q_SPACE:
+                 case OS_TASK_PEND_ON_TASK_Q_SPACE:
                       OS_PendListRemove(p_tcb);
                       break;
 
@@ -619,6 +624,17 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
     (void)OS_MsgQFreeAll(&p_tcb->MsgQ);                         /* Free task's message queue messages                   */
+#if (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED)
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    (void)OS_MsgQSpaceAbort(&p_tcb->MsgQPostPendObj,            /* Ready the tasks waiting for space in the task's queue*/
+                            OS_TS_GET(),
+                            OS_STATUS_PEND_DEL);
+#else
+    (void)OS_MsgQSpaceAbort(&p_tcb->MsgQPostPendObj,            /* Ready the tasks waiting for space in the task's queue*/
+                            0u,
+                            OS_STATUS_PEND_DEL);
+#endif
+#endif
 #endif
 
     OSTaskDelHook(p_tcb);                                       /* Call user defined hook                               */
@@ -648,6 +664,71 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                      SET THE WAKE-UP COALESCING OF A TASK's QUEUE
+*
+* Description: This function sets when a task pending on its queue with OS_OPT_PEND_COALESCE is woken up: once 'nbr'
+*              messages are queued or 'hold' ticks after the first of them was posted, whichever comes first.
+*
+* Arguments  : p_tcb       is a pointer to the task's OS_TCB.  Specifying a NULL pointer indicates that you wish to
+*                          set the coalescing of the calling task's queue.
+*
+*              nbr         is the number of queued messages that wakes up the task (1 wakes it up on every message).
+*                          It is limited to the size of the task's queue.
+*
+*              hold        is the maximum amount of time (in clock ticks) a message is held back.  If 0, the task is
+*                          only woken up by the threshold or by the timeout of its pend.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE              Upon success
+*                              OS_ERR_Q_SIZE            If 'nbr' is 0
+*
+* Returns    : none
+*
+* Note(s)    : 1) The new setting applies to the next message posted to the task.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN == DEF_ENABLED) && (OS_CFG_TASK_Q_COALESCE_EN == DEF_ENABLED)
+void  OSTaskQCoalesceSet (OS_TCB      *p_tcb,
+                          OS_MSG_QTY   nbr,
+                          OS_TICK      hold,
+                          OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (nbr == 0u) {                                            /* Validate 'nbr'                                       */
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Set coalescing of calling task's queue?              */
+        p_tcb = OSTCBCurPtr;
+    }
+    if (nbr > p_tcb->MsgQ.NbrEntriesSize) {                     /* The queue must be able to hold the whole batch       */
+        nbr = p_tcb->MsgQ.NbrEntriesSize;
+    }
+    p_tcb->MsgQCoalesceNbr  = nbr;
+    p_tcb->MsgQCoalesceHold = hold;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                    FLUSH TASK's QUEUE
@@ -709,6 +790,14 @@ OS_MSG_QTY  OSTaskQFlush (OS_TCB  *p_tcb,
 
     CPU_CRITICAL_ENTER();
     entries = OS_MsgQFreeAll(&p_tcb->MsgQ);                     /* Return all OS_MSGs to the OS_MSG pool                */
+#if (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED)
+    if (OS_MsgQSpaceRdy(&p_tcb->MsgQPostPendObj, entries) == DEF_TRUE) {
+        CPU_CRITICAL_EXIT();
+        OSSched();                                              /* Producers waiting for space were readied             */
+       *p_err = OS_ERR_NONE;
+        return (entries);
+    }
+#endif
     CPU_CRITICAL_EXIT();
    *p_err   = OS_ERR_NONE;
     return (entries);
@@ -731,6 +820,9 @@ OS_MSG_QTY  OSTaskQFlush (OS_TCB  *p_tcb,
 *                                OS_OPT_PEND_BLOCKING
 *                                OS_OPT_PEND_NON_BLOCKING
 *
+*                            OS_OPT_PEND_COALESCE can be added to OS_OPT_PEND_BLOCKING (see Note #2)
+*                            OS_OPT_PEND_SPIN     can be added to OS_OPT_PEND_BLOCKING (see Note #3)
+*
 *              p_msg_size    is a pointer to a variable that will receive the size of the message
 *
 *              p_ts          is a pointer to a variable that will receive the timestamp of when the message was
@@ -755,6 +847,13 @@ OS_MSG_QTY  OSTaskQFlush (OS_TCB  *p_tcb,
 * Returns    : A pointer to the message received or a NULL pointer upon error.
 *
 * Note(s)    : 1) It is possible to receive NULL pointers when there are no errors.
+*
+*              2) With OS_OPT_PEND_COALESCE, a task that finds its queue empty is not woken up by every post: the
+*                 messages are held back in the queue until OSTaskQCoalesceSet()'s threshold or hold time is reached.
+*                 The task then receives the oldest message and drains the others with its next calls, which return
+*                 immediately as long as the queue is not empty.
+*
+*              3) With OS_OPT_PEND_SPIN, a task that finds its queue empty polls it before blocking (see OSSemPend()).
 ************************************************************************************************************************
 */
 
@@ -765,8 +864,12 @@ void  *OSTaskQPend (OS_TICK       timeout,
                     CPU_TS       *p_ts,
                     OS_ERR       *p_err)
 {
-    OS_MSG_Q  *p_msg_q;
-    void      *p_void;
+    OS_MSG_Q     *p_msg_q;
+    void         *p_void;
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+    CPU_BOOLEAN   spin;
+    CPU_TS        spin_start;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -802,7 +905,7 @@ void  *OSTaskQPend (OS_TICK       timeout,
        *p_err = OS_ERR_PTR_INVALID;
         return ((void *)0);
     }
-    switch (opt) {                                              /* User must supply a valid option                      */
+    switch (opt & (OS_OPT)~(OS_OPT_PEND_COALESCE | OS_OPT_PEND_SPIN)) {
         case OS_OPT_PEND_BLOCKING:
         case OS_OPT_PEND_NON_BLOCKING:
              break;
@@ -818,6 +921,19 @@ void  *OSTaskQPend (OS_TICK       timeout,
        *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
     }
 
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+    spin = DEF_FALSE;
+    if (((opt & OS_OPT_PEND_SPIN) != 0u) &&                     /* Poll the queue for a while before blocking           */
+        (OSTCBCurPtr->MsgQ.NbrEntries == 0u)) {
+        spin       = DEF_TRUE;
+        spin_start = OS_TS_GET();
+        while ((OSTCBCurPtr->MsgQ.NbrEntries == 0u) &&
+               ((CPU_TS)(OS_TS_GET() - spin_start) < OSTCBCurPtr->PendSpinBudget)) {
+            ;
+        }
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
     p_msg_q = &OSTCBCurPtr->MsgQ;                               /* Any message waiting in the message queue?            */
     p_void  = OS_MsgQGet(p_msg_q,
@@ -825,6 +941,11 @@ void  *OSTaskQPend (OS_TICK       timeout,
                          p_ts,
                          p_err);
     if (*p_err == OS_ERR_NONE) {
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+        if (spin == DEF_TRUE) {
+            OS_PendSpinLearn(spin_start);
+        }
+#endif
 #if (OS_CFG_TASK_PROFILE_EN == DEF_ENABLED)
 #if (OS_CFG_TS_EN == DEF_ENABLED)
         if (p_ts != (CPU_TS *)0) {
@@ -836,6 +957,14 @@ void  *OSTaskQPend (OS_TICK       timeout,
 #endif
 #endif
         OS_TRACE_TASK_MSG_Q_PEND(p_msg_q);
+#if (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED)
+        if (OS_MsgQSpaceRdy(&OSTCBCurPtr->MsgQPostPendObj, 1u) == DEF_TRUE) {
+            CPU_CRITICAL_EXIT();
+            OSSched();                                          /* A producer waiting for space was readied             */
+            OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_NONE);
+            return (p_void);
+        }
+#endif
         CPU_CRITICAL_EXIT();
         OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_NONE);
         return (p_void);                                        /* Yes, Return oldest message received                  */
@@ -857,6 +986,11 @@ void  *OSTaskQPend (OS_TICK       timeout,
         }
     }
 
+#if (OS_CFG_TASK_Q_COALESCE_EN == DEF_ENABLED)
+    if ((opt & OS_OPT_PEND_COALESCE) != 0u) {                   /* Let the posts batch the messages (see Note #2)       */
+        OSTCBCurPtr->MsgCoalesce = DEF_TRUE;
+    }
+#endif
     OS_Pend((OS_PEND_OBJ *)0,                                   /* Block task pending on Message                        */
              OS_TASK_PEND_ON_TASK_Q,
              timeout);
@@ -865,6 +999,35 @@ void  *OSTaskQPend (OS_TICK       timeout,
     OSSched();                                                  /* Find the next highest priority task ready to run     */
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+    if (spin == DEF_TRUE) {                                     /* Adjust the spin budget to the time waited            */
+        OS_PendSpinLearn(spin_start);
+    }
+#endif
+#if (OS_CFG_TASK_Q_COALESCE_EN == DEF_ENABLED)
+    OSTCBCurPtr->MsgCoalesce = DEF_FALSE;
+    if ((OSTCBCurPtr->PendStatus == OS_STATUS_PEND_TIMEOUT) &&  /* Hold time over: take the oldest message held back   */
+        ((opt & OS_OPT_PEND_COALESCE) != 0u)) {
+        p_void = OS_MsgQGet(p_msg_q,
+                            p_msg_size,
+                            p_ts,
+                            p_err);
+        if (*p_err == OS_ERR_NONE) {
+            OS_TRACE_TASK_MSG_Q_PEND(p_msg_q);
+#if (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED)
+            if (OS_MsgQSpaceRdy(&OSTCBCurPtr->MsgQPostPendObj, 1u) == DEF_TRUE) {
+                CPU_CRITICAL_EXIT();
+                OSSched();                                      /* A producer waiting for space was readied             */
+                OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_NONE);
+                return (p_void);
+            }
+#endif
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_NONE);
+            return (p_void);
+        }
+    }
+#endif
     switch (OSTCBCurPtr->PendStatus) {
         case OS_STATUS_PEND_OK:                                 /* Extract message from TCB (Put there by Post)         */
              p_void      = OSTCBCurPtr->MsgPtr;
@@ -1041,8 +1204,11 @@ CPU_BOOLEAN  OSTaskQPendAbort (OS_TCB  *p_tcb,
 *                             OS_OPT_POST_LIFO       Post at the front of the queue
 *
 *                             OS_OPT_POST_NO_SCHED   Do not run the scheduler after the post
+*                             OS_OPT_POST_BLOCKING   If the task's queue is full, wait until the task removes a message
+*                                                    (see OSTaskQPostTimeout())
 *
 *                          Note(s): 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
+*                                   2) OS_OPT_POST_BLOCKING can be added with one of the other options.
 *
 *
 *              p_err      is a pointer to a variable that will hold the error code associated
@@ -1050,15 +1216,18 @@ CPU_BOOLEAN  OSTaskQPendAbort (OS_TCB  *p_tcb,
 *
 *                             OS_ERR_NONE              The call was successful and the message was sent
 *                             OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs available from the pool
+*                             OS_ERR_OBJ_DEL           If the task was deleted while waiting for space in its queue
 *                             OS_ERR_OPT_INVALID       If you specified an invalid option
 *                             OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
-*                             OS_ERR_Q_MAX             If the queue is full
+*                             OS_ERR_PEND_ISR          If OS_OPT_POST_BLOCKING is used from an ISR
+*                             OS_ERR_Q_MAX             If the queue is full (and OS_OPT_POST_BLOCKING is not used)
+*                             OS_ERR_SCHED_LOCKED      If the queue is full and the scheduler is locked
 *                             OS_ERR_STATE_INVALID     If the task is in an invalid state.  This should never happen
 *                                                      and if it does, would be considered a system failure
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_OPT_POST_BLOCKING, OSTaskQPost() waits forever for space in the task's queue.
 ************************************************************************************************************************
 */
 
@@ -1069,102 +1238,66 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
                    OS_OPT        opt,
                    OS_ERR       *p_err)
 {
-    CPU_TS  ts;
-    CPU_SR_ALLOC();
-
-
-#ifdef OS_SAFETY_CRITICAL
-    if (p_err == (OS_ERR *)0) {
-        OS_SAFETY_CRITICAL_EXCEPTION();
-        return;
-    }
-#endif
-
-    OS_TRACE_TASK_MSG_Q_POST_ENTER(&p_tcb->MsgQ, p_void, msg_size, opt);
-
-#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
-    if (OSRunning != OS_STATE_OS_RUNNING) {
-        OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
-       *p_err = OS_ERR_OS_NOT_RUNNING;
-        return;
-    }
-#endif
-
-#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
-    switch (opt) {                                              /* User must supply a valid option                      */
-        case OS_OPT_POST_FIFO:
-        case OS_OPT_POST_LIFO:
-        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
-        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
-             break;
-
-        default:
-             OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
-             OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OPT_INVALID);
-            *p_err = OS_ERR_OPT_INVALID;
-             return;
-    }
-#endif
-
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-    ts = OS_TS_GET();                                           /* Get timestamp                                        */
-#else
-    ts = 0u;
+    OS_TaskQPost(p_tcb,
+                 p_void,
+                 msg_size,
+                 opt,
+                 0u,
+                 p_err);
+}
 #endif
 
-    OS_TRACE_TASK_MSG_Q_POST(&p_tcb->MsgQ);
-
-   *p_err = OS_ERR_NONE;                                        /* Assume we won't have any errors                      */
-    CPU_CRITICAL_ENTER();
-    if (p_tcb == (OS_TCB *)0) {                                 /* Post msg to 'self'?                                  */
-        p_tcb = OSTCBCurPtr;
-    }
-    switch (p_tcb->TaskState) {
-        case OS_TASK_STATE_RDY:
-        case OS_TASK_STATE_DLY:
-        case OS_TASK_STATE_SUSPENDED:
-        case OS_TASK_STATE_DLY_SUSPENDED:
-             OS_MsgQPut(&p_tcb->MsgQ,                           /* Deposit the message in the queue                     */
-                        p_void,
-                        msg_size,
-                        opt,
-                        ts,
-                        p_err);
-             CPU_CRITICAL_EXIT();
-             break;
-
-        case OS_TASK_STATE_PEND:
-        case OS_TASK_STATE_PEND_TIMEOUT:
-        case OS_TASK_STATE_PEND_SUSPENDED:
-        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) {     /* Is task waiting for a message to be sent to it?      */
-                 OS_Post((OS_PEND_OBJ *)0,
-                          p_tcb,
-                          p_void,
-                          msg_size,
-                          ts);
-                 CPU_CRITICAL_EXIT();
-                 if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-                     OSSched();                                 /* Run the scheduler                                    */
-                 }
-             } else {
-                 OS_MsgQPut(&p_tcb->MsgQ,                       /* No,  Task is pending on something else ...           */
-                            p_void,                             /* ... Deposit the message in the task's queue          */
-                            msg_size,
-                            opt,
-                            ts,
-                            p_err);
-                 CPU_CRITICAL_EXIT();
-             }
-             break;
 
-        default:
-             CPU_CRITICAL_EXIT();
-            *p_err = OS_ERR_STATE_INVALID;
-             break;
-    }
+/*
+************************************************************************************************************************
+*                                        POST MESSAGE TO A TASK WITH A TIMEOUT
+*
+* Description: This function sends a message to a task like OSTaskQPost().  If the task's queue is full and
+*              OS_OPT_POST_BLOCKING is specified, the calling task is placed on the 'space available' wait list of the
+*              receiving task until it removes a message from its queue or until the timeout expires.
+*
+* Arguments  : p_tcb      is a pointer to the TCB of the task receiving a message (NULL for the calling task).
+*
+*              p_void     is a pointer to the message to send.
+*
+*              msg_size   is the size of the message sent (in bytes)
+*
+*              opt        specifies the type of post (see OSTaskQPost()).  Add OS_OPT_POST_BLOCKING to wait for space
+*                         when the queue is full.
+*
+*              timeout    is the maximum amount of time (in clock ticks) to wait for space in the queue.  If 0, the
+*                         task waits forever.  The timeout is ignored without OS_OPT_POST_BLOCKING.
+*
+*              p_err      is a pointer to a variable that will hold the error code associated
+*                         with the outcome of this call.  Errors can be:
+*
+*                             OS_ERR_TIMEOUT           If no space became available within the timeout
+*                             OS_ERR_PEND_ABORT        If the wait for space was aborted
+*
+*                         and the error codes of OSTaskQPost().
+*
+* Returns    : none
+*
+* Note(s)    : 1) Producers are readied in priority order, one for each message removed from the queue.
+*
+*              2) A task that posts to its own full queue with OS_OPT_POST_BLOCKING can only time out.
+************************************************************************************************************************
+*/
 
-    OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+#if (OS_CFG_TASK_Q_EN == DEF_ENABLED) && (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED)
+void  OSTaskQPostTimeout (OS_TCB       *p_tcb,
+                          void         *p_void,
+                          OS_MSG_SIZE   msg_size,
+                          OS_OPT        opt,
+                          OS_TICK       timeout,
+                          OS_ERR       *p_err)
+{
+    OS_TaskQPost(p_tcb,
+                 p_void,
+                 msg_size,
+                 opt,
+                 timeout,
+                 p_err);
 }
 #endif
 
@@ -2481,6 +2614,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->MsgPtr               = (void             *)0;
     p_tcb->MsgSize              =                     0u;
 #endif
+#if (OS_CFG_Q_COALESCE_EN == DEF_ENABLED) || (OS_CFG_TASK_Q_COALESCE_EN == DEF_ENABLED)
+    p_tcb->MsgCoalesce          =              DEF_FALSE;
+#endif
 
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
     OS_MsgQInit(&p_tcb->MsgQ,
@@ -2489,6 +2625,19 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->MsgQPendTime         =                     0u;
     p_tcb->MsgQPendTimeMax      =                     0u;
 #endif
+#if (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED)
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    p_tcb->MsgQPostPendObj.Type    = OS_OBJ_TYPE_NONE;
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_tcb->MsgQPostPendObj.NamePtr = (CPU_CHAR *)((void *)"?Task");
+#endif
+    OS_PendListInit(&p_tcb->MsgQPostPendObj.PendList);
+#endif
+#if (OS_CFG_TASK_Q_COALESCE_EN == DEF_ENABLED)
+    p_tcb->MsgQCoalesceNbr      =                     1u;
+    p_tcb->MsgQCoalesceHold     =                     0u;
+#endif
 #endif
 
 #if (OS_CFG_FLAG_EN == DEF_ENABLED)
@@ -2571,6 +2720,10 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->PendObjPtr           = (OS_PEND_OBJ      *)0;
     p_tcb->PendOn               =  OS_TASK_PEND_ON_NOTHING;
     p_tcb->PendStatus           =  OS_STATUS_PEND_OK;
+#if (OS_CFG_PEND_SPIN_EN == DEF_ENABLED)
+    p_tcb->PendSpinAvg          =                     0u;
+    p_tcb->PendSpinBudget       =                     0u;
+#endif
     p_tcb->TaskState            =  OS_TASK_STATE_RDY;
 
     p_tcb->Prio                 =  OS_PRIO_INIT;
@@ -2587,6 +2740,216 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 }
 
 
+/*
+************************************************************************************************************************
+*                                               POST MESSAGE TO A TASK
+*
+* Description: This function is called by OSTaskQPost() and OSTaskQPostTimeout() to send a message to a task.
+*
+* Arguments  : p_tcb      is a pointer to the TCB of the task receiving a message (NULL for the calling task).
+*
+*              p_void     is a pointer to the message to send.
+*
+*              msg_size   is the size of the message sent (in bytes)
+*
+*              opt        specifies the type of post (see OSTaskQPost())
+*
+*              timeout    is the maximum amount of time to wait for space with OS_OPT_POST_BLOCKING (0 = forever)
+*
+*              p_err      is a pointer to a variable that will hold the error code associated with the outcome of this
+*                         call.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
+void  OS_TaskQPost (OS_TCB       *p_tcb,
+                    void         *p_void,
+                    OS_MSG_SIZE   msg_size,
+                    OS_OPT        opt,
+                    OS_TICK       timeout,
+                    OS_ERR       *p_err)
+{
+    CPU_TS   ts;
+#if (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED)
+    OS_TICK  tick_start;
+#endif
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_DISABLED)
+    (void)timeout;                                              /* Prevent compiler warning for not using 'timeout'     */
+#endif
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_TRACE_TASK_MSG_Q_POST_ENTER(&p_tcb->MsgQ, p_void, msg_size, opt);
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+#if (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED)
+    switch (opt & (OS_OPT)~OS_OPT_POST_BLOCKING) {              /* User must supply a valid option                      */
+#else
+    switch (opt) {                                              /* User must supply a valid option                      */
+#endif
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
+             OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED) && (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (((opt & OS_OPT_POST_BLOCKING) != 0u) &&                 /* An ISR cannot wait for space in the queue            */
+        (OSIntNestingCtr > 0u)) {
+        OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_PEND_ISR);
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    OS_TRACE_TASK_MSG_Q_POST(&p_tcb->MsgQ);
+
+   *p_err = OS_ERR_NONE;                                        /* Assume we won't have any errors                      */
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Post msg to 'self'?                                  */
+        p_tcb = OSTCBCurPtr;
+    }
+#if (OS_CFG_TASK_Q_POST_BLOCKING_EN == DEF_ENABLED)
+    while (((opt & OS_OPT_POST_BLOCKING) != 0u) &&              /* Wait while the task isn't waiting for a message ...  */
+           (p_tcb->PendOn != OS_TASK_PEND_ON_TASK_Q) &&         /* ... and its queue is full                            */
+           (p_tcb->MsgQ.NbrEntries >= p_tcb->MsgQ.NbrEntriesSize)) {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't wait when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
+            OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_SCHED_LOCKED);
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+        tick_start = OSTickCtr;
+#else
+        tick_start = 0u;
+#endif
+        OS_Pend(&p_tcb->MsgQPostPendObj,                        /* Block on the 'space available' wait list             */
+                OS_TASK_PEND_ON_TASK_Q_SPACE,
+                timeout);
+        CPU_CRITICAL_EXIT();
+        OSSched();                                              /* Find the next highest priority task ready to run     */
+        CPU_CRITICAL_ENTER();
+        if (OS_MsgQSpaceWoken(&timeout, tick_start, p_err) == DEF_FALSE) {
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
+            OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+            return;
+        }
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        ts = OS_TS_GET();                                       /* The message is posted now                            */
+#endif
+    }
+#endif
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_RDY:
+        case OS_TASK_STATE_DLY:
+        case OS_TASK_STATE_SUSPENDED:
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             OS_MsgQPut(&p_tcb->MsgQ,                           /* Deposit the message in the queue                     */
+                        p_void,
+                        msg_size,
+                        opt,
+                        ts,
+                        p_err);
+             CPU_CRITICAL_EXIT();
+             break;
+
+        case OS_TASK_STATE_PEND:
+        case OS_TASK_STATE_PEND_TIMEOUT:
+        case OS_TASK_STATE_PEND_SUSPENDED:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) {     /* Is task waiting for a message to be sent to it?      */
+#if (OS_CFG_TASK_Q_COALESCE_EN == DEF_ENABLED)
+                 if (p_tcb->MsgCoalesce == DEF_TRUE) {          /* Does the task want its messages in batches?          */
+                     if (OS_MsgQCoalescePost(&p_tcb->MsgQ,
+                                             (OS_PEND_OBJ *)0,
+                                             p_tcb,
+                                             p_void,
+                                             msg_size,
+                                             (OS_OPT)(opt & OS_OPT_POST_LIFO),
+                                             ts,
+                                             p_tcb->MsgQCoalesceNbr,
+                                             p_tcb->MsgQCoalesceHold) == DEF_FALSE) {
+                         CPU_CRITICAL_EXIT();                   /* Message held back until the batch is complete        */
+                         break;
+                     }
+                 } else {
+                     OS_Post((OS_PEND_OBJ *)0,
+                              p_tcb,
+                              p_void,
+                              msg_size,
+                              ts);
+                 }
+#else
+                 OS_Post((OS_PEND_OBJ *)0,
+                          p_tcb,
+                          p_void,
+                          msg_size,
+                          ts);
+#endif
+                 CPU_CRITICAL_EXIT();
+                 if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+                     OSSched();                                 /* Run the scheduler                                    */
+                 }
+             } else {
+                 OS_MsgQPut(&p_tcb->MsgQ,                       /* No,  Task is pending on something else ...           */
+                            p_void,                             /* ... Deposit the message in the task's queue          */
+                            msg_size,
+                            opt,
+                            ts,
+                            p_err);
+                 CPU_CRITICAL_EXIT();
+             }
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_STATE_INVALID;
+             break;
+    }
+
+    OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                              CATCH ACCIDENTAL TASK RETURN
@@ -2772,6 +3135,8 @@ void  OS_TaskChangePrio(OS_TCB  *p_tcb,
                      case OS_TASK_PEND_ON_FLAG:
                      case OS_TASK_PEND_ON_Q:
                      case OS_TASK_PEND_ON_SEM:
+                     case OS_TASK_PEND_ON_Q_SPACE:
+                     case OS_TASK_PEND_ON_TASK_Q_SPACE:
                           OS_PendListChangePrio(p_tcb);
                           break;
 
@@ -39,6 +39,10 @@
 #define    WIN32_LEAN_AND_MEAN
 #include  <windows.h>
 
+#if (CPU_CFG_TS_TMR_TSC_EN == DEF_ENABLED)
+#include  <intrin.h>
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -46,6 +50,11 @@
 *********************************************************************************************************
 */
 
+#define  BSP_CPU_TS_TSC_FREQ_MAX_HZ              100000000u     /* Max prescaled TSC freq, in Hz.                       */
+#define  BSP_CPU_TS_TSC_CAL_TIME_mS                     20u     /* TSC calibration time, in milliseconds.               */
+
+#define  BSP_CPU_TS_nSEC_PER_SEC                1000000000u
+
 
 /*
 *********************************************************************************************************
@@ -74,6 +83,15 @@
 *********************************************************************************************************
 */
 
+#if (CPU_CFG_TS_TMR_TSC_EN == DEF_ENABLED)
+static  CPU_BOOLEAN      BSP_CPU_TS_TSC_En    = DEF_NO;         /* TSC used as CPU timestamp timer.                     */
+static  CPU_INT08U       BSP_CPU_TS_TSC_Shift = 0u;             /* TSC prescaler, as a right shift.                     */
+#endif
+
+static  CPU_TS_TMR_FREQ  BSP_CPU_TS_nSecFreq  = 0u;             /* Freq for which ns conversion factor was computed.    */
+static  CPU_INT32U       BSP_CPU_TS_nSecMultHi;                 /* Ns per timer cnt, 32.32 fixed point ...              */
+static  CPU_INT32U       BSP_CPU_TS_nSecMultLo;                 /* ... (see 'CPU_TSxx_to_nSec()  Note #2a').            */
+
 
 /*
 *********************************************************************************************************
@@ -81,6 +99,14 @@
 *********************************************************************************************************
 */
 
+#if (CPU_CFG_TS_TMR_TSC_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  BSP_CPU_TS_TSC_IsInvariant (void);
+
+static  CPU_INT64U   BSP_CPU_TS_TSC_FreqCal     (CPU_INT64U       qpc_freq);
+#endif
+
+static  void         BSP_CPU_TS_nSecMultSet     (CPU_TS_TMR_FREQ  freq);
+
 
 /*
 *********************************************************************************************************
@@ -88,6 +114,18 @@
 *********************************************************************************************************
 */
 
+#ifndef  CPU_CFG_TS_TMR_TSC_EN
+#error  "CPU_CFG_TS_TMR_TSC_EN                 not #define'd in 'cpu_cfg.h'"
+#error  "                                [MUST be  DEF_ENABLED ]           "
+#error  "                                [     ||  DEF_DISABLED]           "
+
+#elif  ((CPU_CFG_TS_TMR_TSC_EN != DEF_ENABLED ) && \
+        (CPU_CFG_TS_TMR_TSC_EN != DEF_DISABLED))
+#error  "CPU_CFG_TS_TMR_TSC_EN           illegally #define'd in 'cpu_cfg.h'"
+#error  "                                [MUST be  DEF_ENABLED ]           "
+#error  "                                [     ||  DEF_DISABLED]           "
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -138,6 +176,20 @@
 *                       inadequate to measure desired times.
 *
 *                   See also 'CPU_TS_TmrRd()  Note #2'.
+*
+*               (3) (a) If CPU_CFG_TS_TMR_TSC_EN is enabled & the processor has an invariant time-stamp
+*                       counter, the TSC is used as timestamp timer; otherwise, QueryPerformanceCounter()
+*                       is used.
+*
+*                       See also 'cpu_cfg.h  CPU TIMESTAMP TIMER SOURCE CONFIGURATION  Note #1'.
+*
+*                   (b) The TSC frequency is NOT reported by Windows; it is measured over
+*                       BSP_CPU_TS_TSC_CAL_TIME_mS against QueryPerformanceCounter().
+*
+*                   (c) The TSC is prescaled by a power of 2 so that its frequency fits in
+*                       BSP_CPU_TS_TSC_FREQ_MAX_HZ. A 32-bit timestamp timer then wraps after at least
+*                       42.9 seconds, so that 32-bit timestamp differences remain valid over intervals
+*                       of several seconds, e.g. while tasks are suspended.
 *********************************************************************************************************
 */
 
@@ -145,10 +197,35 @@
 void  CPU_TS_TmrInit (void)
 {
     LARGE_INTEGER  freq;
+#if (CPU_CFG_TS_TMR_TSC_EN == DEF_ENABLED)
+    CPU_INT64U     tsc_freq;
+    CPU_INT08U     tsc_shift;
+#endif
 
 
     QueryPerformanceFrequency(&freq);
+
+#if (CPU_CFG_TS_TMR_TSC_EN == DEF_ENABLED)
+    if (BSP_CPU_TS_TSC_IsInvariant() == DEF_YES) {              /* See Note #3a.                                        */
+        tsc_freq  = BSP_CPU_TS_TSC_FreqCal((CPU_INT64U)freq.QuadPart);
+        tsc_shift = 0u;
+        while (tsc_freq > BSP_CPU_TS_TSC_FREQ_MAX_HZ) {         /* See Note #3c.                                        */
+            tsc_freq >>= 1u;
+            tsc_shift++;
+        }
+
+        if (tsc_freq != 0u) {
+            BSP_CPU_TS_TSC_Shift = tsc_shift;
+            BSP_CPU_TS_TSC_En    = DEF_YES;
+            CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)tsc_freq);
+            BSP_CPU_TS_nSecMultSet((CPU_TS_TMR_FREQ)tsc_freq);
+            return;
+        }
+    }
+#endif
+
     CPU_TS_TmrFreqSet(freq.LowPart);
+    BSP_CPU_TS_nSecMultSet(freq.LowPart);
 }
 #endif
 
@@ -241,6 +318,12 @@ CPU_TS_TMR  CPU_TS_TmrRd (void)
     LARGE_INTEGER  cnt;
 
 
+#if (CPU_CFG_TS_TMR_TSC_EN == DEF_ENABLED)
+    if (BSP_CPU_TS_TSC_En == DEF_YES) {                         /* See 'CPU_TS_TmrInit()  Note #3'.                     */
+        return ((CPU_TS_TMR)(__rdtsc() >> BSP_CPU_TS_TSC_Shift));
+    }
+#endif
+
     if (QueryPerformanceCounter(&cnt) == 0) {
         return (0);
     }
@@ -350,3 +433,215 @@ CPU_INT64U  CPU_TS64_to_uSec (CPU_TS64  ts_cnts)
 }
 #endif
 
+
+/*
+*********************************************************************************************************
+*                                         CPU_TSxx_to_nSec()
+*
+* Description : Convert a 32-/64-bit CPU timestamp from timer counts to nanoseconds.
+*
+* Argument(s) : ts_cnts   CPU timestamp (in timestamp timer counts).
+*
+* Return(s)   : Converted CPU timestamp (in nanoseconds).
+*
+* Caller(s)   : Application.
+*
+*               This function is an (optional) CPU module application programming interface (API)
+*               function which MAY be implemented by application/BSP function(s) & MAY be called by
+*               application function(s).
+*
+* Note(s)     : (1) See 'CPU_TSxx_to_uSec()  Notes #1 & #2'.
+*
+*               (2) (a) The 64-bit division by the timer frequency is replaced by a multiplication by
+*                       the number of nanoseconds per timer count, in 32.32 fixed point, computed once by
+*                       BSP_CPU_TS_nSecMultSet() :
+*
+*                                               (10^9 * 2^32)
+*                           Multiplier  =  -----------------------
+*                                              Timer frequency
+*
+*                   (b) The result is at most 1 ns under the exact quotient for each 2^32 timer counts
+*                       converted.
+*
+*                   (c) If the timer frequency was changed after CPU_TS_TmrInit(), the timestamp is
+*                       converted by division.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+CPU_INT64U  CPU_TS32_to_nSec (CPU_TS32  ts_cnts)
+{
+    CPU_INT64U       nSec;
+    CPU_TS_TMR_FREQ  freq;
+    CPU_ERR          cpu_err;
+
+
+    freq = CPU_TS_TmrFreqGet(&cpu_err);
+    if (cpu_err != CPU_ERR_NONE) {
+        return (0u);
+    }
+
+    if (freq != BSP_CPU_TS_nSecFreq) {                          /* See Note #2c.                                        */
+        nSec = ((CPU_INT64U)ts_cnts * BSP_CPU_TS_nSEC_PER_SEC) / freq;
+        return (nSec);
+    }
+
+    nSec = ((CPU_INT64U)ts_cnts * BSP_CPU_TS_nSecMultHi)        /* See Note #2a.                                        */
+         + (((CPU_INT64U)ts_cnts * BSP_CPU_TS_nSecMultLo) >> 32u);
+
+    return (nSec);
+}
+#endif
+
+
+#if (CPU_CFG_TS_64_EN == DEF_ENABLED)
+CPU_INT64U  CPU_TS64_to_nSec (CPU_TS64  ts_cnts)
+{
+    CPU_INT64U       nSec;
+    CPU_INT32U       ts_cnts_hi;
+    CPU_INT32U       ts_cnts_lo;
+    CPU_TS_TMR_FREQ  freq;
+    CPU_ERR          cpu_err;
+
+
+    freq = CPU_TS_TmrFreqGet(&cpu_err);
+    if (cpu_err != CPU_ERR_NONE) {
+        return (0u);
+    }
+
+    if (freq != BSP_CPU_TS_nSecFreq) {                          /* See Note #2c.                                        */
+        nSec = (ts_cnts / freq) * BSP_CPU_TS_nSEC_PER_SEC
+             + ((ts_cnts % freq) * BSP_CPU_TS_nSEC_PER_SEC) / freq;
+        return (nSec);
+    }
+
+    ts_cnts_hi = (CPU_INT32U)(ts_cnts >> 32u);
+    ts_cnts_lo = (CPU_INT32U) ts_cnts;
+                                                                /* See Note #2a.                                        */
+    nSec = (ts_cnts * BSP_CPU_TS_nSecMultHi)
+         + ((CPU_INT64U)ts_cnts_hi * BSP_CPU_TS_nSecMultLo)
+         + (((CPU_INT64U)ts_cnts_lo * BSP_CPU_TS_nSecMultLo) >> 32u);
+
+    return (nSec);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                    BSP_CPU_TS_TSC_IsInvariant()
+*
+* Description : Check whether the processor's time-stamp counter runs at a constant rate.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_YES, if the TSC is invariant (CPUID 0x80000007, EDX bit 8);
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : CPU_TS_TmrInit().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_TSC_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  BSP_CPU_TS_TSC_IsInvariant (void)
+{
+    int  regs[4];
+
+
+    __cpuid(regs, (int)0x80000000u);
+    if ((CPU_INT32U)regs[0] < 0x80000007u) {                    /* Power management leaf not supported.                 */
+        return (DEF_NO);
+    }
+
+    __cpuid(regs, (int)0x80000007u);
+    if (DEF_BIT_IS_SET((CPU_INT32U)regs[3], DEF_BIT_08) == DEF_YES) {
+        return (DEF_YES);
+    }
+
+    return (DEF_NO);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      BSP_CPU_TS_TSC_FreqCal()
+*
+* Description : Measure the time-stamp counter frequency against QueryPerformanceCounter().
+*
+* Argument(s) : qpc_freq    QueryPerformanceCounter() frequency, in Hz.
+*
+* Return(s)   : TSC frequency, in Hz.
+*
+* Caller(s)   : CPU_TS_TmrInit().
+*
+* Note(s)     : (1) Each performance counter read is immediately followed by a TSC read, so that both
+*                   ends of the calibration window are sampled the same way.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_TSC_EN == DEF_ENABLED)
+static  CPU_INT64U  BSP_CPU_TS_TSC_FreqCal (CPU_INT64U  qpc_freq)
+{
+    LARGE_INTEGER  qpc_start;
+    LARGE_INTEGER  qpc_end;
+    CPU_INT64U     qpc_cnts;
+    CPU_INT64U     tsc_start;
+    CPU_INT64U     tsc_end;
+
+
+    qpc_cnts = (qpc_freq * BSP_CPU_TS_TSC_CAL_TIME_mS) / 1000u;
+
+    QueryPerformanceCounter(&qpc_start);                        /* See Note #1.                                         */
+    tsc_start = __rdtsc();
+    do {
+        QueryPerformanceCounter(&qpc_end);
+        tsc_end = __rdtsc();
+    } while ((CPU_INT64U)(qpc_end.QuadPart - qpc_start.QuadPart) < qpc_cnts);
+
+    return (((tsc_end - tsc_start) * qpc_freq) / (CPU_INT64U)(qpc_end.QuadPart - qpc_start.QuadPart));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      BSP_CPU_TS_nSecMultSet()
+*
+* Description : Compute the nanoseconds per timer count multiplier used by CPU_TSxx_to_nSec().
+*
+* Argument(s) : freq        Timestamp timer frequency, in Hz.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_TS_TmrInit().
+*
+* Note(s)     : (1) See 'CPU_TSxx_to_nSec()  Note #2a'.
+*********************************************************************************************************
+*/
+
+static  void  BSP_CPU_TS_nSecMultSet (CPU_TS_TMR_FREQ  freq)
+{
+    CPU_INT64U  mult;
+
+
+    if (freq == 0u) {
+        return;
+    }
+
+    mult                  = ((CPU_INT64U)BSP_CPU_TS_nSEC_PER_SEC << 32u) / freq;
+    BSP_CPU_TS_nSecMultHi = (CPU_INT32U)(mult >> 32u);
+    BSP_CPU_TS_nSecMultLo = (CPU_INT32U) mult;
+    BSP_CPU_TS_nSecFreq   = freq;
+}
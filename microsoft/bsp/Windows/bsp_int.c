@@ -0,0 +1,1161 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                          VIRTUAL INTERRUPT CONTROLLER BOARD SUPPORT PACKAGE (BSP)
+*
+* Filename : bsp_int.c
+*
+* Note(s)  : (1) The controller is emulated with Win32 threads, the same way the port emulates the tick
+*                (see 'os_cpu_c.c  OSTickW32()') :
+*
+*                (a) Each line runs its ISR in its own thread.  The controller thread enters an interrupt
+*                    with the critical section held, i.e. never while a task or an ISR has interrupts
+*                    disabled :
+*
+*                    (1) If no ISR is in progress, the current task is suspended by OSIntCurTaskSuspend()
+*                        & resumed by OSIntCurTaskResume() after the outermost OSIntExit().
+*
+*                    (2) Otherwise, the thread of the ISR in progress is suspended until the nested ISR
+*                        completes.
+*
+*                (b) ISRs run with the critical section released so that they can be nested; like on a
+*                    target, they MUST NOT call non-reentrant C library functions (e.g. printf()).
+*
+*                (c) An ISR that completes while another line is pending above the interrupted level is
+*                    chained to it without leaving interrupt level.
+*
+*            (2) Each line queues up to BSP_INT_PEND_MAX occurrences with the timestamp at which each was
+*                raised; extra occurrences are counted in BSP_INT_STAT.OvfCtr.
+*
+*            (3) Timer & stimulus file sources are paced by the Windows timer resolution, 1 ms.  Occurrences
+*                due between two wake-ups are raised together; entry latencies are measured from that
+*                instant.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <bsp_int.h>
+#include  <lib_mem.h>
+#include  <lib_str.h>
+#include  <os.h>
+
+#define    WIN32_LEAN_AND_MEAN
+#include  <windows.h>
+#include  <stdio.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BSP_INT_ID_NONE                                 0xFFu
+
+#define  BSP_INT_SRC_POLL_mS                               1u   /* Source pacing period (see Note #3).                  */
+
+#define  BSP_INT_SRC_FILE_LINE_LEN_MAX                   128u
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  bsp_int_line {
+    CPU_FNCT_VOID           Isr;
+    CPU_INT08U              Prio;
+    CPU_BOOLEAN             En;
+                                                                /* ---------- PENDING OCCURRENCES (Note #2) ----------- */
+    CPU_INT32U              PendRdIx;
+    CPU_INT32U              PendWrIx;
+    CPU_TS                  PendTS[BSP_INT_PEND_MAX];
+                                                                /* -------------- OCCURRENCE IN SERVICE --------------- */
+    CPU_TS                  ActiveTS;                           /* Raise timestamp.                                     */
+    volatile  CPU_TS        EntryTS;                            /* ISR entry timestamp, set by ISR thread.              */
+    volatile  CPU_BOOLEAN   Done;                               /* ISR completed,       set by ISR thread.              */
+                                                                /* ------------------- TIMER SOURCE ------------------- */
+    CPU_INT32U              TmrRate;                            /* Rate, in Hz (0 if no timer source).                  */
+    LONGLONG                TmrStart;                           /* Start, in performance counter counts.                */
+    CPU_INT64U              TmrNbr;                             /* Nbr of occurrences raised since start.               */
+
+    BSP_INT_STAT            Stat;
+
+    HANDLE                  Thread;
+    HANDLE                  SignalPtr;
+} BSP_INT_LINE;
+
+
+typedef  struct  bsp_int_src_evt {
+    CPU_INT32U  TimeUs;                                         /* Offset from start of cycle, in microseconds.         */
+    CPU_INT08U  IntId;
+} BSP_INT_SRC_EVT;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN      BSP_IntInitDone = DEF_NO;
+
+static  BSP_INT_LINE     BSP_IntLineTbl[BSP_INT_SRC_NBR];
+
+static  CPU_INT08U       BSP_IntActiveTbl[BSP_INT_PRIO_NBR];    /* Lines in service, outermost first.                   */
+static  CPU_INT08U       BSP_IntNestCtr;
+static  CPU_INT08U       BSP_IntNestMax;
+static  CPU_INT08U       BSP_IntPrioMask;                       /* Lines at this priority or lower are masked.          */
+
+static  HANDLE           BSP_IntCtrlThread;
+static  HANDLE           BSP_IntCtrlSignalPtr;
+
+static  HANDLE           BSP_IntSrcThread;
+static  HANDLE           BSP_IntSrcSignalPtr;
+static  LONGLONG         BSP_IntSrcFreq;                        /* Performance counter frequency, in Hz.                */
+
+static  BSP_INT_SRC_EVT  BSP_IntSrcFileTbl[BSP_INT_SRC_FILE_NBR_MAX];
+static  CPU_INT32U       BSP_IntSrcFileNbr;
+static  CPU_INT32U       BSP_IntSrcFileIx;
+static  CPU_INT32U       BSP_IntSrcFilePeriod;                  /* Repeat period, in microseconds (0 = one shot).       */
+static  CPU_INT64U       BSP_IntSrcFileCycle;
+static  LONGLONG         BSP_IntSrcFileStart;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  DWORD  WINAPI  BSP_IntCtrlW32     (LPVOID         p_arg);
+
+static  DWORD  WINAPI  BSP_IntSrcW32      (LPVOID         p_arg);
+
+static  DWORD  WINAPI  BSP_IntW32         (LPVOID         p_arg);
+
+static  void           BSP_IntPendPush    (BSP_INT_LINE  *p_line,
+                                           CPU_TS         ts);
+
+static  CPU_INT08U     BSP_IntNextGet     (CPU_INT08U     prio_cur);
+
+static  void           BSP_IntStart       (CPU_INT08U     int_id);
+
+static  void           BSP_IntRetire      (void);
+
+static  CPU_BOOLEAN    BSP_IntDispatch    (void);
+
+
+/*
+*********************************************************************************************************
+*                                            BSP_IntInit()
+*
+* Description : Initialize the virtual interrupt controller & start its threads.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_OK,   if the controller is initialized;
+*
+*               DEF_FAIL, if an event or a thread could NOT be created (see Note #3).
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) MUST be called after CPU_Init() & OSInit(); interrupts are dispatched once OSStart()
+*                   has started the first task.
+*
+*               (2) All lines are disabled, at the lowest priority & without ISR.
+*
+*               (3) The threads already started are NOT stopped; the application SHOULD NOT use the
+*                   controller & SHOULD exit.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  BSP_IntInit (void)
+{
+    BSP_INT_LINE   *p_line;
+    LARGE_INTEGER   freq;
+    CPU_INT08U      int_id;
+
+
+    if (BSP_IntInitDone == DEF_YES) {
+        return (DEF_OK);
+    }
+
+    QueryPerformanceFrequency(&freq);
+    BSP_IntSrcFreq       = freq.QuadPart;
+    BSP_IntNestCtr       = 0u;
+    BSP_IntNestMax       = 0u;
+    BSP_IntPrioMask      = BSP_INT_PRIO_NBR;
+    BSP_IntSrcFileNbr    = 0u;
+    BSP_IntSrcFileIx     = 0u;
+    BSP_IntSrcFilePeriod = 0u;
+
+    BSP_IntCtrlSignalPtr = CreateEvent(NULL, FALSE, FALSE, NULL);
+    BSP_IntSrcSignalPtr  = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if ((BSP_IntCtrlSignalPtr == NULL) ||
+        (BSP_IntSrcSignalPtr  == NULL)) {
+        return (DEF_FAIL);
+    }
+
+    for (int_id = 0u; int_id < BSP_INT_SRC_NBR; int_id++) {    /* See Note #2.                                         */
+        p_line = &BSP_IntLineTbl[int_id];
+        Mem_Clr(p_line, sizeof(BSP_INT_LINE));
+        p_line->Prio      = BSP_INT_PRIO_NBR - 1u;
+        p_line->En        = DEF_DISABLED;
+        p_line->Done      = DEF_YES;
+        p_line->SignalPtr = CreateEvent(NULL, FALSE, FALSE, NULL);
+        p_line->Thread    = CreateThread(NULL, 0, BSP_IntW32, p_line, 0, NULL);
+        if ((p_line->SignalPtr == NULL) ||
+            (p_line->Thread    == NULL)) {
+            return (DEF_FAIL);                                  /* See Note #3.                                         */
+        }
+        SetThreadPriority(p_line->Thread, THREAD_PRIORITY_ABOVE_NORMAL);
+    }
+
+    BSP_IntCtrlThread = CreateThread(NULL, 0, BSP_IntCtrlW32, NULL, 0, NULL);
+    BSP_IntSrcThread  = CreateThread(NULL, 0, BSP_IntSrcW32,  NULL, 0, NULL);
+    if ((BSP_IntCtrlThread == NULL) ||
+        (BSP_IntSrcThread  == NULL)) {
+        return (DEF_FAIL);
+    }
+                                                                /* Above ISR threads: entering an IRQ preempts them.    */
+    SetThreadPriority(BSP_IntCtrlThread, THREAD_PRIORITY_TIME_CRITICAL);
+    SetThreadPriority(BSP_IntSrcThread,  THREAD_PRIORITY_HIGHEST);
+
+    BSP_IntInitDone = DEF_YES;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          BSP_IntVectSet()
+*
+* Description : Assign an ISR to an interrupt line.
+*
+* Argument(s) : int_id      Interrupt line.
+*
+*               isr         ISR to call when the line is serviced (a NULL ISR leaves the line idle).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The ISR is called between OSIntEnter() & OSIntExit(); it MUST NOT call them itself.
+*********************************************************************************************************
+*/
+
+void  BSP_IntVectSet (CPU_INT08U     int_id,
+                      CPU_FNCT_VOID  isr)
+{
+    CPU_SR_ALLOC();
+
+
+    if (int_id >= BSP_INT_SRC_NBR) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    BSP_IntLineTbl[int_id].Isr = isr;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          BSP_IntPrioSet()
+*
+* Description : Set the priority of an interrupt line.
+*
+* Argument(s) : int_id      Interrupt line.
+*
+*               prio        Priority, 0 being the highest; limited to BSP_INT_PRIO_NBR - 1.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Takes effect on the next occurrence serviced.
+*********************************************************************************************************
+*/
+
+void  BSP_IntPrioSet (CPU_INT08U  int_id,
+                      CPU_INT08U  prio)
+{
+    CPU_SR_ALLOC();
+
+
+    if (int_id >= BSP_INT_SRC_NBR) {
+        return;
+    }
+    if (prio >= BSP_INT_PRIO_NBR) {
+        prio = BSP_INT_PRIO_NBR - 1u;
+    }
+
+    CPU_CRITICAL_ENTER();
+    BSP_IntLineTbl[int_id].Prio = prio;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                        BSP_IntPrioMaskSet()
+*
+* Description : Mask all interrupt lines at or below a priority.
+*
+* Argument(s) : prio        Highest masked priority; BSP_INT_PRIO_NBR unmasks all lines & 0 masks them all.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Occurrences raised on masked lines stay pending.
+*********************************************************************************************************
+*/
+
+void  BSP_IntPrioMaskSet (CPU_INT08U  prio)
+{
+    CPU_SR_ALLOC();
+
+
+    if (prio > BSP_INT_PRIO_NBR) {
+        prio = BSP_INT_PRIO_NBR;
+    }
+
+    CPU_CRITICAL_ENTER();
+    BSP_IntPrioMask = prio;
+    CPU_CRITICAL_EXIT();
+
+    SetEvent(BSP_IntCtrlSignalPtr);                             /* Pending lines may have been unmasked.                */
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BSP_IntEn()
+*
+* Description : Enable an interrupt line.
+*
+* Argument(s) : int_id      Interrupt line.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  BSP_IntEn (CPU_INT08U  int_id)
+{
+    CPU_SR_ALLOC();
+
+
+    if (int_id >= BSP_INT_SRC_NBR) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    BSP_IntLineTbl[int_id].En = DEF_ENABLED;
+    CPU_CRITICAL_EXIT();
+
+    SetEvent(BSP_IntCtrlSignalPtr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             BSP_IntDis()
+*
+* Description : Disable an interrupt line.
+*
+* Argument(s) : int_id      Interrupt line.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Occurrences raised on a disabled line stay pending.
+*********************************************************************************************************
+*/
+
+void  BSP_IntDis (CPU_INT08U  int_id)
+{
+    CPU_SR_ALLOC();
+
+
+    if (int_id >= BSP_INT_SRC_NBR) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    BSP_IntLineTbl[int_id].En = DEF_DISABLED;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                            BSP_IntPend()
+*
+* Description : Raise an occurrence on an interrupt line.
+*
+* Argument(s) : int_id      Interrupt line.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application, ISRs.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  BSP_IntPend (CPU_INT08U  int_id)
+{
+    CPU_SR_ALLOC();
+
+
+    if (int_id >= BSP_INT_SRC_NBR) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    BSP_IntPendPush(&BSP_IntLineTbl[int_id], OS_TS_GET());
+    CPU_CRITICAL_EXIT();
+
+    SetEvent(BSP_IntCtrlSignalPtr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            BSP_IntClr()
+*
+* Description : Discard the pending occurrences of an interrupt line.
+*
+* Argument(s) : int_id      Interrupt line.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application, ISRs.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  BSP_IntClr (CPU_INT08U  int_id)
+{
+    CPU_SR_ALLOC();
+
+
+    if (int_id >= BSP_INT_SRC_NBR) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    BSP_IntLineTbl[int_id].PendRdIx = BSP_IntLineTbl[int_id].PendWrIx;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                         BSP_IntSrcTmrSet()
+*
+* Description : Raise an interrupt line periodically.
+*
+* Argument(s) : int_id      Interrupt line.
+*
+*               rate_hz     Rate, in occurrences per second (0 stops the timer source).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Occurrences are counted from the performance counter, so the average rate does not drift
+*                   whatever the pacing of the source thread (see Note #3).
+*********************************************************************************************************
+*/
+
+void  BSP_IntSrcTmrSet (CPU_INT08U  int_id,
+                        CPU_INT32U  rate_hz)
+{
+    BSP_INT_LINE   *p_line;
+    LARGE_INTEGER   now;
+    CPU_SR_ALLOC();
+
+
+    if (int_id >= BSP_INT_SRC_NBR) {
+        return;
+    }
+
+    p_line = &BSP_IntLineTbl[int_id];
+    QueryPerformanceCounter(&now);
+
+    CPU_CRITICAL_ENTER();
+    p_line->TmrRate  = rate_hz;
+    p_line->TmrStart = now.QuadPart;
+    p_line->TmrNbr   = 0u;
+    CPU_CRITICAL_EXIT();
+
+    SetEvent(BSP_IntSrcSignalPtr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        BSP_IntSrcFileLoad()
+*
+* Description : Load a stimulus file & start replaying it.
+*
+* Argument(s) : p_filename  Name of the stimulus file.
+*
+*               period_us   Repeat period, in microseconds (0 replays the file once).
+*
+* Return(s)   : DEF_OK,   if the file was loaded;
+*
+*               DEF_FAIL, otherwise (the previous stimulus is stopped).
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Each line holds an offset from the start of the cycle, in microseconds, & an interrupt
+*                   line, separated by blanks; offsets MUST NOT decrease & MUST be less than a non-null
+*                   period.  Empty lines & lines starting with '#' are ignored :
+*
+*                       # t (us)   line
+*                            0      3
+*                          250      3
+*                          250      5
+*
+*               (2) The file is read with stdio; MUST NOT be called from an ISR.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  BSP_IntSrcFileLoad (CPU_CHAR    *p_filename,
+                                 CPU_INT32U   period_us)
+{
+    FILE           *p_file;
+    CPU_CHAR        line[BSP_INT_SRC_FILE_LINE_LEN_MAX];
+    CPU_CHAR       *p_str;
+    CPU_CHAR       *p_str_next;
+    CPU_INT32U      time_us;
+    CPU_INT32U      time_us_prev;
+    CPU_INT32U      int_id;
+    CPU_INT32U      nbr;
+    CPU_BOOLEAN     ok;
+    LARGE_INTEGER   now;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();                                       /* Stop current replay before table is overwritten.    */
+    BSP_IntSrcFileNbr = 0u;
+    CPU_CRITICAL_EXIT();
+
+#ifdef _MSC_VER
+    if (fopen_s(&p_file, (const char *)p_filename, "r") != 0) {
+        p_file = NULL;
+    }
+#else
+    p_file = fopen((const char *)p_filename, "r");
+#endif
+    if (p_file == NULL) {
+        return (DEF_FAIL);
+    }
+
+    ok           = DEF_OK;
+    nbr          = 0u;
+    time_us_prev = 0u;
+    while ((ok == DEF_OK) &&
+           (fgets((char *)line, sizeof(line), p_file) != NULL)) {
+        p_str = line;
+        while ((*p_str == ' ') || (*p_str == '\t')) {
+            p_str++;
+        }
+        if ((*p_str == '#' ) ||                                 /* Comment or empty line.                               */
+            (*p_str == '\r') ||
+            (*p_str == '\n') ||
+            (*p_str == '\0')) {
+            continue;
+        }
+
+        time_us = Str_ParseNbr_Int32U(p_str,      &p_str_next, 10u);
+        if (p_str_next == p_str) {
+            ok = DEF_FAIL;
+            break;
+        }
+        p_str   = p_str_next;
+        int_id  = Str_ParseNbr_Int32U(p_str,      &p_str_next, 10u);
+        if ((p_str_next == p_str)            ||
+            (int_id     >= BSP_INT_SRC_NBR)  ||
+            (time_us    <  time_us_prev)     ||
+            (nbr        >= BSP_INT_SRC_FILE_NBR_MAX)) {
+            ok = DEF_FAIL;
+            break;
+        }
+        if ((period_us != 0u) &&
+            (time_us   >= period_us)) {
+            ok = DEF_FAIL;
+            break;
+        }
+
+        BSP_IntSrcFileTbl[nbr].TimeUs = time_us;
+        BSP_IntSrcFileTbl[nbr].IntId  = (CPU_INT08U)int_id;
+        time_us_prev = time_us;
+        nbr++;
+    }
+    fclose(p_file);
+
+    if (ok != DEF_OK) {
+        return (DEF_FAIL);
+    }
+
+    QueryPerformanceCounter(&now);
+
+    CPU_CRITICAL_ENTER();
+    BSP_IntSrcFileIx     = 0u;
+    BSP_IntSrcFileCycle  = 0u;
+    BSP_IntSrcFilePeriod = period_us;
+    BSP_IntSrcFileStart  = now.QuadPart;
+    BSP_IntSrcFileNbr    = nbr;
+    CPU_CRITICAL_EXIT();
+
+    SetEvent(BSP_IntSrcSignalPtr);
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          BSP_IntStatGet()
+*
+* Description : Get the statistics of an interrupt line.
+*
+* Argument(s) : int_id      Interrupt line.
+*
+*               p_stat      Pointer to variable that will receive the statistics.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Latencies are in CPU_TS counts; see CPU_TS32_to_nSec().
+*********************************************************************************************************
+*/
+
+void  BSP_IntStatGet (CPU_INT08U     int_id,
+                      BSP_INT_STAT  *p_stat)
+{
+    CPU_SR_ALLOC();
+
+
+    if ((int_id >= BSP_INT_SRC_NBR) ||
+        (p_stat == (BSP_INT_STAT *)0)) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+   *p_stat = BSP_IntLineTbl[int_id].Stat;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                         BSP_IntNestMaxGet()
+*
+* Description : Get the deepest interrupt nesting observed.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Maximum number of ISRs in progress at once.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT08U  BSP_IntNestMaxGet (void)
+{
+    return (BSP_IntNestMax);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          BSP_IntStatClr()
+*
+* Description : Clear the statistics of all interrupt lines.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  BSP_IntStatClr (void)
+{
+    CPU_INT08U  int_id;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    for (int_id = 0u; int_id < BSP_INT_SRC_NBR; int_id++) {
+        Mem_Clr(&BSP_IntLineTbl[int_id].Stat, sizeof(BSP_INT_STAT));
+    }
+    BSP_IntNestMax = BSP_IntNestCtr;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          BSP_IntCtrlW32()
+*
+* Description : Win32 thread emulating the interrupt controller.
+*
+* Argument(s) : p_arg       Pointer to argument of the thread (unused).
+*
+* Return(s)   : Thread exit code.
+*
+* Caller(s)   : Win32 (created by BSP_IntInit()).
+*
+* Note(s)     : (1) Woken whenever an occurrence is raised, a line is enabled or unmasked, or an ISR
+*                   completes.  If an interrupt could not be entered (see BSP_IntDispatch()), it is
+*                   retried every millisecond.
+*********************************************************************************************************
+*/
+
+static  DWORD  WINAPI  BSP_IntCtrlW32 (LPVOID  p_arg)
+{
+    DWORD        timeout;
+    CPU_BOOLEAN  retry;
+    CPU_SR_ALLOC();
+
+
+    (void)p_arg;
+
+    timeout = INFINITE;
+    while (DEF_ON) {
+        WaitForSingleObject(BSP_IntCtrlSignalPtr, timeout);
+
+        CPU_CRITICAL_ENTER();
+        BSP_IntRetire();
+        retry = BSP_IntDispatch();
+        CPU_CRITICAL_EXIT();
+
+        timeout = (retry == DEF_YES) ? 1u : INFINITE;           /* See Note #1.                                         */
+    }
+
+    return (0u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           BSP_IntSrcW32()
+*
+* Description : Win32 thread raising the occurrences of the timer & stimulus file sources.
+*
+* Argument(s) : p_arg       Pointer to argument of the thread (unused).
+*
+* Return(s)   : Thread exit code.
+*
+* Caller(s)   : Win32 (created by BSP_IntInit()).
+*
+* Note(s)     : (1) See 'bsp_int.c  Note #3'.
+*
+*               (2) After a long stall (e.g. a breakpoint), at most BSP_INT_PEND_MAX late occurrences of a
+*                   timer source are raised; the others are counted as lost.
+*********************************************************************************************************
+*/
+
+static  DWORD  WINAPI  BSP_IntSrcW32 (LPVOID  p_arg)
+{
+    BSP_INT_LINE     *p_line;
+    BSP_INT_SRC_EVT  *p_evt;
+    LARGE_INTEGER     now;
+    CPU_INT64U        nbr_due;
+    CPU_INT64U        elapsed_us;
+    CPU_INT64U        cycle_us;
+    CPU_TS            ts;
+    CPU_INT08U        int_id;
+    CPU_BOOLEAN       active;
+    CPU_BOOLEAN       raised;
+    CPU_SR_ALLOC();
+
+
+    (void)p_arg;
+
+    while (DEF_ON) {
+        active = DEF_NO;
+        raised = DEF_NO;
+        QueryPerformanceCounter(&now);
+
+        CPU_CRITICAL_ENTER();
+        ts = OS_TS_GET();
+                                                                /* ------------------ TIMER SOURCES ------------------- */
+        for (int_id = 0u; int_id < BSP_INT_SRC_NBR; int_id++) {
+            p_line = &BSP_IntLineTbl[int_id];
+            if (p_line->TmrRate == 0u) {
+                continue;
+            }
+            active  = DEF_YES;
+            nbr_due = ((CPU_INT64U)(now.QuadPart - p_line->TmrStart) * p_line->TmrRate) / (CPU_INT64U)BSP_IntSrcFreq;
+                                                                /* See Note #2.                                         */
+            if ((nbr_due - p_line->TmrNbr) > BSP_INT_PEND_MAX) {
+                p_line->Stat.OvfCtr += (CPU_INT32U)(nbr_due - p_line->TmrNbr - BSP_INT_PEND_MAX);
+                p_line->TmrNbr       =  nbr_due - BSP_INT_PEND_MAX;
+            }
+            while (p_line->TmrNbr < nbr_due) {
+                BSP_IntPendPush(p_line, ts);
+                p_line->TmrNbr++;
+                raised = DEF_YES;
+            }
+        }
+                                                                /* ------------------ STIMULUS FILE ------------------- */
+        if (BSP_IntSrcFileNbr > 0u) {
+            elapsed_us = ((CPU_INT64U)(now.QuadPart - BSP_IntSrcFileStart) * 1000000u) / (CPU_INT64U)BSP_IntSrcFreq;
+            cycle_us   =   BSP_IntSrcFileCycle * BSP_IntSrcFilePeriod;
+            while (BSP_IntSrcFileIx < BSP_IntSrcFileNbr) {
+                p_evt = &BSP_IntSrcFileTbl[BSP_IntSrcFileIx];
+                if ((cycle_us + p_evt->TimeUs) > elapsed_us) {
+                    break;
+                }
+                BSP_IntPendPush(&BSP_IntLineTbl[p_evt->IntId], ts);
+                raised = DEF_YES;
+
+                BSP_IntSrcFileIx++;
+                if ((BSP_IntSrcFileIx     == BSP_IntSrcFileNbr) &&
+                    (BSP_IntSrcFilePeriod != 0u)) {             /* Next cycle.                                          */
+                    BSP_IntSrcFileIx  = 0u;
+                    BSP_IntSrcFileCycle++;
+                    cycle_us         += BSP_IntSrcFilePeriod;
+                }
+            }
+            if (BSP_IntSrcFileIx < BSP_IntSrcFileNbr) {
+                active = DEF_YES;
+            }
+        }
+        CPU_CRITICAL_EXIT();
+
+        if (raised == DEF_YES) {
+            SetEvent(BSP_IntCtrlSignalPtr);
+        }
+
+        WaitForSingleObject(BSP_IntSrcSignalPtr, (active == DEF_YES) ? BSP_INT_SRC_POLL_mS : INFINITE);
+    }
+
+    return (0u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            BSP_IntW32()
+*
+* Description : Win32 thread running the ISR of an interrupt line.
+*
+* Argument(s) : p_arg       Pointer to the interrupt line.
+*
+* Return(s)   : Thread exit code.
+*
+* Caller(s)   : Win32 (created by BSP_IntInit()).
+*
+* Note(s)     : (1) Started by BSP_IntStart() once the interrupt is entered; see 'bsp_int.c  Note #1'.
+*********************************************************************************************************
+*/
+
+static  DWORD  WINAPI  BSP_IntW32 (LPVOID  p_arg)
+{
+    BSP_INT_LINE  *p_line;
+
+
+    p_line = (BSP_INT_LINE *)p_arg;
+
+    while (DEF_ON) {
+        WaitForSingleObject(p_line->SignalPtr, INFINITE);
+
+        p_line->EntryTS = OS_TS_GET();
+        p_line->Isr();
+        p_line->Done    = DEF_YES;
+
+        SetEvent(BSP_IntCtrlSignalPtr);
+    }
+
+    return (0u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          BSP_IntPendPush()
+*
+* Description : Queue an occurrence on an interrupt line.
+*
+* Argument(s) : p_line      Pointer to the interrupt line.
+*
+*               ts          Raise timestamp.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : BSP_IntPend(),
+*               BSP_IntSrcW32().
+*
+* Note(s)     : (1) MUST be called with the critical section held.
+*********************************************************************************************************
+*/
+
+static  void  BSP_IntPendPush (BSP_INT_LINE  *p_line,
+                               CPU_TS         ts)
+{
+    if ((p_line->PendWrIx - p_line->PendRdIx) >= BSP_INT_PEND_MAX) {
+        p_line->Stat.OvfCtr++;
+        return;
+    }
+
+    p_line->PendTS[p_line->PendWrIx & (BSP_INT_PEND_MAX - 1u)] = ts;
+    p_line->PendWrIx++;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          BSP_IntNextGet()
+*
+* Description : Find the pending line to service next.
+*
+* Argument(s) : prio_cur    Priority of the ISR in progress (BSP_INT_PRIO_NBR if none).
+*
+* Return(s)   : Interrupt line, if an enabled & unmasked line with an ISR is pending above prio_cur;
+*
+*               BSP_INT_ID_NONE, otherwise.
+*
+* Caller(s)   : BSP_IntRetire(),
+*               BSP_IntDispatch().
+*
+* Note(s)     : (1) MUST be called with the critical section held.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  BSP_IntNextGet (CPU_INT08U  prio_cur)
+{
+    BSP_INT_LINE  *p_line;
+    CPU_INT08U     prio_max;
+    CPU_INT08U     int_id;
+    CPU_INT08U     int_id_next;
+
+
+    prio_max    = DEF_MIN(prio_cur, BSP_IntPrioMask);
+    int_id_next = BSP_INT_ID_NONE;
+    for (int_id = 0u; int_id < BSP_INT_SRC_NBR; int_id++) {
+        p_line = &BSP_IntLineTbl[int_id];
+        if ((p_line->Prio     <  prio_max)            &&
+            (p_line->En       == DEF_ENABLED)         &&
+            (p_line->Isr      != (CPU_FNCT_VOID)0)    &&
+            (p_line->PendWrIx != p_line->PendRdIx)) {
+            int_id_next = int_id;
+            prio_max    = p_line->Prio;                         /* Equal priorities: lowest line first.                 */
+        }
+    }
+
+    return (int_id_next);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           BSP_IntStart()
+*
+* Description : Start the ISR of an interrupt line, at interrupt level.
+*
+* Argument(s) : int_id      Interrupt line.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : BSP_IntRetire(),
+*               BSP_IntDispatch().
+*
+* Note(s)     : (1) MUST be called with the critical section held.
+*********************************************************************************************************
+*/
+
+static  void  BSP_IntStart (CPU_INT08U  int_id)
+{
+    BSP_INT_LINE  *p_line;
+
+
+    p_line = &BSP_IntLineTbl[int_id];
+
+    p_line->ActiveTS = p_line->PendTS[p_line->PendRdIx & (BSP_INT_PEND_MAX - 1u)];
+    p_line->PendRdIx++;
+    p_line->Done     = DEF_NO;
+
+    BSP_IntActiveTbl[BSP_IntNestCtr] = int_id;
+    BSP_IntNestCtr++;
+    if (BSP_IntNestMax < BSP_IntNestCtr) {
+        BSP_IntNestMax = BSP_IntNestCtr;
+    }
+
+    SetEvent(p_line->SignalPtr);                                /* ISR thread runs once controller thread waits.        */
+}
+
+
+/*
+*********************************************************************************************************
+*                                           BSP_IntRetire()
+*
+* Description : Leave the interrupts whose ISR completed.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : BSP_IntCtrlW32().
+*
+* Note(s)     : (1) MUST be called with the critical section held.
+*
+*               (2) See 'bsp_int.c  Note #1c'.
+*********************************************************************************************************
+*/
+
+static  void  BSP_IntRetire (void)
+{
+    BSP_INT_LINE  *p_line;
+    CPU_TS         lat;
+    CPU_INT08U     prio_cur;
+    CPU_INT08U     int_id;
+
+
+    while (BSP_IntNestCtr > 0u) {
+        p_line = &BSP_IntLineTbl[BSP_IntActiveTbl[BSP_IntNestCtr - 1u]];
+        if (p_line->Done == DEF_NO) {
+            break;
+        }
+
+        lat = (CPU_TS)(p_line->EntryTS - p_line->ActiveTS);
+        if ((p_line->Stat.Nbr    == 0u) ||
+            (p_line->Stat.LatMin >  lat)) {
+            p_line->Stat.LatMin = lat;
+        }
+        if (p_line->Stat.LatMax < lat) {
+            p_line->Stat.LatMax = lat;
+        }
+        p_line->Stat.LatTot += lat;
+        p_line->Stat.Nbr++;
+
+        BSP_IntNestCtr--;
+        prio_cur = (BSP_IntNestCtr > 0u) ? BSP_IntLineTbl[BSP_IntActiveTbl[BSP_IntNestCtr - 1u]].Prio
+                                         : BSP_INT_PRIO_NBR;
+        int_id   =  BSP_IntNextGet(prio_cur);
+        if (int_id != BSP_INT_ID_NONE) {                        /* Chain to next ISR (see Note #2).                     */
+            BSP_IntStart(int_id);
+            break;
+        }
+
+        OSIntExit();
+        if (BSP_IntNestCtr == 0u) {
+            OSIntCurTaskResume();
+        } else {
+            ResumeThread(BSP_IntLineTbl[BSP_IntActiveTbl[BSP_IntNestCtr - 1u]].Thread);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          BSP_IntDispatch()
+*
+* Description : Enter the highest priority pending interrupt, if it can preempt the current level.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_YES, if an interrupt is pending but could not be entered yet;
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : BSP_IntCtrlW32().
+*
+* Note(s)     : (1) MUST be called with the critical section held, so that the suspended thread does NOT
+*                   hold it (see 'bsp_int.c  Note #1a').
+*
+*               (2) Before the first task runs, or while it is being created, the current task cannot be
+*                   suspended; the interrupt stays pending.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  BSP_IntDispatch (void)
+{
+    CPU_INT08U   prio_cur;
+    CPU_INT08U   int_id;
+    CPU_BOOLEAN  suspended;
+
+
+    prio_cur = (BSP_IntNestCtr > 0u) ? BSP_IntLineTbl[BSP_IntActiveTbl[BSP_IntNestCtr - 1u]].Prio
+                                     : BSP_INT_PRIO_NBR;
+    int_id   =  BSP_IntNextGet(prio_cur);
+    if (int_id == BSP_INT_ID_NONE) {
+        return (DEF_NO);
+    }
+
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* See Note #2.                                         */
+        return (DEF_YES);
+    }
+
+    if (BSP_IntNestCtr == 0u) {
+        suspended = OSIntCurTaskSuspend();
+        if (suspended != DEF_TRUE) {
+            return (DEF_YES);
+        }
+    } else {                                                    /* Nest: preempt ISR in progress.                       */
+        SuspendThread(BSP_IntLineTbl[BSP_IntActiveTbl[BSP_IntNestCtr - 1u]].Thread);
+    }
+
+    OSIntEnter();
+    BSP_IntStart(int_id);
+
+    return (DEF_NO);
+}
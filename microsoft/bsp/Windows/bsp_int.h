@@ -0,0 +1,130 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                          VIRTUAL INTERRUPT CONTROLLER BOARD SUPPORT PACKAGE (BSP)
+*
+* Filename : bsp_int.h
+*
+* Note(s)  : (1) The Win32 port has no interrupt other than the tick.  This module emulates an interrupt
+*                controller with BSP_INT_SRC_NBR prioritized lines, nesting, masking & programmable sources
+*                (periodic timer or stimulus file), so that ISR-driven code can be load-tested on the host.
+*
+*            (2) Priority 0 is the highest; a line preempts the ISR in progress only if its priority is
+*                strictly higher.  Lines at equal priority are serviced in line number order.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef  BSP_INT_PRESENT
+#define  BSP_INT_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+#include  <cpu_core.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BSP_INT_SRC_NBR                                  16u   /* Nbr of interrupt lines.                              */
+#define  BSP_INT_PRIO_NBR                                  8u   /* Nbr of priority levels (see Note #2).                */
+#define  BSP_INT_PEND_MAX                                 64u   /* Max pending occurrences per line (power of 2).       */
+
+#define  BSP_INT_SRC_FILE_NBR_MAX                       1024u   /* Max nbr of events in a stimulus file.                */
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  bsp_int_stat {
+    CPU_INT32U  Nbr;                                            /* Nbr of occurrences serviced.                         */
+    CPU_INT32U  OvfCtr;                                         /* Nbr of occurrences lost, line queue full.            */
+    CPU_TS      LatMin;                                         /* Entry latency, from raise to ISR, in CPU_TS counts.  */
+    CPU_TS      LatMax;
+    CPU_INT64U  LatTot;
+} BSP_INT_STAT;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  BSP_IntInit        (void);
+
+void         BSP_IntVectSet     (CPU_INT08U      int_id,
+                                 CPU_FNCT_VOID   isr);
+
+void         BSP_IntPrioSet     (CPU_INT08U      int_id,
+                                 CPU_INT08U      prio);
+
+void         BSP_IntPrioMaskSet (CPU_INT08U      prio);
+
+void         BSP_IntEn          (CPU_INT08U      int_id);
+
+void         BSP_IntDis         (CPU_INT08U      int_id);
+
+void         BSP_IntPend        (CPU_INT08U      int_id);
+
+void         BSP_IntClr         (CPU_INT08U      int_id);
+
+void         BSP_IntSrcTmrSet   (CPU_INT08U      int_id,
+                                 CPU_INT32U      rate_hz);
+
+CPU_BOOLEAN  BSP_IntSrcFileLoad (CPU_CHAR       *p_filename,
+                                 CPU_INT32U      period_us);
+
+void         BSP_IntStatGet     (CPU_INT08U      int_id,
+                                 BSP_INT_STAT   *p_stat);
+
+CPU_INT08U   BSP_IntNestMaxGet  (void);
+
+void         BSP_IntStatClr     (void);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of BSP_INT module include.                       */
@@ -49,6 +49,13 @@
 *********************************************************************************************************
 */
 
+                                                                /* Run router benchmarks before OSStart() (see os3/routeur_banc.c). */
+#define  APP_CFG_BANC_ESSAI_EN              DEF_DISABLED
+
+                                                                /* Pace TaskGenerate from a virtual IRQ (see bsp_int.h). */
+#define  APP_CFG_INT_ENTREE_EN              DEF_DISABLED
+#define  APP_CFG_INT_ENTREE_HZ                          1000u
+
 
 /*
 *********************************************************************************************************
@@ -103,6 +103,30 @@
 #define  CPU_CFG_TS_TMR_SIZE                    CPU_WORD_SIZE_32
 
 
+/*
+*********************************************************************************************************
+*                                 CPU TIMESTAMP TIMER SOURCE CONFIGURATION
+*
+* Note(s) : (1) Configure CPU_CFG_TS_TMR_TSC_EN to read CPU timestamps from the processor's time-stamp
+*               counter (RDTSC) instead of QueryPerformanceCounter() :
+*
+*               (a) The time-stamp counter is used only if the processor reports an invariant TSC
+*                   (CPUID 0x80000007, EDX bit 8); otherwise, QueryPerformanceCounter() is used.
+*
+*               (b) The time-stamp counter frequency is calibrated against QueryPerformanceCounter() by
+*                   CPU_TS_TmrInit() & prescaled to at most 100 MHz; a 32-bit CPU timestamp timer thus
+*                   wraps after at least 42.9 seconds.
+*
+*               See also 'bsp_cpu.c  CPU_TS_TmrInit()  Note #3'.
+*********************************************************************************************************
+*/
+
+                                                                /* Configure CPU timestamp timer source (see Note #1) : */
+#define  CPU_CFG_TS_TMR_TSC_EN                  DEF_ENABLED
+                                                                /*   DEF_DISABLED  QueryPerformanceCounter()            */
+                                                                /*   DEF_ENABLED   Invariant time-stamp counter         */
+
+
 /*
 *********************************************************************************************************
 *                        CPU INTERRUPTS DISABLED TIME MEASUREMENT CONFIGURATION
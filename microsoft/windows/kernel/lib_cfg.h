@@ -38,6 +38,18 @@
 #define  LIB_CFG_MODULE_PRESENT
 
 
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*
+* Note(s) : (1) 'app_cfg.h' selects the benchmark build (APP_CFG_BANC_ESSAI_EN), which enables the library
+*               features that the benchmarks measure (see os3/routeur_banc.c).
+*********************************************************************************************************
+*/
+
+#include  <app_cfg.h>
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -58,6 +70,9 @@
 *
 *               (b) When DISABLED, NO arguments received from any port interface provided by the developer
 *                   or application are checked/validated.
+*
+*           (2) The benchmark build enables the check, so that the Mem_PoolBlkFree() double-free check
+*               is measured (see 'INCLUDE FILES  Note #1').
 *********************************************************************************************************
 */
 
@@ -65,7 +80,11 @@
                                                                 /* Indicates if arguments received from any port ...    */
                                                                 /* ... interface provided by the developer or ...       */
                                                                 /* ... application are checked/validated.               */
+#if (defined(APP_CFG_BANC_ESSAI_EN) && (APP_CFG_BANC_ESSAI_EN == DEF_ENABLED))
+#define  LIB_MEM_CFG_ARG_CHK_EXT_EN     DEF_ENABLED             /* See Note #2.                                         */
+#else
 #define  LIB_MEM_CFG_ARG_CHK_EXT_EN     DEF_DISABLED
+#endif
 
 
 /*
@@ -82,6 +101,46 @@
 #define  LIB_MEM_CFG_OPTIMIZE_ASM_EN    DEF_DISABLED
 
 
+/*
+*********************************************************************************************************
+*                            MEMORY LIBRARY SIMD OPTIMIZATION CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_SIMD_EN to enable/disable SIMD-optimized memory function(s). The
+*               implementation (SSE2, AVX2 or NEON) is selected from CPUID by Mem_Init().
+*
+*           (2) Configure LIB_MEM_CFG_SIMD_NT_THRESHOLD with the size from which Mem_Set() & Mem_Copy()
+*               use non-temporal stores.
+*********************************************************************************************************
+*/
+
+                                                                /* SIMD-optimized function(s).                          */
+                                                                /* Enable/disable SIMD-optimized memory ...             */
+                                                                /* ... function(s). [see Note #1]                       */
+#define  LIB_MEM_CFG_SIMD_EN            DEF_ENABLED
+
+                                                                /* Non-temporal stores threshold, in octets.            */
+#define  LIB_MEM_CFG_SIMD_NT_THRESHOLD  (4096u * 1024u)         /* [see Note #2]                                        */
+
+
+/*
+*********************************************************************************************************
+*                                  DYNAMIC MEMORY POOL CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN to update the free list of dynamic memory pools
+*               with compare-and-swap. On the Win32 port, a critical section is a process-wide mutex.
+*
+*           (2) Configure LIB_MEM_CFG_DYN_POOL_CACHE_BATCH with the number of blocks moved at once between a
+*               dynamic memory pool cache & its pool.
+*********************************************************************************************************
+*/
+
+                                                                /* Lock-free dynamic memory pools.                      */
+#define  LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN  DEF_ENABLED         /* [see Note #1]                                        */
+
+                                                                /* Dynamic memory pool cache batch, in blocks.          */
+#define  LIB_MEM_CFG_DYN_POOL_CACHE_BATCH   16u                 /* [see Note #2]                                        */
+
+
 /*
 *********************************************************************************************************
 *                                   MEMORY ALLOCATION CONFIGURATION
@@ -99,6 +158,10 @@
 *
 *                   (2) Heap declared to Mem_Heap[] in 'lib_mem.c',       if LIB_MEM_CFG_HEAP_BASE_ADDR
 *                                                                            NOT #define'd in 'lib_cfg.h'
+*
+*           (3) The benchmark build creates its test pools once; their free block tables & allocation
+*               bitmaps, taken from the heap by Mem_PoolCreate(), need about 20 KB with 32-bit pointers
+*               (see 'INCLUDE FILES  Note #1').
 *********************************************************************************************************
 */
 
@@ -111,7 +174,11 @@
                                                                 /* Heap memory size (in bytes).                         */
                                                                 /* Configure the desired size of the heap memory. ...   */
                                                                 /* ... Set to 0 to disable heap allocation features.    */
+#if (defined(APP_CFG_BANC_ESSAI_EN) && (APP_CFG_BANC_ESSAI_EN == DEF_ENABLED))
+#define  LIB_MEM_CFG_HEAP_SIZE                 65536u           /* See Note #3.                                         */
+#else
 #define  LIB_MEM_CFG_HEAP_SIZE                  1024u
+#endif
 
 
                                                                 /* Heap memory padding alignment (in bytes).            */
@@ -142,12 +209,19 @@
 *               digits to calculate &/or display for floating point string function(s).
 *
 *               See also 'lib_str.h  STRING FLOATING POINT DEFINES  Note #1'.
+*
+*           (3) The benchmark build enables floating point string functions, so that Str_FmtNbr_32() is
+*               measured (see 'INCLUDE FILES  Note #1').
 *********************************************************************************************************
 */
 
                                                                 /* Floating point feature(s).                           */
                                                                 /* Enable/disable floating point to string functions.   */
+#if (defined(APP_CFG_BANC_ESSAI_EN) && (APP_CFG_BANC_ESSAI_EN == DEF_ENABLED))
+#define  LIB_STR_CFG_FP_EN                      DEF_ENABLED     /* See Note #3.                                         */
+#else
 #define  LIB_STR_CFG_FP_EN                      DEF_DISABLED
+#endif
 
 
                                                                 /* Floating point number of significant digits.         */
@@ -157,6 +231,52 @@
 #define  LIB_STR_CFG_FP_MAX_NBR_DIG_SIG         LIB_STR_FP_MAX_NBR_DIG_SIG_DFLT
 
 
+/*
+*********************************************************************************************************
+*                                STRING NUMBER FORMAT CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_STR_CFG_FMT_FAST_EN to enable/disable the fast number format core.
+*
+*               See also 'lib_str.h  STRING NUMBER FORMAT CONFIGURATION  Note #1'.
+*********************************************************************************************************
+*/
+
+                                                                /* Number format.                                       */
+                                                                /* Enable/disable fast number to string format.         */
+#define  LIB_STR_CFG_FMT_FAST_EN                DEF_ENABLED
+
+
+/*
+*********************************************************************************************************
+*                                 STRING NUMBER PARSE CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_STR_CFG_PARSE_FAST_EN to enable/disable the fast number parse core.
+*
+*               See also 'lib_str.h  STRING NUMBER PARSE CONFIGURATION  Note #1'.
+*********************************************************************************************************
+*/
+
+                                                                /* Number parse.                                        */
+                                                                /* Enable/disable fast string to number parse.          */
+#define  LIB_STR_CFG_PARSE_FAST_EN              DEF_ENABLED
+
+
+/*
+*********************************************************************************************************
+*                                     STRING SIMD CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_STR_CFG_SIMD_EN to enable/disable the vectorized string search & compare
+*               functions; requires LIB_MEM_CFG_SIMD_EN.
+*
+*               See also 'lib_str.h  STRING SIMD CONFIGURATION  Note #1'.
+*********************************************************************************************************
+*/
+
+                                                                /* SIMD string function(s).                             */
+                                                                /* Enable/disable vectorized string functions.          */
+#define  LIB_STR_CFG_SIMD_EN                    DEF_ENABLED
+
+
 /*
 *********************************************************************************************************
 *                                             MODULE END
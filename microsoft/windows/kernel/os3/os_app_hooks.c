@@ -261,11 +261,16 @@ void  App_OS_TaskSwHook (void)
 * Arguments  : none
 *
 * Note(s)    : 1) This function is assumed to be called from the Tick ISR.
+*
+*              2) CPU_TS_Update() is called at least once per timestamp timer wrap so that CPU_TS_Get64() stays
+*                 exact between two distant reads (see 'cpu_core.c  CPU_TS_Update()  Note #1a').
 ************************************************************************************************************************
 */
 
 void  App_OS_TimeTickHook (void)
 {
-
+#if (CPU_CFG_TS_EN == DEF_ENABLED)
+    CPU_TS_Update();
+#endif
 }
 
@@ -43,6 +43,7 @@
 #define OS_CFG_DYN_TICK_EN              DEF_DISABLED            /* Enable (DEF_ENABLED) the Dynamic Tick                                 */
 #define OS_CFG_INVALID_OS_CALLS_CHK_EN  DEF_ENABLED             /* Enable (DEF_ENABLED) checks for invalid kernel calls                  */
 #define OS_CFG_OBJ_TYPE_CHK_EN          DEF_ENABLED             /* Enable (DEF_ENABLED) object type checking                             */
+#define OS_CFG_PEND_SPIN_EN             DEF_ENABLED             /* Include (DEF_ENABLED) code for OS_OPT_PEND_SPIN (needs time stamping) */
 #define OS_CFG_TS_EN                    DEF_ENABLED            /* Enable (DEF_ENABLED) time stamping                                    */
 
 #define OS_CFG_PRIO_MAX                 64u                     /* Defines the maximum number of task priorities (see OS_PRIO data type) */
@@ -75,6 +76,8 @@
 #define OS_CFG_Q_DEL_EN                 DEF_ENABLED             /*     Include (DEF_ENABLED) code for OSQDel()                           */
 #define OS_CFG_Q_FLUSH_EN               DEF_ENABLED             /*     Include (DEF_ENABLED) code for OSQFlush()                         */
 #define OS_CFG_Q_PEND_ABORT_EN          DEF_ENABLED             /*     Include (DEF_ENABLED) code for OSQPendAbort()                     */
+#define OS_CFG_Q_POST_BLOCKING_EN       DEF_ENABLED             /*     Include (DEF_ENABLED) code for OS_OPT_POST_BLOCKING, OSQPostTimeout() */
+#define OS_CFG_Q_COALESCE_EN            DEF_ENABLED             /*     Include (DEF_ENABLED) code for OS_OPT_PEND_COALESCE, OSQCoalesceSet() */
 
 
                                                                 /* ---------------------------- SEMAPHORES ----------------------------- */
@@ -94,6 +97,8 @@
 #define OS_CFG_TASK_PROFILE_EN          1u                      /* Include (DEF_ENABLED) variables in OS_TCB for profiling               */
 #define OS_CFG_TASK_Q_EN                DEF_ENABLED             /* Include (DEF_ENABLED) code for OSTaskQXXXX()                          */
 #define OS_CFG_TASK_Q_PEND_ABORT_EN     DEF_ENABLED             /* Include (DEF_ENABLED) code for OSTaskQPendAbort()                     */
+#define OS_CFG_TASK_Q_POST_BLOCKING_EN  DEF_ENABLED             /* Include (DEF_ENABLED) code for OS_OPT_POST_BLOCKING, OSTaskQPostTimeout() */
+#define OS_CFG_TASK_Q_COALESCE_EN       DEF_ENABLED             /* Include (DEF_ENABLED) code for OS_OPT_PEND_COALESCE, OSTaskQCoalesceSet() */
 #define OS_CFG_TASK_REG_TBL_SIZE        1u                      /* Number of task specific registers                                     */
 #define OS_CFG_TASK_STK_REDZONE_EN      DEF_DISABLED            /* Enable (DEF_ENABLED) stack redzone                                    */
 #define OS_CFG_TASK_STK_REDZONE_DEPTH   8u                      /* Depth of the stack redzone                                        */
@@ -47,6 +47,8 @@
 
 #define  OS_CFG_TASK_STK_LIMIT_PCT_EMPTY              10u       /* Stack limit position in percentage to empty          */
 
+#define  OS_CFG_PEND_SPIN_MAX_US                      50u       /* Longest poll before blocking with OS_OPT_PEND_SPIN   */
+
 
                                                                 /* -------------------- IDLE TASK --------------------- */
 #define  OS_CFG_IDLE_TASK_STK_SIZE                    64u       /* Stack size (number of CPU_STK elements)              */
@@ -0,0 +1,28 @@
+/*
+ * paquet.h
+ *
+ *  Format des paquets qui circulent dans le routeur. Séparé de routeur.h pour que les modules
+ *  (CRC, générateur, ...) puissent l'inclure sans les variables globales du routeur.
+ */
+
+#ifndef SRC_PAQUET_H_
+#define SRC_PAQUET_H_
+
+typedef enum {
+	PACKET_VIDEO,
+	PACKET_AUDIO,
+	PACKET_AUTRE,
+	NB_PACKET_TYPE
+} PACKET_TYPE;
+
+// 64 octets : le CRC32C couvre tous les champs qui le précèdent
+typedef struct {
+    unsigned int src;
+    unsigned int dst;
+    PACKET_TYPE type;
+    unsigned int data[11];
+    unsigned int ts;								// CPU_TS de création par TaskGenerate (latence de bout en bout)
+    unsigned int crc;
+} Packet;
+
+#endif /* SRC_PAQUET_H_ */
@@ -9,10 +9,25 @@
 #define SRC_ROUTEUR_H_
 
 #include <os.h>
+#include <lib_mem.h>
 #include <stdlib.h>
 #include <inttypes.h>
 #include <stdbool.h>
 
+#include "paquet.h"
+#include "routeur_compteurs.h"
+#include "routeur_table.h"
+#include "routeur_filtre.h"
+#include "routeur_simd.h"
+#include "routeur_crc.h"
+#include "routeur_pool.h"
+#include "routeur_trafic.h"
+#include "routeur_journal.h"
+#include "routeur_ordo.h"
+#include "routeur_jetons.h"
+#include "routeur_aqm.h"
+#include "routeur_latence.h"
+
 #define ARRAY_SIZE(x) (sizeof(x)/sizeof(x[0]))
 
 #define TASK_STK_SIZE 8192
@@ -26,13 +41,88 @@
 #define          TaskComputingPRIO  			21
 #define          TaskForwardingPRIO 			22
 #define          TaskOutputPortPRIO     		20
+#define          TaskJournalPRIO     			30
 
 #define			 WAITFORComputing 3
 
+// Nombre de tâches TaskComputing (même priorité, en tourniquet) et capacité totale de leur fifo d'entrée
+#ifndef NB_COMPUTING_TASKS
+#define NB_COMPUTING_TASKS 3
+#endif
+
+#define			 TAILLE_FIFO_ENTREE 1024
+
+// Mode d'exécution, choisi au démarrage (voir create_mode) :
+//  - MODE_PIPELINE : TaskComputing -> highQ/mediumQ/lowQ -> TaskForwarding -> files des ports
+//  - MODE_RTC      : run-to-completion, chaque tâche TaskComputing valide, classe, ordonnance et route
+//                    elle-même ses paquets par lots de LOT_RTC. Il ne reste que la fifo d'entrée et les
+//                    files des ports ; la gestion active (AQM) des files de classe ne s'applique pas.
+// La variable d'environnement ROUTEUR_MODE (pipeline ou rtc) remplace MODE_ROUTEUR_DEFAUT.
+typedef enum {
+	MODE_PIPELINE,
+	MODE_RTC
+} MODE_ROUTEUR;
+
+#ifndef MODE_ROUTEUR_DEFAUT
+#define MODE_ROUTEUR_DEFAUT MODE_PIPELINE
+#endif
+#define			 LOT_RTC POOL_QUANTUM			// Au plus un quantum : un lot vient d'un seul seau du pool
+
+MODE_ROUTEUR ModeRouteur;
+
+// Ordonnancement des classes dans TaskForwarding : ORDO_STRICT, ORDO_DRR ou ORDO_WFQ (voir create_ordo)
+#ifndef ORDO_POLITIQUE_FORWARDING
+#define ORDO_POLITIQUE_FORWARDING ORDO_DRR
+#endif
+
+// Gestion active de highQ, mediumQ et lowQ : AQM_AUCUNE, AQM_RED ou AQM_CODEL (voir create_aqm)
+#ifndef AQM_POLITIQUE_FILES
+#define AQM_POLITIQUE_FILES AQM_CODEL
+#endif
+
+// Dépôt bloquant dans highQ/mediumQ/lowQ et dans les files des ports : un producteur qui trouve la
+// file pleine attend au plus ATTENTE_POST_MAX ticks qu'une place se libère avant de jeter le paquet.
+// Avec DEF_DISABLED, le paquet est jeté tout de suite (OS_ERR_Q_MAX), comme avant.
+#ifndef POST_BLOQUANT_EN
+#define POST_BLOQUANT_EN DEF_ENABLED
+#endif
+#define ATTENTE_POST_MAX 2
+
+#if (POST_BLOQUANT_EN == DEF_ENABLED)
+#define OPT_POST_FILES   (OS_OPT_POST_FIFO | OS_OPT_POST_BLOCKING)
+#else
+#define OPT_POST_FILES   OS_OPT_POST_FIFO
+#endif
+
+// Nombre maximum de paquets émis par flux de trafic à chaque réveil de TaskGenerate
+#define			 GENERATE_LOT_MAX 64
+
 
 // Routing info.
+// Le nombre de ports peut être augmenté (jusqu'à TABLE_PORT_MAX) ; la table de routage par défaut
+// ci-dessous n'utilise que les ports 0 à 2, les autres se configurent dans TABLE_FICHIER_ROUTES.
 
+#ifndef NB_OUTPUT_PORTS
 #define NB_OUTPUT_PORTS 3
+#endif
+
+// Mise en forme des ports de sortie (routeur_jetons.c) : débit en octets par seconde (0 : illimité),
+// rafale en octets, et longueur de la file de chaque port, où les paquets attendent leurs jetons.
+// Désactivée par défaut ; pour limiter chaque port à 50 paquets/s par exemple, définir
+// DEBIT_PORT=(50*sizeof(Packet)) dans les définitions du préprocesseur du projet.
+#ifndef DEBIT_PORT
+#define DEBIT_PORT       0
+#endif
+#define RAFALE_PORT      (16 * sizeof(Packet))
+#define TAILLE_FILE_PORT 64
+
+// Regroupement des réveils de TaskOutputPort (OS_OPT_PEND_COALESCE) : la tâche ne se réveille qu'une
+// fois LOT_REVEIL_PORT paquets dans sa file, ou ATTENTE_REVEIL_PORT ticks après le premier, puis vide
+// sa file. Avec LOT_REVEIL_PORT à 1, chaque paquet réveille la tâche, comme avant.
+#ifndef LOT_REVEIL_PORT
+#define LOT_REVEIL_PORT     8
+#endif
+#define ATTENTE_REVEIL_PORT 2
 
 #define INT1_LOW      0x00000000
 #define INT1_HIGH     0x3FFFFFFF
@@ -44,6 +134,8 @@
 #define INT_BC_HIGH   0xFFFFFFFF
 
 // Reject source info.
+// Règles par défaut du filtre de rejet (routeur_filtre.c). Les bornes sont exclues, comme dans
+// la comparaison d'origine (src > REJECT_LOWx && src < REJECT_HIGHx).
 #define REJECT_LOW1   0x10000000
 #define REJECT_HIGH1  0x17FFFFFF
 #define REJECT_LOW2   0x50000000
@@ -55,29 +147,18 @@
 
 typedef struct{
 	int id;
-	char* name;
+	char name[16];
 } Info_Port;
 
 Info_Port  Port[NB_OUTPUT_PORTS];
-
-typedef enum {
-	PACKET_VIDEO,
-	PACKET_AUDIO,
-	PACKET_AUTRE,
-	NB_PACKET_TYPE
-} PACKET_TYPE;
-
-typedef struct {
-    unsigned int src;
-    unsigned int dst;
-    PACKET_TYPE type;
-    unsigned int data[13];
-} Packet;
+JETONS_SEAU Jetons[NB_OUTPUT_PORTS];				// Un seau à jetons par port
+LATENCE_HISTO Latences[NB_OUTPUT_PORTS][NB_PACKET_TYPE];	// Écrit par la tâche du port ; TaskStats cumule par classe ou par port
+Info_Port  Computing[NB_COMPUTING_TASKS];				// Même rôle pour les tâches TaskComputing
 
 // Stacks
 static CPU_STK TaskGenerateSTK[TASK_STK_SIZE];
 
-static CPU_STK TaskComputingSTK[TASK_STK_SIZE];
+static CPU_STK TaskComputingSTK[NB_COMPUTING_TASKS][TASK_STK_SIZE];
 
 static CPU_STK TaskForwardingSTK[TASK_STK_SIZE];
 
@@ -85,13 +166,16 @@ static CPU_STK TaskOutputPortSTK[NB_OUTPUT_PORTS][TASK_STK_SIZE];
 
 static CPU_STK TaskStatsSTK[TASK_STK_SIZE];
 
+static CPU_STK TaskJournalSTK[TASK_STK_SIZE];
+
 //static CPU_STK StartupTaskStk[TASK_STK_SIZE];
 
 static OS_TCB TaskGenerateTCB;
 static OS_TCB TaskStatsTCB;
-static OS_TCB TaskComputingTCB;
+static OS_TCB TaskComputingTCB[NB_COMPUTING_TASKS];
 static OS_TCB TaskForwardingTCB;
 static OS_TCB TaskOutputPortTCB[NB_OUTPUT_PORTS];
+static OS_TCB TaskJournalTCB;
 //static OS_TCB StartupTaskTCB;
 
 /* ************************************************
@@ -102,27 +186,83 @@ OS_Q lowQ;
 OS_Q mediumQ;
 OS_Q highQ;
 
+AQM_FILE Aqm[NB_PACKET_TYPE];						// Gestion active de chaque file, dans l'ordre de PACKET_TYPE
+
 /* ************************************************
  *                  Semaphores
  **************************************************/
 
-// Pas de sémaphore pour la partie 1 
+// Sonnette de TaskForwarding : signalée à chaque paquet déposé dans highQ, mediumQ ou lowQ
+OS_SEM semForwarding;
 
 /* ************************************************
  *                  Mutexes
  **************************************************/
-OS_MUTEX mutRejete;
 OS_MUTEX mutPrint;
-OS_MUTEX mutAlloc;
+OS_MUTEX mutOrdo;									// Ordonnanceur de classes partagé en MODE_RTC
 
 
 /*DECLARATION DES COMPTEURS POUR STATISTIQUES*/
-int nbPacketCrees = 0;								// Nb de packets total créés
-int nbPacketTraites = 0;							// Nb de paquets envoyés sur une interface
-int nbPacketSourceRejete = 0;						// Nb de packets rejetés pour mauvaise source
-int packet_rejete_fifo_pleine_inputQ = 0;			// Utilisation de la fifo d'entrée
-int packet_rejete_output_port_plein = 0;			// Utilisation des MB
-int packet_rejete_3Q = 0;
+// Les compteurs sont dans routeur_compteurs.c ; chaque tâche écrit dans sa propre tranche
+typedef enum {
+	SHARD_GENERATE,
+	SHARD_FORWARDING,
+	SHARD_COMPUTING,								// Une tranche par tâche de traitement : SHARD_COMPUTING + id
+	SHARD_OUTPUT_PORT = SHARD_COMPUTING + NB_COMPUTING_TASKS,	// Une tranche par port : SHARD_OUTPUT_PORT + id
+	NB_SHARDS = SHARD_OUTPUT_PORT + NB_OUTPUT_PORTS
+} SHARD_ID;
+
+// Vérification à la compilation : le tableau a une taille négative si cond est fausse
+#define VERIF_COMPILATION(nom, cond)	typedef char nom[(cond) ? 1 : -1]
+
+// compteurs_ajouter ignore une tranche hors de CPT_NB_SHARDS_MAX : chaque tâche doit en avoir une
+VERIF_COMPILATION(verif_nb_shards_compteurs, NB_SHARDS <= CPT_NB_SHARDS_MAX);
+// Chaque tranche écrit aussi dans l'anneau de journal de même numéro (journal_ecrire)
+VERIF_COMPILATION(verif_nb_shards_journal, NB_SHARDS <= JOURNAL_NB_ANNEAUX_MAX);
+
+/* ************************************************
+ *                  Paquets
+ **************************************************/
+
+// Les paquets sont pris dans un slab (lib_mem.c) taillé dans un segment statique de TAILLE_SEG_PAQUETS
+// octets ; chaque tâche passe par la cache de sa tranche (SHARD_ID), qui n'a qu'un seul écrivain et
+// ne prend la section critique que pour se remplir ou se vider par lots.
+#ifndef TAILLE_SEG_PAQUETS
+#define TAILLE_SEG_PAQUETS	(1024u * 1024u)
+#endif
+
+MEM_SEG        SegPaquets;
+MEM_SLAB       SlabPaquets;
+MEM_SLAB_CACHE CachePaquets[NB_SHARDS];
+
+/* ************************************************
+ *                  Journal
+ **************************************************/
+
+// Messages des tâches du pipeline ; les textes sont dans FormatsJournal (routeur_simulation.c).
+// Chaque tâche écrit dans l'anneau de même numéro que sa tranche de compteurs (SHARD_ID).
+typedef enum {
+	JNL_FIFO_ENTREE_PRODUCTION,
+	JNL_FIFO_ENTREE_PLEINE,
+	JNL_FIFO_ENTREE_CONSOMMATION,
+	JNL_CRC_INVALIDE,
+	JNL_SOURCE_INVALIDE,
+	JNL_HIGHQ_PRODUCTION,
+	JNL_MEDIUMQ_PRODUCTION,
+	JNL_LOWQ_PRODUCTION,
+	JNL_Q_PLEINE,
+	JNL_AQM_REJET,
+	JNL_HIGHQ_CONSOMMATION,
+	JNL_MEDIUMQ_CONSOMMATION,
+	JNL_LOWQ_CONSOMMATION,
+	JNL_PAQUETS_ENVOYES,
+	JNL_PORT,
+	JNL_DIFFUSION,
+	JNL_SANS_ROUTE,
+	JNL_PORT_PLEIN,
+	JNL_PAQUET_RECU,
+	NB_JNL
+} JOURNAL_MSG;
 
 /* ************************************************
  *              TASK PROTOTYPES
@@ -131,15 +271,26 @@ int packet_rejete_3Q = 0;
 void TaskGenerate(void *data); 
 void TaskComputing(void *data);
 void TaskForwarding(void *data);
+void TaskRunToCompletion(void *data);
 void TaskOutputPort(void *data);
 void TaskStats(void* data);
 //void StartupTask(void* data);
 
-void dispatch_packet (Packet* packet);
+void dispatch_packet (Packet* packet, CPU_INT32U shard);
+void router_paquet(Packet* packet, CPU_INT16U port, CPU_INT32U shard);
+void envoyer_port(int port, Packet* packet, CPU_INT32U shard);
+Packet* paquet_allouer(CPU_INT32U shard);
+void paquet_liberer(Packet* packet, CPU_INT32U shard);
 
-void create_application();
+int create_application();
 int create_tasks();
 int create_events();
+void create_routes();
+void create_filtre();
+void create_ordo();
+void create_aqm();
+void create_mode();
+const char* mode_nom();
 void err_msg(char* ,uint8_t);
 void Suspend_Delay_Resume_All(int nb_sec);
 
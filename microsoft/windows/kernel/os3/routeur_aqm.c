@@ -0,0 +1,216 @@
+/*
+*********************************************************************************************************
+*                                                 uC/OS-III
+*                                          The Real-Time Kernel
+*                                               PORT Windows
+*
+*
+*                                  Polytechnique Montreal, Qc, CANADA
+*
+* File : routeur_aqm.c
+*
+*********************************************************************************************************
+*/
+
+#include "routeur_aqm.h"
+
+#include  <math.h>
+#include  <lib_math.h>
+#include  "routeur_atomique.h"
+
+#define AQM_UN		65536u							// 1,0 en virgule fixe 16.16
+
+
+static CPU_TS aqm_us_vers_ts(CPU_INT32U us) {
+	CPU_ERR err;
+	CPU_TS_TMR_FREQ freq = CPU_TS_TmrFreqGet(&err);
+
+	if (freq == 0u)
+		freq = 1000000u;
+	return (CPU_TS)(((CPU_INT64U)us * freq) / 1000000u);
+}
+
+static CPU_INT32U aqm_ts_vers_us(CPU_TS ts) {
+	CPU_ERR err;
+	CPU_TS_TMR_FREQ freq = CPU_TS_TmrFreqGet(&err);
+
+	if (freq == 0u)
+		return ts;
+	return (CPU_INT32U)(((CPU_INT64U)ts * 1000000u) / freq);
+}
+
+// Vrai si l'instant a est atteint ou dépassé à l'instant b (compteur circulaire)
+static CPU_BOOLEAN aqm_atteint(CPU_TS a, CPU_TS b) {
+	return ((CPU_INT32S)(CPU_TS)(b - a) >= 0) ? DEF_YES : DEF_NO;
+}
+
+// Loi de commande de CoDel : la prochaine chute arrive après intervalle / sqrt(compte)
+static CPU_TS aqm_loi_codel(const AQM_FILE* file, CPU_TS t) {
+	return t + (CPU_TS)((double)file->intervalle / sqrt((double)file->compte));
+}
+
+static AQM_DECISION aqm_sanction(AQM_FILE* file, CPU_BOOLEAN marquable) {
+	if (marquable && file->cfg.ecn) {
+		ATOM_INC32(&file->marques);
+		return AQM_MARQUER;
+	}
+	ATOM_INC32(&file->jetes);
+	return AQM_JETER;
+}
+
+
+/*
+ *********************************************************************************************************
+ *											  aqm_init
+ *  - À appeler après CPU_Init() (la fréquence de CPU_TS sert à convertir les durées de CoDel)
+ *********************************************************************************************************
+ */
+void aqm_init(AQM_FILE* file, const AQM_CONFIG* cfg) {
+	file->cfg = *cfg;
+	if (file->cfg.red_seuil_max <= file->cfg.red_seuil_min)
+		file->cfg.red_seuil_max = file->cfg.red_seuil_min + 1u;
+	if (file->cfg.red_proba_max > AQM_UN)
+		file->cfg.red_proba_max = AQM_UN;
+
+	file->red_moyenne = 0u;
+	file->red_compte = 0u;
+	file->red_alea = 1u;
+
+	file->cible = aqm_us_vers_ts(cfg->codel_cible_us);
+	file->intervalle = aqm_us_vers_ts(cfg->codel_intervalle_us);
+	file->au_dessus = DEF_NO;
+	file->premier_au_dessus = 0u;
+	file->en_chute = DEF_NO;
+	file->prochaine_chute = 0u;
+	file->compte = 0u;
+	file->dernier_compte = 0u;
+
+	file->jetes = 0u;
+	file->marques = 0u;
+	file->sejour_max_us = 0u;
+}
+
+/*
+ *********************************************************************************************************
+ *											  aqm_entree
+ *  - Décision RED avant le dépôt d'un paquet dans une file qui en contient déjà longueur
+ *  - Plusieurs tâches peuvent déposer dans la même file : l'état est protégé par une section critique
+ *********************************************************************************************************
+ */
+AQM_DECISION aqm_entree(AQM_FILE* file, CPU_INT32U longueur) {
+	const AQM_CONFIG* cfg = &file->cfg;
+	CPU_INT32U min, max, pb, pa, tirage;
+	CPU_INT32S ecart;
+	AQM_DECISION decision = AQM_ACCEPTER;
+	CPU_SR_ALLOC();
+
+	if (cfg->politique != AQM_RED)
+		return AQM_ACCEPTER;
+
+	min = cfg->red_seuil_min * AQM_UN;
+	max = cfg->red_seuil_max * AQM_UN;
+
+	CPU_CRITICAL_ENTER();
+	ecart = (CPU_INT32S)(longueur * AQM_UN) - (CPU_INT32S)file->red_moyenne;
+	file->red_moyenne = (CPU_INT32U)((CPU_INT32S)file->red_moyenne + (ecart >> cfg->red_poids_log2));
+
+	if (file->red_moyenne >= max) {
+		file->red_compte = 0u;
+		decision = AQM_JETER;
+	}
+	else if (file->red_moyenne >= min) {
+		// pb croît linéairement entre les seuils ; pa étale les rejets (pb / (1 - compte * pb))
+		pb = (CPU_INT32U)(((CPU_INT64U)cfg->red_proba_max * (file->red_moyenne - min)) / (max - min));
+		file->red_compte++;
+		if ((CPU_INT64U)file->red_compte * pb >= AQM_UN)
+			pa = AQM_UN;
+		else
+			pa = (CPU_INT32U)(((CPU_INT64U)pb * AQM_UN) / (AQM_UN - file->red_compte * pb));
+
+		file->red_alea = Math_RandSeed(file->red_alea);
+		tirage = (file->red_alea >> 15) & (AQM_UN - 1u);
+		if (tirage < pa) {
+			file->red_compte = 0u;
+			decision = AQM_MARQUER;
+		}
+	}
+	else {
+		file->red_compte = 0u;
+	}
+	CPU_CRITICAL_EXIT();
+
+	if (decision == AQM_ACCEPTER)
+		return AQM_ACCEPTER;
+
+	return aqm_sanction(file, (decision == AQM_MARQUER) ? DEF_YES : DEF_NO);
+}
+
+/*
+ *********************************************************************************************************
+ *											  aqm_sortie
+ *  - Décision CoDel pour le paquet qui vient d'être retiré ; ts_entree est l'estampille rendue par
+ *    OSQPend, longueur_restante le nombre de paquets encore dans la file
+ *  - Si le paquet est jeté, l'appelant retire le suivant et rappelle aqm_sortie
+ *  - Mesure le temps de séjour quelle que soit la politique
+ *********************************************************************************************************
+ */
+AQM_DECISION aqm_sortie(AQM_FILE* file, CPU_TS ts_entree, CPU_INT32U longueur_restante) {
+	CPU_TS maintenant = OS_TS_GET();
+	CPU_TS sejour = maintenant - ts_entree;
+	CPU_INT32U sejour_us = aqm_ts_vers_us(sejour);
+	CPU_BOOLEAN permis = DEF_NO;
+	CPU_INT32U delta;
+
+	if (sejour_us > file->sejour_max_us)
+		ATOM_ECRIRE32(&file->sejour_max_us, sejour_us);
+
+	if (file->cfg.politique != AQM_CODEL)
+		return AQM_ACCEPTER;
+
+	// Le séjour doit rester au-dessus de la cible pendant tout un intervalle avant de jeter
+	if (sejour < file->cible || longueur_restante <= 1u) {
+		file->au_dessus = DEF_NO;
+	}
+	else if (file->au_dessus == DEF_NO) {
+		file->au_dessus = DEF_YES;
+		file->premier_au_dessus = maintenant + file->intervalle;
+	}
+	else if (aqm_atteint(file->premier_au_dessus, maintenant)) {
+		permis = DEF_YES;
+	}
+
+	if (file->en_chute) {
+		if (!permis) {
+			file->en_chute = DEF_NO;
+		}
+		else if (aqm_atteint(file->prochaine_chute, maintenant)) {
+			file->compte++;
+			file->prochaine_chute = aqm_loi_codel(file, file->prochaine_chute);
+			return aqm_sanction(file, DEF_YES);
+		}
+	}
+	else if (permis) {
+		// Reprise rapide si l'état de chute vient d'être quitté
+		file->en_chute = DEF_YES;
+		delta = file->compte - file->dernier_compte;
+		if (delta > 1u && !aqm_atteint(file->prochaine_chute + 16u * file->intervalle, maintenant))
+			file->compte = delta;
+		else
+			file->compte = 1u;
+		file->dernier_compte = file->compte;
+		file->prochaine_chute = aqm_loi_codel(file, maintenant);
+		return aqm_sanction(file, DEF_YES);
+	}
+	return AQM_ACCEPTER;
+}
+
+const char* aqm_nom(const AQM_FILE* file) {
+	switch (file->cfg.politique) {
+	case AQM_RED:
+		return "RED";
+	case AQM_CODEL:
+		return "CoDel";
+	default:
+		return "aucune";
+	}
+}
@@ -0,0 +1,70 @@
+/*
+ * routeur_aqm.h
+ *
+ *  Gestion active des files de classe (highQ, mediumQ, lowQ).
+ *
+ *  - AQM_RED   : décision à l'entrée, selon la longueur moyenne (EWMA) de la file.
+ *  - AQM_CODEL : décision à la sortie, selon le temps de séjour du paquet, mesuré avec l'estampille
+ *                que uC/OS-III range dans chaque message (MsgTS, rendue par OSQPend).
+ *
+ *  Avec ecn, un paquet qui serait jeté avant la saturation est seulement marqué. Le paquet n'ayant
+ *  pas de bit ECN, la marque n'est visible que dans les statistiques.
+ */
+
+#ifndef SRC_ROUTEUR_AQM_H_
+#define SRC_ROUTEUR_AQM_H_
+
+#include <os.h>
+
+typedef enum {
+	AQM_AUCUNE,										// Rejet en queue seulement (OS_ERR_Q_MAX)
+	AQM_RED,
+	AQM_CODEL
+} AQM_POLITIQUE;
+
+typedef enum {
+	AQM_ACCEPTER,
+	AQM_JETER,
+	AQM_MARQUER
+} AQM_DECISION;
+
+typedef struct {
+	AQM_POLITIQUE politique;
+	CPU_BOOLEAN   ecn;								// Marquer plutôt que jeter quand c'est possible
+	CPU_INT32U    red_seuil_min;					// RED : longueur moyenne, en paquets
+	CPU_INT32U    red_seuil_max;
+	CPU_INT32U    red_proba_max;					// RED : probabilité au seuil max, sur 65536
+	CPU_INT32U    red_poids_log2;					// RED : poids de l'EWMA = 2^-n
+	CPU_INT32U    codel_cible_us;					// CoDel : séjour toléré (5 ms dans la RFC 8289)
+	CPU_INT32U    codel_intervalle_us;				// CoDel : fenêtre d'observation (100 ms)
+} AQM_CONFIG;
+
+typedef struct {
+	AQM_CONFIG  cfg;
+
+	// RED (modifié par les tâches qui déposent, en section critique)
+	CPU_INT32U  red_moyenne;						// Longueur moyenne x 65536
+	CPU_INT32U  red_compte;							// Paquets acceptés depuis le dernier rejet
+	CPU_INT32U  red_alea;
+
+	// CoDel (modifié par la seule tâche qui retire)
+	CPU_TS      cible;								// En unités de CPU_TS
+	CPU_TS      intervalle;
+	CPU_BOOLEAN au_dessus;
+	CPU_TS      premier_au_dessus;
+	CPU_BOOLEAN en_chute;
+	CPU_TS      prochaine_chute;
+	CPU_INT32U  compte;
+	CPU_INT32U  dernier_compte;
+
+	volatile CPU_INT32U jetes;
+	volatile CPU_INT32U marques;
+	volatile CPU_INT32U sejour_max_us;
+} AQM_FILE;
+
+void         aqm_init(AQM_FILE* file, const AQM_CONFIG* cfg);
+AQM_DECISION aqm_entree(AQM_FILE* file, CPU_INT32U longueur);
+AQM_DECISION aqm_sortie(AQM_FILE* file, CPU_TS ts_entree, CPU_INT32U longueur_restante);
+const char*  aqm_nom(const AQM_FILE* file);
+
+#endif /* SRC_ROUTEUR_AQM_H_ */
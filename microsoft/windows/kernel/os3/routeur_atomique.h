@@ -0,0 +1,61 @@
+/*
+ * routeur_atomique.h
+ *
+ *  Opérations atomiques minimales utilisées par les modules du routeur qui évitent les mutex.
+ *
+ *  Sur le port Win32, les tâches uC/OS-III sont des fils Windows qui peuvent être suspendus
+ *  n'importe où par le fil du tick. Un accès 64 bits ordinaire peut donc être coupé en deux
+ *  sur x86 : on passe par les intrinsèques Interlocked (MSVC) ou __atomic (gcc/clang).
+ */
+
+#ifndef SRC_ROUTEUR_ATOMIQUE_H_
+#define SRC_ROUTEUR_ATOMIQUE_H_
+
+#include <cpu.h>
+
+#ifdef _MSC_VER
+#include  <intrin.h>
+
+#pragma intrinsic(_InterlockedCompareExchange64)
+#pragma intrinsic(_InterlockedCompareExchange)
+#pragma intrinsic(_InterlockedIncrement)
+#pragma intrinsic(_InterlockedDecrement)
+#pragma intrinsic(_ReadWriteBarrier)
+
+#define ATOM_LIRE64(p)				((CPU_INT64U)_InterlockedCompareExchange64((volatile __int64*)(p), 0, 0))
+#define ATOM_CAS64(p, anc, nouv)	((CPU_INT64U)_InterlockedCompareExchange64((volatile __int64*)(p), (__int64)(nouv), (__int64)(anc)) == (CPU_INT64U)(anc))
+#define ATOM_CAS32(p, anc, nouv)	((CPU_INT32U)_InterlockedCompareExchange((volatile long*)(p), (long)(nouv), (long)(anc)) == (CPU_INT32U)(anc))
+#define ATOM_INC32(p)				((CPU_INT32U)_InterlockedIncrement((volatile long*)(p)))
+#define ATOM_DEC32(p)				((CPU_INT32U)_InterlockedDecrement((volatile long*)(p)))
+// Avec /volatile:ms (défaut x86/x64), un accès volatile a déjà la sémantique acquire/release
+#define ATOM_LIRE32(p)				(*(volatile CPU_INT32U*)(p))
+#define ATOM_ECRIRE32(p, v)			(*(volatile CPU_INT32U*)(p) = (v))
+#define ATOM_LIRE_PTR(p)			(*(void* volatile*)(p))
+#define ATOM_ECRIRE_PTR(p, v)		(*(void* volatile*)(p) = (void*)(v))
+#define ATOM_BARRIERE()				_ReadWriteBarrier()
+#else
+#define ATOM_LIRE64(p)				__atomic_load_n((volatile CPU_INT64U*)(p), __ATOMIC_ACQUIRE)
+#define ATOM_CAS64(p, anc, nouv)	__sync_bool_compare_and_swap((volatile CPU_INT64U*)(p), (CPU_INT64U)(anc), (CPU_INT64U)(nouv))
+#define ATOM_CAS32(p, anc, nouv)	__sync_bool_compare_and_swap((volatile CPU_INT32U*)(p), (CPU_INT32U)(anc), (CPU_INT32U)(nouv))
+#define ATOM_INC32(p)				__atomic_add_fetch((volatile CPU_INT32U*)(p), 1u, __ATOMIC_ACQ_REL)
+#define ATOM_DEC32(p)				__atomic_sub_fetch((volatile CPU_INT32U*)(p), 1u, __ATOMIC_ACQ_REL)
+#define ATOM_LIRE32(p)				__atomic_load_n((volatile CPU_INT32U*)(p), __ATOMIC_ACQUIRE)
+#define ATOM_ECRIRE32(p, v)			__atomic_store_n((volatile CPU_INT32U*)(p), (v), __ATOMIC_RELEASE)
+#define ATOM_LIRE_PTR(p)			__atomic_load_n((void* volatile*)(p), __ATOMIC_ACQUIRE)
+#define ATOM_ECRIRE_PTR(p, v)		__atomic_store_n((void* volatile*)(p), (void*)(v), __ATOMIC_RELEASE)
+#define ATOM_BARRIERE()				__atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+// Écriture 64 bits par l'unique propriétaire de la case (aucune autre tâche n'y écrit)
+#define ATOM_ECRIRE64_PROPRIO(p, anc, nouv)	((void)ATOM_CAS64((p), (anc), (nouv)))
+
+// Alignement sur une ligne de cache pour éviter le faux partage entre tâches
+#define ATOM_TAILLE_LIGNE_CACHE		64u
+
+#ifdef _MSC_VER
+#define ATOM_ALIGNE_CACHE			__declspec(align(64))
+#else
+#define ATOM_ALIGNE_CACHE			__attribute__((aligned(64)))
+#endif
+
+#endif /* SRC_ROUTEUR_ATOMIQUE_H_ */
@@ -0,0 +1,575 @@
+/*
+*********************************************************************************************************
+*                                                 uC/OS-III
+*                                          The Real-Time Kernel
+*                                               PORT Windows
+*
+*
+*                                  Polytechnique Montreal, Qc, CANADA
+*
+* File : routeur_banc.c
+*
+*********************************************************************************************************
+*/
+
+#include "routeur_banc.h"
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <os.h>
+#include  <cpu_core.h>
+#include  <lib_mem.h>
+#include  <lib_str.h>
+#include  "app_cfg.h"
+#include  "routeur_atomique.h"
+#include  "routeur_crc.h"
+
+// Bancs et tampons (plusieurs Mo) compilés seulement dans la version de banc d'essai
+#if (APP_CFG_BANC_ESSAI_EN == DEF_ENABLED)
+
+#define BANC_NB_PAQUETS		1024u
+#define BANC_NB_TOURS		1000u
+
+// Pools de paquets de tailles croissantes, créés une seule fois puis réutilisés à chaque appel :
+// Mem_PoolCreate prend leurs tables dans le tas, qui ne les rend jamais (lib_cfg.h, Note #3)
+#define BANC_POOL_NB_TOURS	20u
+#define BANC_POOL_BLOCS_MAX	4096u
+#define BANC_POOL_NB		3u
+static const MEM_POOL_BLK_QTY BancPoolTailles[BANC_POOL_NB] = { 64u, 512u, BANC_POOL_BLOCS_MAX };
+
+// Pool dynamique partagé par plusieurs tâches qui prennent et rendent des blocs un à un, par lots et
+// par leur cache ; le pool est plus petit que ce que les tâches peuvent détenir, pour passer aussi
+// par le pool vide. Priorité entre la tâche du tick (10) et TaskStats (12) : les tâches de
+// vérification tournent en tourniquet avant celles du routeur
+#define BANC_DYN_NB_TACHES	4u
+#define BANC_DYN_NB_BLOCS	128u
+#define BANC_DYN_DETENUS	32u
+#define BANC_DYN_LOT		8u
+#define BANC_DYN_NB_OPS		200000u
+#define BANC_DYN_PRIO		11u
+#define BANC_DYN_STK_TAILLE	1024u
+#define BANC_DYN_MARQUE		0xFFFFFFFFu
+
+// Le premier mot d'un bloc libre sert de lien au pool ; le second indique la tâche qui le détient
+typedef struct {
+	void*      lien;
+	CPU_INT32U proprio;
+} BANC_DYN_BLOC;
+
+typedef struct {
+	CPU_INT32U         id;
+	MEM_DYN_POOL_CACHE cache;
+	BANC_DYN_BLOC*     detenus[BANC_DYN_DETENUS];
+	CPU_INT32U         nb_detenus;
+	CPU_INT32U         alea;
+} BANC_DYN_TACHE;
+
+// Débit des primitives de lib_mem, de 16 o au double du seuil des écritures non temporelles (4 Mo par
+// défaut), pour mesurer les deux côtés du seuil ; chaque mesure traite BANC_MEM_OCTETS octets
+#define BANC_MEM_TAILLE_MAX	(2u * LIB_MEM_CFG_SIMD_NT_THRESHOLD)
+#define BANC_MEM_OCTETS		(64u * 1024u * 1024u)
+static const CPU_SIZE_T BancMemTailles[] = { 16u, 64u, 256u, 1024u, 4096u, 16384u, 65536u, 262144u, 1048576u,
+                                             LIB_MEM_CFG_SIMD_NT_THRESHOLD, BANC_MEM_TAILLE_MAX };
+static const char* const BancMemFonctions[] = { "Mem_Set", "Mem_Copy", "Mem_Move", "Mem_Cmp" };
+static const char* const BancMemImpl[] = { "portable", "SSE2", "AVX2", "NEON" };
+
+// Formatage de nombres de lib_str, sur des valeurs de toutes les magnitudes
+#define BANC_FMT_NB			1024u
+#define BANC_FMT_NB_TOURS	200u
+
+static Packet  BancPaquets[BANC_NB_PAQUETS];
+static Packet* BancPtr[BANC_NB_PAQUETS];
+// Blocs des trois pools
+static CPU_INT08U BancPoolMem[(64u + 512u + BANC_POOL_BLOCS_MAX) * sizeof(Packet) + 64u];
+static MEM_SEG BancPoolSeg;
+static MEM_POOL BancPools[BANC_POOL_NB];
+static CPU_INT32U BancPoolsNb = 0u;				// Pools déjà créés
+static void*   BancBlocs[BANC_POOL_BLOCS_MAX];
+static CPU_INT08U BancMemSrc[BANC_MEM_TAILLE_MAX + 64u];
+static CPU_INT08U BancMemDst[BANC_MEM_TAILLE_MAX + 64u];
+static CPU_INT32U BancFmtEntiers[BANC_FMT_NB];
+static CPU_FP32   BancFmtReels[BANC_FMT_NB];
+// Pool dynamique et tâches de la vérification
+static CPU_INT08U BancDynMem[BANC_DYN_NB_BLOCS * sizeof(BANC_DYN_BLOC) + 64u];
+static MEM_SEG BancDynSeg;
+static MEM_DYN_POOL BancDynPool;
+static BANC_DYN_BLOC* BancDynBlocs[BANC_DYN_NB_BLOCS];		// Blocs du pool, relevés à sa création
+static BANC_DYN_BLOC* BancDynVidange[BANC_DYN_NB_BLOCS];
+static BANC_DYN_TACHE BancDynTaches[BANC_DYN_NB_TACHES];
+static OS_TCB  BancDynTCB[BANC_DYN_NB_TACHES];
+static CPU_STK BancDynSTK[BANC_DYN_NB_TACHES][BANC_DYN_STK_TAILLE];
+static volatile CPU_INT32U BancDynActives = 0u;
+static volatile CPU_INT32U BancDynDoublons = 0u;			// Blocs remis à une tâche alors qu'une autre les détient
+static volatile CPU_INT32U BancDynErreurs = 0u;			// Erreurs inattendues de lib_mem
+
+// Un puits que le compilateur ne peut pas éliminer
+static volatile CPU_INT32U BancPuits;
+
+
+// Nanosecondes écoulées entre deux horodatages CPU_TS_Get64()
+static CPU_FP64 banc_ns(CPU_TS64 debut, CPU_TS64 fin) {
+	CPU_ERR err;
+	CPU_TS_TMR_FREQ freq = CPU_TS_TmrFreqGet(&err);
+
+	if (err != CPU_ERR_NONE || freq == 0u)
+		return 0.0;
+
+	return ((CPU_FP64)(fin - debut) * 1.0e9) / (CPU_FP64)freq;
+}
+
+static void banc_afficher(const char* mesure, const char* impl, CPU_FP64 ns) {
+	char nom[48];
+
+	snprintf(nom, sizeof(nom), "%s (%s)", mesure, impl);
+	printf("%-40s : %8.1f ns\n", nom, ns);
+}
+
+/*
+ *********************************************************************************************************
+ *											  banc_essai
+ *  - Lance tous les bancs d'essai
+ *********************************************************************************************************
+ */
+void banc_essai(void) {
+	printf("\n------------------ Bancs d'essai ------------------\n\n");
+	banc_essai_crc();
+	banc_essai_mem_pool();
+	banc_verif_mem_dyn_pool();
+	banc_essai_mem_simd();
+	banc_essai_str_fmt();
+	printf("\n---------------------------------------------------\n\n");
+}
+
+/*
+ *********************************************************************************************************
+ *											  banc_essai_crc
+ *  - Coût par paquet du CRC32C : logiciel, implémentation choisie, et par lot
+ *********************************************************************************************************
+ */
+void banc_essai_crc(void) {
+	CPU_TS64 debut;
+	CPU_INT32U i, t, acc = 0u;
+	CPU_FP64 nb = (CPU_FP64)BANC_NB_PAQUETS * BANC_NB_TOURS;
+
+	for (i = 0u; i < BANC_NB_PAQUETS; i++) {
+		BancPaquets[i].src = (CPU_INT32U)rand() << 16 ^ (CPU_INT32U)rand();
+		BancPaquets[i].dst = (CPU_INT32U)rand() << 16 ^ (CPU_INT32U)rand();
+		BancPaquets[i].type = (PACKET_TYPE)(rand() % NB_PACKET_TYPE);
+		for (t = 0u; t < sizeof(BancPaquets[i].data) / sizeof(BancPaquets[i].data[0]); t++)
+			BancPaquets[i].data[t] = (CPU_INT32U)rand();
+		BancPtr[i] = &BancPaquets[i];
+	}
+
+	debut = CPU_TS_Get64();
+	for (t = 0u; t < BANC_NB_TOURS; t++)
+		for (i = 0u; i < BANC_NB_PAQUETS; i++)
+			acc += crc32c_logiciel(0u, &BancPaquets[i], CRC32C_TAILLE_PAQUET);
+	banc_afficher("CRC32C par paquet", "slicing-by-8", banc_ns(debut, CPU_TS_Get64()) / nb);
+
+	debut = CPU_TS_Get64();
+	for (t = 0u; t < BANC_NB_TOURS; t++)
+		for (i = 0u; i < BANC_NB_PAQUETS; i++)
+			crc_paquet_calculer(&BancPaquets[i]);
+	banc_afficher("CRC32C par paquet", crc_implementation(), banc_ns(debut, CPU_TS_Get64()) / nb);
+
+	debut = CPU_TS_Get64();
+	for (t = 0u; t < BANC_NB_TOURS; t++)
+		crc_paquet_calculer_lot(BancPtr, BANC_NB_PAQUETS);
+	banc_afficher("CRC32C par paquet, lot", crc_implementation(), banc_ns(debut, CPU_TS_Get64()) / nb);
+
+	for (i = 0u; i < BANC_NB_PAQUETS; i++)
+		acc += BancPaquets[i].crc;
+	BancPuits = acc;
+}
+
+/*
+ *********************************************************************************************************
+ *											  banc_essai_mem_pool
+ *  - Coût de Mem_PoolBlkFree selon le nombre de blocs du pool ; la vérification de double libération
+ *    n'existe qu'avec LIB_MEM_CFG_ARG_CHK_EXT_EN, activé par lib_cfg.h dans la version de banc d'essai
+ *  - Les pools sont créés dans BancPoolSeg au premier appel seulement ; les appels suivants les
+ *    réutilisent et ne prennent plus rien dans le tas
+ *********************************************************************************************************
+ */
+void banc_essai_mem_pool(void) {
+	MEM_POOL* pool;
+	LIB_ERR err;
+	CPU_TS64 debut, duree;
+	CPU_INT32U i, t, b, n;
+	char impl[24];
+
+	printf("Verification de double liberation des pools : %s\n",
+	       (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) ? "active" : "inactive");
+
+	if (BancPoolsNb == 0u) {
+		Mem_SegCreate("Banc Pool", &BancPoolSeg, (CPU_ADDR)&BancPoolMem[0], sizeof(BancPoolMem), LIB_MEM_PADDING_ALIGN_NONE, &err);
+		if (err != LIB_MEM_ERR_NONE) {
+			printf("Mem_SegCreate : erreur %u\n", err);
+			return;
+		}
+	}
+	for (; BancPoolsNb < BANC_POOL_NB; BancPoolsNb++) {
+		Mem_PoolCreate(&BancPools[BancPoolsNb], BancPoolMem, sizeof(BancPoolMem), BancPoolTailles[BancPoolsNb],
+		               sizeof(Packet), sizeof(CPU_ALIGN), DEF_NULL, &err);
+		if (err != LIB_MEM_ERR_NONE) {
+			printf("Mem_PoolCreate (%u blocs) : erreur %u\n", (CPU_INT32U)BancPoolTailles[BancPoolsNb], err);
+			return;
+		}
+	}
+
+	for (i = 0u; i < BANC_POOL_NB; i++) {
+		n = (CPU_INT32U)BancPoolTailles[i];
+		pool = &BancPools[i];
+
+		duree = 0u;
+		for (t = 0u; t < BANC_POOL_NB_TOURS; t++) {
+			for (b = 0u; b < n; b++)
+				BancBlocs[b] = Mem_PoolBlkGet(pool, sizeof(Packet), &err);
+			debut = CPU_TS_Get64();
+			for (b = 0u; b < n; b++)
+				Mem_PoolBlkFree(pool, BancBlocs[b], &err);
+			duree += CPU_TS_Get64() - debut;
+		}
+
+		snprintf(impl, sizeof(impl), "%u blocs", n);
+		banc_afficher("Mem_PoolBlkFree", impl, banc_ns(0u, duree) / ((CPU_FP64)n * BANC_POOL_NB_TOURS));
+	}
+}
+
+// Prend possession d'un bloc reçu du pool : aucune autre tâche ne doit le détenir
+static void banc_dyn_prendre(BANC_DYN_TACHE* t, void* bloc) {
+	BANC_DYN_BLOC* b = (BANC_DYN_BLOC*)bloc;
+
+	if (!ATOM_CAS32(&b->proprio, 0u, t->id + 1u))
+		ATOM_INC32(&BancDynDoublons);
+	t->detenus[t->nb_detenus++] = b;
+}
+
+// Retire un bloc détenu, au hasard, et le rend anonyme avant qu'il retourne au pool
+static void* banc_dyn_rendre(BANC_DYN_TACHE* t) {
+	CPU_INT32U i = t->alea % t->nb_detenus;
+	BANC_DYN_BLOC* b = t->detenus[i];
+
+	t->detenus[i] = t->detenus[--t->nb_detenus];
+	if (!ATOM_CAS32(&b->proprio, t->id + 1u, 0u))
+		ATOM_INC32(&BancDynDoublons);
+	return b;
+}
+
+/*
+ *********************************************************************************************************
+ *											  banc_dyn_bilan
+ *  - Appelée par la dernière tâche de vérification, une fois tous les blocs rendus et les caches vidées
+ *  - Le pool doit compter tous ses blocs comme libres, et sa liste libre doit contenir exactement les
+ *    blocs relevés à sa création : chacun une seule fois, aucun perdu
+ *********************************************************************************************************
+ */
+static void banc_dyn_bilan(void) {
+	LIB_ERR err;
+	CPU_SIZE_T libres, nb, i;
+	CPU_INT32U perdus = 0u, doublons = BancDynDoublons;
+
+	libres = Mem_DynPoolBlkNbrAvailGet(&BancDynPool, &err);
+	nb = Mem_DynPoolBlkGetBulk(&BancDynPool, (void**)BancDynVidange, BANC_DYN_NB_BLOCS, &err);
+	for (i = 0u; i < nb; i++) {
+		if (BancDynVidange[i]->proprio != 0u)
+			doublons++;
+		BancDynVidange[i]->proprio = BANC_DYN_MARQUE;
+	}
+	for (i = 0u; i < BANC_DYN_NB_BLOCS; i++) {
+		if (BancDynBlocs[i]->proprio != BANC_DYN_MARQUE)
+			perdus++;
+		BancDynBlocs[i]->proprio = 0u;
+	}
+	Mem_DynPoolBlkFreeBulk(&BancDynPool, (void**)BancDynVidange, nb, &err);
+
+	printf("Verification Mem_DynPool (%s, %u taches, %u operations chacune) : %s\n",
+	       (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED) ? "sans verrou" : "section critique",
+	       BANC_DYN_NB_TACHES, BANC_DYN_NB_OPS,
+	       (libres == BANC_DYN_NB_BLOCS && nb == BANC_DYN_NB_BLOCS && perdus == 0u && doublons == 0u && BancDynErreurs == 0u) ? "OK" : "ECHEC");
+	printf("   %u blocs libres sur %u, %u repris, %u perdus, %u remis deux fois, %u erreurs\n",
+	       (CPU_INT32U)libres, BANC_DYN_NB_BLOCS, (CPU_INT32U)nb, perdus, doublons, BancDynErreurs);
+}
+
+/*
+ *********************************************************************************************************
+ *											  banc_dyn_tache
+ *  - Tire au hasard BANC_DYN_NB_OPS opérations sur le pool partagé : prise et remise d'un bloc, d'un
+ *    lot et par la cache de la tâche ; un bloc pris par un chemin peut être rendu par un autre
+ *  - Un pool vide n'est pas une erreur : les autres tâches détiennent alors tous les blocs
+ *********************************************************************************************************
+ */
+static void banc_dyn_tache(void* p_arg) {
+	BANC_DYN_TACHE* t = (BANC_DYN_TACHE*)p_arg;
+	void* lot[BANC_DYN_LOT];
+	LIB_ERR err;
+	OS_ERR os_err;
+	CPU_INT32U op, n, i;
+
+	for (op = 0u; op < BANC_DYN_NB_OPS; op++) {
+		t->alea ^= t->alea << 13;							// xorshift32
+		t->alea ^= t->alea >> 17;
+		t->alea ^= t->alea << 5;
+		n = 1u + (t->alea >> 8) % BANC_DYN_LOT;
+
+		switch ((t->alea >> 4) % 6u) {
+		case 0:
+			if (t->nb_detenus < BANC_DYN_DETENUS) {
+				lot[0] = Mem_DynPoolBlkGet(&BancDynPool, &err);
+				if (lot[0] != DEF_NULL)
+					banc_dyn_prendre(t, lot[0]);
+				else if (err != LIB_MEM_ERR_POOL_EMPTY)
+					ATOM_INC32(&BancDynErreurs);
+			}
+			break;
+		case 1:
+			if (t->nb_detenus > 0u) {
+				Mem_DynPoolBlkFree(&BancDynPool, banc_dyn_rendre(t), &err);
+				if (err != LIB_MEM_ERR_NONE)
+					ATOM_INC32(&BancDynErreurs);
+			}
+			break;
+		case 2:
+			n = DEF_MIN(n, BANC_DYN_DETENUS - t->nb_detenus);
+			n = (CPU_INT32U)Mem_DynPoolBlkGetBulk(&BancDynPool, lot, n, &err);
+			if (err != LIB_MEM_ERR_NONE && err != LIB_MEM_ERR_POOL_EMPTY)
+				ATOM_INC32(&BancDynErreurs);
+			for (i = 0u; i < n; i++)
+				banc_dyn_prendre(t, lot[i]);
+			break;
+		case 3:
+			n = DEF_MIN(n, t->nb_detenus);
+			for (i = 0u; i < n; i++)
+				lot[i] = banc_dyn_rendre(t);
+			Mem_DynPoolBlkFreeBulk(&BancDynPool, lot, n, &err);
+			if (err != LIB_MEM_ERR_NONE)
+				ATOM_INC32(&BancDynErreurs);
+			break;
+		case 4:
+			if (t->nb_detenus < BANC_DYN_DETENUS) {
+				lot[0] = Mem_DynPoolCacheBlkGet(&t->cache, &err);
+				if (lot[0] != DEF_NULL)
+					banc_dyn_prendre(t, lot[0]);
+				else if (err != LIB_MEM_ERR_POOL_EMPTY)
+					ATOM_INC32(&BancDynErreurs);
+			}
+			break;
+		default:
+			if (t->nb_detenus > 0u) {
+				Mem_DynPoolCacheBlkFree(&t->cache, banc_dyn_rendre(t), &err);
+				if (err != LIB_MEM_ERR_NONE)
+					ATOM_INC32(&BancDynErreurs);
+			}
+			break;
+		}
+	}
+
+	while (t->nb_detenus > 0u)
+		Mem_DynPoolBlkFree(&BancDynPool, banc_dyn_rendre(t), &err);
+	Mem_DynPoolCacheFlush(&t->cache, &err);
+
+	if (ATOM_DEC32(&BancDynActives) == 0u)
+		banc_dyn_bilan();
+	OSTaskDel((OS_TCB*)0, &os_err);
+}
+
+/*
+ *********************************************************************************************************
+ *											  banc_verif_mem_dyn_pool
+ *  - Vérifie la liste libre des pools dynamiques (sans verrou ou en section critique selon
+ *    LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN) et leurs caches sous concurrence : BANC_DYN_NB_TACHES tâches de
+ *    même priorité se partagent un pool, le tourniquet les interrompant n'importe où
+ *  - Appelée avant OSStart() : crée le pool et les tâches, qui tournent dès le démarrage du noyau ;
+ *    la dernière à finir affiche le bilan (banc_dyn_bilan)
+ *********************************************************************************************************
+ */
+void banc_verif_mem_dyn_pool(void) {
+	LIB_ERR err;
+	OS_ERR os_err;
+	CPU_INT32U i;
+
+	if (BancDynActives != 0u)								// Vérification déjà en cours
+		return;
+
+	if (BancDynBlocs[0] == DEF_NULL) {
+		Mem_SegCreate("Banc DynPool", &BancDynSeg, (CPU_ADDR)&BancDynMem[0], sizeof(BancDynMem), LIB_MEM_PADDING_ALIGN_NONE, &err);
+		if (err == LIB_MEM_ERR_NONE)
+			Mem_DynPoolCreate("Banc DynPool", &BancDynPool, &BancDynSeg, sizeof(BANC_DYN_BLOC), sizeof(CPU_ALIGN),
+			                  BANC_DYN_NB_BLOCS, BANC_DYN_NB_BLOCS, &err);
+		if (err != LIB_MEM_ERR_NONE) {
+			printf("Mem_DynPoolCreate : erreur %u\n", err);
+			return;
+		}
+
+		// Relève les blocs du pool ; le segment est statique, donc leur propriétaire vaut 0
+		(void)Mem_DynPoolBlkGetBulk(&BancDynPool, (void**)BancDynBlocs, BANC_DYN_NB_BLOCS, &err);
+		Mem_DynPoolBlkFreeBulk(&BancDynPool, (void**)BancDynBlocs, BANC_DYN_NB_BLOCS, &err);
+	}
+
+	BancDynDoublons = 0u;
+	BancDynErreurs = 0u;
+	BancDynActives = BANC_DYN_NB_TACHES;
+	for (i = 0u; i < BANC_DYN_NB_TACHES; i++) {
+		BancDynTaches[i].id = i;
+		BancDynTaches[i].nb_detenus = 0u;
+		BancDynTaches[i].alea = 0x9E3779B9u * (i + 1u);
+		Mem_DynPoolCacheInit(&BancDynTaches[i].cache, &BancDynPool, &err);
+		OSTaskCreate(&BancDynTCB[i], "Banc DynPool", banc_dyn_tache, &BancDynTaches[i], BANC_DYN_PRIO, &BancDynSTK[i][0u],
+		             BANC_DYN_STK_TAILLE / 2, BANC_DYN_STK_TAILLE, 1, 0, (void*)0, (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), &os_err);
+		if (os_err != OS_ERR_NONE) {
+			printf("OSTaskCreate (verification Mem_DynPool) : erreur %u\n", os_err);
+			ATOM_DEC32(&BancDynActives);
+		}
+	}
+}
+
+// Débit en Mo/s d'une fonction de lib_mem pour une taille donnée
+static CPU_FP64 banc_mem_debit(CPU_INT32U fonction, CPU_SIZE_T taille) {
+	CPU_TS64 debut;
+	CPU_FP64 ns;
+	CPU_INT32U t, nb = BANC_MEM_OCTETS / (CPU_INT32U)taille, acc = 0u;
+
+	debut = CPU_TS_Get64();
+	for (t = 0u; t < nb; t++) {
+		switch (fonction) {
+		case 0u:
+			Mem_Set(BancMemDst, (CPU_INT08U)t, taille);
+			break;
+		case 1u:
+			Mem_Copy(BancMemDst, BancMemSrc, taille);
+			break;
+		case 2u:	// Chevauchement : copie à rebours
+			Mem_Move(&BancMemSrc[1], BancMemSrc, taille);
+			break;
+		default:	// Tampons identiques : comparaison complète
+			acc += Mem_Cmp(BancMemDst, BancMemSrc, taille);
+			break;
+		}
+	}
+	ns = banc_ns(debut, CPU_TS_Get64());
+	BancPuits = acc;
+
+	return (ns > 0.0) ? ((CPU_FP64)nb * (CPU_FP64)taille * 1.0e3) / ns : 0.0;
+}
+
+/*
+ *********************************************************************************************************
+ *											  banc_essai_mem_simd
+ *  - Débit de Mem_Set, Mem_Copy, Mem_Move et Mem_Cmp de 16 o à BANC_MEM_TAILLE_MAX, pour chaque
+ *    implémentation disponible (LIB_MEM_CFG_SIMD_EN, lib_cfg.h) ; Mem_Init() doit avoir été appelé
+ *  - Les deux dernières tailles passent par les écritures non temporelles de Mem_Set et Mem_Copy
+ *********************************************************************************************************
+ */
+void banc_essai_mem_simd(void) {
+	CPU_INT32U f, i;
+	CPU_INT08U impl, nb_impl = 1u;
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+	CPU_INT08U impl_init = Mem_SIMD_ImplGet();
+	LIB_ERR err;
+
+	nb_impl = (CPU_INT08U)(sizeof(BancMemImpl) / sizeof(BancMemImpl[0]));
+	printf("\nImplementation SIMD de lib_mem : %s, ecritures non temporelles des %u Ko\n", BancMemImpl[impl_init],
+	       (CPU_INT32U)(LIB_MEM_CFG_SIMD_NT_THRESHOLD / 1024u));
+#endif
+
+	for (f = 0u; f < sizeof(BancMemFonctions) / sizeof(BancMemFonctions[0]); f++) {
+		printf("\n%-12s (Mo/s)", BancMemFonctions[f]);
+		for (i = 0u; i < sizeof(BancMemTailles) / sizeof(BancMemTailles[0]); i++)
+			printf(" %7u%s", (CPU_INT32U)((BancMemTailles[i] < 1024u) ? BancMemTailles[i] : BancMemTailles[i] / 1024u),
+			       (BancMemTailles[i] < 1024u) ? " o" : "Ko");
+		printf("\n");
+
+		for (impl = 0u; impl < nb_impl; impl++) {
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+			Mem_SIMD_ImplSet(impl, &err);
+			if (err != LIB_MEM_ERR_NONE)
+				continue;
+#endif
+			Mem_Copy(BancMemDst, BancMemSrc, BANC_MEM_TAILLE_MAX);
+			printf("  %-17s", BancMemImpl[impl]);
+			for (i = 0u; i < sizeof(BancMemTailles) / sizeof(BancMemTailles[0]); i++)
+				printf(" %9.0f", banc_mem_debit(f, BancMemTailles[i]));
+			printf("\n");
+		}
+	}
+
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+	Mem_SIMD_ImplSet(impl_init, &err);
+#endif
+}
+
+// Coût moyen par nombre de Str_FmtNbr_Int32U, Str_FmtNbr_Int32S et Str_FmtNbr_32, dans le format choisi
+static void banc_fmt_mesurer(const char* impl) {
+	CPU_TS64 debut;
+	CPU_INT32U i, t, acc = 0u;
+	CPU_FP64 nb = (CPU_FP64)BANC_FMT_NB * BANC_FMT_NB_TOURS;
+	CPU_CHAR tampon[32];
+
+	debut = CPU_TS_Get64();
+	for (t = 0u; t < BANC_FMT_NB_TOURS; t++)
+		for (i = 0u; i < BANC_FMT_NB; i++)
+			acc += (CPU_INT32U)Str_FmtNbr_Int32U(BancFmtEntiers[i], 10u, 10u, ' ', DEF_NO, DEF_YES, tampon)[9];
+	banc_afficher("Str_FmtNbr_Int32U", impl, banc_ns(debut, CPU_TS_Get64()) / nb);
+
+	debut = CPU_TS_Get64();
+	for (t = 0u; t < BANC_FMT_NB_TOURS; t++)
+		for (i = 0u; i < BANC_FMT_NB; i++)
+			acc += (CPU_INT32U)Str_FmtNbr_Int32S((CPU_INT32S)BancFmtEntiers[i], 11u, 10u, '0', DEF_NO, DEF_YES, tampon)[10];
+	banc_afficher("Str_FmtNbr_Int32S", impl, banc_ns(debut, CPU_TS_Get64()) / nb);
+
+#if (LIB_STR_CFG_FP_EN == DEF_ENABLED)
+	debut = CPU_TS_Get64();
+	for (t = 0u; t < BANC_FMT_NB_TOURS; t++)
+		for (i = 0u; i < BANC_FMT_NB; i++)
+			acc += (CPU_INT32U)Str_FmtNbr_32(BancFmtReels[i], 8u, 2u, ' ', DEF_YES, tampon)[10];
+	banc_afficher("Str_FmtNbr_32", impl, banc_ns(debut, CPU_TS_Get64()) / nb);
+#endif
+
+	BancPuits = acc;
+}
+
+/*
+ *********************************************************************************************************
+ *											  banc_essai_str_fmt
+ *  - Formatage de nombres de lib_str : format portable, format rapide (LIB_STR_CFG_FMT_FAST_EN,
+ *    lib_cfg.h) et snprintf comme référence ; les deux formats produisent les mêmes chaînes
+ *********************************************************************************************************
+ */
+void banc_essai_str_fmt(void) {
+	CPU_TS64 debut;
+	CPU_INT32U i, t, acc = 0u;
+	CPU_FP64 nb = (CPU_FP64)BANC_FMT_NB * BANC_FMT_NB_TOURS;
+	char tampon[32];
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+	CPU_BOOLEAN rapide_init = Str_FmtNbr_FastGet();
+#endif
+
+	// Compteurs de 1 à 10 chiffres, positifs et négatifs une fois sur deux pour Int32S
+	for (i = 0u; i < BANC_FMT_NB; i++) {
+		BancFmtEntiers[i] = ((CPU_INT32U)rand() << 16 ^ (CPU_INT32U)rand()) >> (rand() % 32);
+		if ((i & 1u) != 0u)
+			BancFmtEntiers[i] = (CPU_INT32U)(-(CPU_INT32S)(BancFmtEntiers[i] >> 1));
+		BancFmtReels[i] = (CPU_FP32)(rand() % 2000000 - 1000000) / 100.0f;
+	}
+
+	printf("\n");
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+	Str_FmtNbr_FastSet(DEF_DISABLED);
+#endif
+	banc_fmt_mesurer("portable");
+#if (LIB_STR_CFG_FMT_FAST_EN == DEF_ENABLED)
+	Str_FmtNbr_FastSet(DEF_ENABLED);
+	banc_fmt_mesurer("rapide");
+	Str_FmtNbr_FastSet(rapide_init);
+#endif
+
+	debut = CPU_TS_Get64();
+	for (t = 0u; t < BANC_FMT_NB_TOURS; t++)
+		for (i = 0u; i < BANC_FMT_NB; i++)
+			acc += (CPU_INT32U)snprintf(tampon, sizeof(tampon), "%10u", BancFmtEntiers[i]);
+	banc_afficher("Str_FmtNbr_Int32U", "snprintf", banc_ns(debut, CPU_TS_Get64()) / nb);
+
+	BancPuits = acc;
+}
+
+#endif /* APP_CFG_BANC_ESSAI_EN */
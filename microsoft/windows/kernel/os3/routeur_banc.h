@@ -0,0 +1,19 @@
+/*
+ * routeur_banc.h
+ *
+ *  Bancs d'essai des modules du routeur, lancés avant OSStart() lorsque APP_CFG_BANC_ESSAI_EN
+ *  vaut DEF_ENABLED dans app_cfg.h. Les durées sont mesurées avec CPU_TS_Get64().
+ *  banc_verif_mem_dyn_pool() crée des tâches : sa vérification s'affiche après OSStart().
+ */
+
+#ifndef SRC_ROUTEUR_BANC_H_
+#define SRC_ROUTEUR_BANC_H_
+
+void banc_essai(void);
+void banc_essai_crc(void);
+void banc_essai_mem_pool(void);
+void banc_verif_mem_dyn_pool(void);
+void banc_essai_mem_simd(void);
+void banc_essai_str_fmt(void);
+
+#endif /* SRC_ROUTEUR_BANC_H_ */
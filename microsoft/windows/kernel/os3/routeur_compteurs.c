@@ -0,0 +1,138 @@
+/*
+*********************************************************************************************************
+*                                                 uC/OS-III
+*                                          The Real-Time Kernel
+*                                               PORT Windows
+*
+*
+*                                  Polytechnique Montreal, Qc, CANADA
+*
+* File : routeur_compteurs.c
+*
+*********************************************************************************************************
+*/
+
+#include "routeur_compteurs.h"
+
+#include  <lib_mem.h>
+#include  "routeur_atomique.h"
+
+#define CPT_TAILLE_SHARD	(((sizeof(CPU_INT64U) * NB_COMPTEURS) + ATOM_TAILLE_LIGNE_CACHE - 1u) & ~(ATOM_TAILLE_LIGNE_CACHE - 1u))
+
+// Une tranche par tâche, arrondie à un multiple de la ligne de cache pour éviter le faux partage
+typedef union {
+	volatile CPU_INT64U val[NB_COMPTEURS];
+	CPU_INT08U          pad[CPT_TAILLE_SHARD];
+} COMPTEURS_SHARD;
+
+static ATOM_ALIGNE_CACHE COMPTEURS_SHARD Shards[CPT_NB_SHARDS_MAX];
+
+// Valeur retranchée des totaux lors d'une remise à zéro (seul le lecteur y écrit)
+static CPU_INT64U Base[NB_COMPTEURS];
+
+
+/*
+ *********************************************************************************************************
+ *											  compteurs_init
+ *  - Remet toutes les tranches à zéro. À appeler avant la création des tâches.
+ *********************************************************************************************************
+ */
+void compteurs_init(void) {
+	Mem_Clr((void*)Shards, sizeof(Shards));
+	Mem_Clr((void*)Base, sizeof(Base));
+}
+
+/*
+ *********************************************************************************************************
+ *											  compteurs_ajouter
+ *  - Ajoute n au compteur id dans la tranche de la tâche appelante.
+ *  - Chaque tranche n'a qu'un seul écrivain : aucun mutex ni section critique n'est nécessaire.
+ *********************************************************************************************************
+ */
+void compteurs_ajouter(CPU_INT32U shard, COMPTEUR_ID id, CPU_INT32U n) {
+	volatile CPU_INT64U* p;
+	CPU_INT64U val;
+
+	if (shard >= CPT_NB_SHARDS_MAX || id >= NB_COMPTEURS)
+		return;
+
+	p = &Shards[shard].val[id];
+	val = *p;										// Seul l'écrivain modifie cette case
+	ATOM_ECRIRE64_PROPRIO(p, val, val + n);
+}
+
+/*
+ *********************************************************************************************************
+ *											  compteurs_lire
+ *  - Retourne le total (64 bits) du compteur id, toutes tranches confondues.
+ *********************************************************************************************************
+ */
+CPU_INT64U compteurs_lire(COMPTEUR_ID id) {
+	CPU_INT64U total = 0u;
+	CPU_INT32U i;
+
+	if (id >= NB_COMPTEURS)
+		return 0u;
+
+	for (i = 0u; i < CPT_NB_SHARDS_MAX; i++)
+		total += ATOM_LIRE64(&Shards[i].val[id]);
+
+	return total - Base[id];
+}
+
+/*
+ *********************************************************************************************************
+ *											  compteurs_lire_shard
+ *  - Retourne la valeur brute du compteur id dans une seule tranche (répartition entre tâches).
+ *  - Non affectée par compteurs_raz().
+ *********************************************************************************************************
+ */
+CPU_INT64U compteurs_lire_shard(CPU_INT32U shard, COMPTEUR_ID id) {
+	if (shard >= CPT_NB_SHARDS_MAX || id >= NB_COMPTEURS)
+		return 0u;
+
+	return ATOM_LIRE64(&Shards[shard].val[id]);
+}
+
+/*
+ *********************************************************************************************************
+ *											  compteurs_raz
+ *  - Remet le compteur id à zéro du point de vue du lecteur, sans toucher aux tranches des écrivains.
+ *********************************************************************************************************
+ */
+void compteurs_raz(COMPTEUR_ID id) {
+	if (id >= NB_COMPTEURS)
+		return;
+
+	Base[id] += compteurs_lire(id);
+}
+
+/*
+ *********************************************************************************************************
+ *											  compteurs_photo
+ *  - Capture tous les totaux ainsi que le tick courant
+ *********************************************************************************************************
+ */
+void compteurs_photo(COMPTEURS_PHOTO* photo) {
+	OS_ERR err;
+	int id;
+
+	photo->tick = OSTimeGet(&err);
+	for (id = 0; id < NB_COMPTEURS; id++)
+		photo->total[id] = compteurs_lire((COMPTEUR_ID)id);
+}
+
+/*
+ *********************************************************************************************************
+ *											  compteurs_taux
+ *  - Débit moyen (événements par seconde) du compteur id entre deux photos
+ *********************************************************************************************************
+ */
+CPU_INT64U compteurs_taux(const COMPTEURS_PHOTO* avant, const COMPTEURS_PHOTO* apres, COMPTEUR_ID id) {
+	OS_TICK ticks = apres->tick - avant->tick;
+
+	if (ticks == 0u || id >= NB_COMPTEURS || apres->total[id] < avant->total[id])
+		return 0u;
+
+	return ((apres->total[id] - avant->total[id]) * OS_CFG_TICK_RATE_HZ) / ticks;
+}
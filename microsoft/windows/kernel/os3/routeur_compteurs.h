@@ -0,0 +1,50 @@
+/*
+ * routeur_compteurs.h
+ *
+ *  Compteurs statistiques du routeur, répartis par tâche (un « shard » par tâche).
+ *
+ *  Chaque tâche incrémente uniquement sa propre tranche, alignée sur une ligne de cache,
+ *  sans mutex. Le lecteur (TaskStats) additionne les tranches à la demande.
+ */
+
+#ifndef SRC_ROUTEUR_COMPTEURS_H_
+#define SRC_ROUTEUR_COMPTEURS_H_
+
+#include <os.h>
+
+#ifndef CPT_NB_SHARDS_MAX
+#define CPT_NB_SHARDS_MAX		128u				// Doit couvrir toutes les tâches qui comptent (NB_SHARDS)
+#endif
+
+typedef enum {
+	CPT_PAQUETS_CREES,						// Nb de packets total créés
+	CPT_PAQUETS_TRAITES,					// Nb de paquets envoyés sur une interface
+	CPT_PAQUETS_CALCULES,					// Nb de paquets vérifiés par TaskComputing (acceptés ou non)
+	CPT_SOURCE_REJETE,						// Nb de packets rejetés pour mauvaise source
+	CPT_REJET_CRC,							// Nb de packets rejetés pour mauvais CRC
+	CPT_REJET_FIFO_ENTREE,					// Rejets dans la fifo d'entrée
+	CPT_REJET_3Q,							// Rejets dans highQ, mediumQ ou lowQ
+	CPT_REJET_AQM,							// Rejets décidés par la gestion active des files (RED, CoDel)
+	CPT_REJET_PORT_SORTIE,					// Rejets dans les interfaces de sortie
+	CPT_SANS_ROUTE,							// Paquets dont la destination n'a aucune route
+	CPT_TYPE_INVALIDE,						// Paquets dont le type n'est pas une classe connue
+	NB_COMPTEURS
+} COMPTEUR_ID;
+
+// Photo de tous les totaux à un instant donné, utilisée pour dériver les débits
+typedef struct {
+	OS_TICK    tick;
+	CPU_INT64U total[NB_COMPTEURS];
+} COMPTEURS_PHOTO;
+
+void       compteurs_init(void);
+void       compteurs_ajouter(CPU_INT32U shard, COMPTEUR_ID id, CPU_INT32U n);
+CPU_INT64U compteurs_lire(COMPTEUR_ID id);
+CPU_INT64U compteurs_lire_shard(CPU_INT32U shard, COMPTEUR_ID id);
+void       compteurs_raz(COMPTEUR_ID id);
+void       compteurs_photo(COMPTEURS_PHOTO* photo);
+CPU_INT64U compteurs_taux(const COMPTEURS_PHOTO* avant, const COMPTEURS_PHOTO* apres, COMPTEUR_ID id);
+
+#define compteurs_inc(shard, id)	compteurs_ajouter((shard), (id), 1u)
+
+#endif /* SRC_ROUTEUR_COMPTEURS_H_ */
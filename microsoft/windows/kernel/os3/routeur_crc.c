@@ -0,0 +1,232 @@
+/*
+*********************************************************************************************************
+*                                                 uC/OS-III
+*                                          The Real-Time Kernel
+*                                               PORT Windows
+*
+*
+*                                  Polytechnique Montreal, Qc, CANADA
+*
+* File : routeur_crc.c
+*
+*********************************************************************************************************
+*/
+
+#include "routeur_crc.h"
+
+#include  "routeur_simd.h"
+
+#if SIMD_X86
+#include  <nmmintrin.h>
+#endif
+
+#define CRC32C_POLY				0x82F63B78u
+#define CRC32C_NB_MOTS_PAQUET	(CRC32C_TAILLE_PAQUET / sizeof(CPU_INT32U))
+
+typedef CPU_INT32U (*CRC_PAQUET_FNCT)(const Packet* packet);
+typedef void       (*CRC_LOT_FNCT)(Packet* const* paquets, CPU_INT32U* crc, CPU_INT32U nb);
+
+static CPU_INT32U CrcTable[8][256];
+
+static CPU_INT32U crc_paquet_logiciel(const Packet* packet);
+static void       crc_lot_logiciel(Packet* const* paquets, CPU_INT32U* crc, CPU_INT32U nb);
+
+static CRC_PAQUET_FNCT CrcPaquet = crc_paquet_logiciel;
+static CRC_LOT_FNCT    CrcLot = crc_lot_logiciel;
+static const char*     CrcNom = "slicing-by-8";
+
+
+static CPU_INT32U crc_lire32(const CPU_INT08U* p) {
+	return (CPU_INT32U)p[0] | ((CPU_INT32U)p[1] << 8) | ((CPU_INT32U)p[2] << 16) | ((CPU_INT32U)p[3] << 24);
+}
+
+/*
+ *********************************************************************************************************
+ *											  crc32c_logiciel
+ *  - Slicing-by-8 : huit tables de 256 entrées permettent de traiter 8 octets par itération
+ *  - crc vaut 0 pour un nouveau calcul, ou le résultat précédent pour poursuivre sur un autre tampon
+ *********************************************************************************************************
+ */
+CPU_INT32U crc32c_logiciel(CPU_INT32U crc, const void* buf, CPU_SIZE_T len) {
+	const CPU_INT08U* p = (const CPU_INT08U*)buf;
+	CPU_INT32U c = ~crc;
+	CPU_INT32U hi;
+
+	while (len >= 8u) {
+		c ^= crc_lire32(p);
+		hi = crc_lire32(p + 4);
+		c = CrcTable[7][c & 0xFFu] ^ CrcTable[6][(c >> 8) & 0xFFu] ^
+		    CrcTable[5][(c >> 16) & 0xFFu] ^ CrcTable[4][c >> 24] ^
+		    CrcTable[3][hi & 0xFFu] ^ CrcTable[2][(hi >> 8) & 0xFFu] ^
+		    CrcTable[1][(hi >> 16) & 0xFFu] ^ CrcTable[0][hi >> 24];
+		p += 8;
+		len -= 8u;
+	}
+	while (len-- > 0u)
+		c = (c >> 8) ^ CrcTable[0][(c ^ *p++) & 0xFFu];
+
+	return ~c;
+}
+
+static CPU_INT32U crc_paquet_logiciel(const Packet* packet) {
+	return crc32c_logiciel(0u, packet, CRC32C_TAILLE_PAQUET);
+}
+
+static void crc_lot_logiciel(Packet* const* paquets, CPU_INT32U* crc, CPU_INT32U nb) {
+	CPU_INT32U i;
+
+	for (i = 0u; i < nb; i++)
+		crc[i] = crc_paquet_logiciel(paquets[i]);
+}
+
+#if SIMD_X86
+SIMD_CIBLE("sse4.2")
+static CPU_INT32U crc32c_sse42(CPU_INT32U crc, const void* buf, CPU_SIZE_T len) {
+	const CPU_INT08U* p = (const CPU_INT08U*)buf;
+	CPU_INT32U c = ~crc;
+
+	while (len >= 4u) {
+		c = _mm_crc32_u32(c, crc_lire32(p));
+		p += 4;
+		len -= 4u;
+	}
+	while (len-- > 0u)
+		c = _mm_crc32_u8(c, *p++);
+
+	return ~c;
+}
+
+SIMD_CIBLE("sse4.2")
+static CPU_INT32U crc_paquet_sse42(const Packet* packet) {
+	const CPU_INT32U* m = (const CPU_INT32U*)packet;
+	CPU_INT32U c = 0xFFFFFFFFu;
+	CPU_INT32U i;
+
+	for (i = 0u; i < CRC32C_NB_MOTS_PAQUET; i++)
+		c = _mm_crc32_u32(c, m[i]);
+
+	return ~c;
+}
+
+// Quatre chaînes de dépendance indépendantes par itération
+SIMD_CIBLE("sse4.2")
+static void crc_lot_sse42(Packet* const* paquets, CPU_INT32U* crc, CPU_INT32U nb) {
+	const CPU_INT32U *m0, *m1, *m2, *m3;
+	CPU_INT32U c0, c1, c2, c3;
+	CPU_INT32U i, w;
+
+	for (i = 0u; i + 4u <= nb; i += 4u) {
+		m0 = (const CPU_INT32U*)paquets[i];
+		m1 = (const CPU_INT32U*)paquets[i + 1u];
+		m2 = (const CPU_INT32U*)paquets[i + 2u];
+		m3 = (const CPU_INT32U*)paquets[i + 3u];
+		c0 = c1 = c2 = c3 = 0xFFFFFFFFu;
+		for (w = 0u; w < CRC32C_NB_MOTS_PAQUET; w++) {
+			c0 = _mm_crc32_u32(c0, m0[w]);
+			c1 = _mm_crc32_u32(c1, m1[w]);
+			c2 = _mm_crc32_u32(c2, m2[w]);
+			c3 = _mm_crc32_u32(c3, m3[w]);
+		}
+		crc[i] = ~c0;
+		crc[i + 1u] = ~c1;
+		crc[i + 2u] = ~c2;
+		crc[i + 3u] = ~c3;
+	}
+	for (; i < nb; i++)
+		crc[i] = crc_paquet_sse42(paquets[i]);
+}
+#endif
+
+
+/*
+ *********************************************************************************************************
+ *											  crc_init
+ *  - Génère les tables du slicing-by-8 et choisit l'implémentation (simd_init() doit avoir été appelé)
+ *********************************************************************************************************
+ */
+void crc_init(void) {
+	CPU_INT32U i, k, c;
+
+	for (i = 0u; i < 256u; i++) {
+		c = i;
+		for (k = 0u; k < 8u; k++)
+			c = (c >> 1) ^ (CRC32C_POLY & (0u - (c & 1u)));
+		CrcTable[0][i] = c;
+	}
+	for (i = 0u; i < 256u; i++) {
+		for (k = 1u; k < 8u; k++)
+			CrcTable[k][i] = (CrcTable[k - 1u][i] >> 8) ^ CrcTable[0][CrcTable[k - 1u][i] & 0xFFu];
+	}
+
+	CrcPaquet = crc_paquet_logiciel;
+	CrcLot = crc_lot_logiciel;
+	CrcNom = "slicing-by-8";
+#if SIMD_X86
+	if (Simd.sse42) {
+		CrcPaquet = crc_paquet_sse42;
+		CrcLot = crc_lot_sse42;
+		CrcNom = "SSE4.2";
+	}
+#endif
+}
+
+CPU_INT32U crc32c(CPU_INT32U crc, const void* buf, CPU_SIZE_T len) {
+#if SIMD_X86
+	if (Simd.sse42)
+		return crc32c_sse42(crc, buf, len);
+#endif
+	return crc32c_logiciel(crc, buf, len);
+}
+
+/*
+ *********************************************************************************************************
+ *											  crc_paquet_calculer / crc_paquet_verifier
+ *  - Le CRC couvre les CRC32C_TAILLE_PAQUET premiers octets du paquet et est rangé dans packet->crc
+ *********************************************************************************************************
+ */
+void crc_paquet_calculer(Packet* packet) {
+	packet->crc = CrcPaquet(packet);
+}
+
+CPU_BOOLEAN crc_paquet_verifier(const Packet* packet) {
+	return (CrcPaquet(packet) == packet->crc) ? DEF_YES : DEF_NO;
+}
+
+void crc_paquet_calculer_lot(Packet* const* paquets, CPU_INT32U nb) {
+	CPU_INT32U crc[16];
+	CPU_INT32U i, j, n;
+
+	for (i = 0u; i < nb; i += n) {
+		n = (nb - i < 16u) ? (nb - i) : 16u;
+		CrcLot(paquets + i, crc, n);
+		for (j = 0u; j < n; j++)
+			paquets[i + j]->crc = crc[j];
+	}
+}
+
+/*
+ *********************************************************************************************************
+ *											  crc_paquet_verifier_lot
+ *  - ok[i] indique si paquets[i] est intact ; retourne le nombre de paquets au CRC erroné
+ *********************************************************************************************************
+ */
+CPU_INT32U crc_paquet_verifier_lot(Packet* const* paquets, CPU_BOOLEAN* ok, CPU_INT32U nb) {
+	CPU_INT32U crc[16];
+	CPU_INT32U i, j, n;
+	CPU_INT32U erreurs = 0u;
+
+	for (i = 0u; i < nb; i += n) {
+		n = (nb - i < 16u) ? (nb - i) : 16u;
+		CrcLot(paquets + i, crc, n);
+		for (j = 0u; j < n; j++) {
+			ok[i + j] = (crc[j] == paquets[i + j]->crc) ? DEF_YES : DEF_NO;
+			if (ok[i + j] == DEF_NO)
+				erreurs++;
+		}
+	}
+	return erreurs;
+}
+
+const char* crc_implementation(void) {
+	return CrcNom;
+}
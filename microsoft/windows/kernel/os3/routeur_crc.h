@@ -0,0 +1,30 @@
+/*
+ * routeur_crc.h
+ *
+ *  CRC32C (Castagnoli, polynôme réfléchi 0x82F63B78) des paquets du routeur.
+ *
+ *  L'instruction crc32 de SSE4.2 est utilisée si elle est disponible, sinon l'algorithme logiciel
+ *  « slicing-by-8 ». Les fonctions par lot entrelacent quatre paquets pour masquer la latence de
+ *  l'instruction crc32 (3 cycles) derrière son débit (1 par cycle).
+ */
+
+#ifndef SRC_ROUTEUR_CRC_H_
+#define SRC_ROUTEUR_CRC_H_
+
+#include <cpu.h>
+#include "paquet.h"
+
+#define CRC32C_TAILLE_PAQUET	(sizeof(Packet) - sizeof(unsigned int))		// Tout sauf le champ crc
+
+void        crc_init(void);
+CPU_INT32U  crc32c(CPU_INT32U crc, const void* buf, CPU_SIZE_T len);
+CPU_INT32U  crc32c_logiciel(CPU_INT32U crc, const void* buf, CPU_SIZE_T len);
+
+void        crc_paquet_calculer(Packet* packet);
+CPU_BOOLEAN crc_paquet_verifier(const Packet* packet);
+void        crc_paquet_calculer_lot(Packet* const* paquets, CPU_INT32U nb);
+CPU_INT32U  crc_paquet_verifier_lot(Packet* const* paquets, CPU_BOOLEAN* ok, CPU_INT32U nb);
+
+const char* crc_implementation(void);
+
+#endif /* SRC_ROUTEUR_CRC_H_ */
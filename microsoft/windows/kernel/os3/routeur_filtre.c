@@ -0,0 +1,239 @@
+/*
+*********************************************************************************************************
+*                                                 uC/OS-III
+*                                          The Real-Time Kernel
+*                                               PORT Windows
+*
+*
+*                                  Polytechnique Montreal, Qc, CANADA
+*
+* File : routeur_filtre.c
+*
+*********************************************************************************************************
+*/
+
+#include "routeur_filtre.h"
+
+#include  <stdlib.h>
+#include  "routeur_atomique.h"
+#include  "routeur_simd.h"
+
+#if SIMD_X86
+#include  <immintrin.h>
+#endif
+
+#define FILTRE_NB_INTERVALLES_MAX	(2u * FILTRE_NB_REGLES_MAX + 1u)
+
+typedef void (*FILTRE_LOT_FNCT)(const CPU_INT32U* src, CPU_INT32U* idx, CPU_INT32U nb);
+
+// Intervalle k = [Bornes[k], Bornes[k + 1] - 1], rejeté par la règle Regle[k] (ou FILTRE_AUCUNE)
+static CPU_INT32U Bornes[FILTRE_NB_INTERVALLES_MAX];
+static CPU_INT16U Regle[FILTRE_NB_INTERVALLES_MAX];
+static CPU_INT32U NbIntervalles = 1u;				// Bornes[0] = 0 : une seule plage, non rejetée
+static CPU_INT32U NbRegles = 0u;
+
+static volatile CPU_INT32U Correspondances[FILTRE_NB_REGLES_MAX];
+
+static CPU_INT32U Points[FILTRE_NB_INTERVALLES_MAX];
+
+static void filtre_lot_scalaire(const CPU_INT32U* src, CPU_INT32U* idx, CPU_INT32U nb);
+static FILTRE_LOT_FNCT FiltreLot = filtre_lot_scalaire;
+static const char* FiltreNom = "scalaire";
+
+
+static int filtre_comparer(const void* a, const void* b) {
+	CPU_INT32U x = *(const CPU_INT32U*)a;
+	CPU_INT32U y = *(const CPU_INT32U*)b;
+
+	return (x > y) - (x < y);
+}
+
+// Indice du dernier intervalle dont le début est <= x (Bornes[0] vaut toujours 0)
+static CPU_INT32U filtre_chercher(CPU_INT32U x) {
+	const CPU_INT32U* b = Bornes;
+	CPU_INT32U n = NbIntervalles;
+	CPU_INT32U moitie;
+
+	while (n > 1u) {
+		moitie = n / 2u;
+		b = (b[moitie] <= x) ? b + moitie : b;
+		n -= moitie;
+	}
+	return (CPU_INT32U)(b - Bornes);
+}
+
+static void filtre_lot_scalaire(const CPU_INT32U* src, CPU_INT32U* idx, CPU_INT32U nb) {
+	CPU_INT32U i;
+
+	for (i = 0u; i < nb; i++)
+		idx[i] = filtre_chercher(src[i]);
+}
+
+#if SIMD_X86
+/*
+ * Même dichotomie que filtre_chercher, menée en parallèle sur 8 adresses : le nombre d'étapes ne
+ * dépend que de NbIntervalles, donc toutes les voies avancent ensemble. La comparaison non signée
+ * b <= x s'écrit max(b, x) == x. Sans gather (SSE4.1), les lectures de Bornes restent scalaires et
+ * la version vectorielle ne gagne rien sur filtre_lot_scalaire.
+ */
+SIMD_CIBLE("avx2")
+static void filtre_lot_avx2(const CPU_INT32U* src, CPU_INT32U* idx, CPU_INT32U nb) {
+	CPU_INT32U i, n, moitie;
+	__m256i x, base, cand, b, le;
+
+	for (i = 0u; i + 8u <= nb; i += 8u) {
+		x = _mm256_loadu_si256((const __m256i*)(src + i));
+		base = _mm256_setzero_si256();
+		n = NbIntervalles;
+		while (n > 1u) {
+			moitie = n / 2u;
+			cand = _mm256_add_epi32(base, _mm256_set1_epi32((int)moitie));
+			b = _mm256_i32gather_epi32((const int*)Bornes, cand, 4);
+			le = _mm256_cmpeq_epi32(_mm256_max_epu32(b, x), x);
+			base = _mm256_blendv_epi8(base, cand, le);
+			n -= moitie;
+		}
+		_mm256_storeu_si256((__m256i*)(idx + i), base);
+	}
+	filtre_lot_scalaire(src + i, idx + i, nb - i);
+}
+#endif
+
+
+/*
+ *********************************************************************************************************
+ *											  filtre_compiler
+ *  - Compile nb règles [bas, haut] en intervalles disjoints triés.
+ *  - Si plusieurs règles se chevauchent, l'intervalle est attribué à celle de plus petit indice.
+ *  - À appeler avant la création des tâches qui classent des paquets.
+ *********************************************************************************************************
+ */
+FILTRE_ERR filtre_compiler(const FILTRE_REGLE* regles, CPU_INT32U nb) {
+	CPU_INT32U nb_points = 0u;
+	CPU_INT32U i, k, n;
+	CPU_INT32U bas, haut, milieu;
+
+	if (nb > FILTRE_NB_REGLES_MAX || (regles == NULL && nb > 0u))
+		return FILTRE_ERR_ARG;
+	for (i = 0u; i < nb; i++) {
+		if (regles[i].bas > regles[i].haut)
+			return FILTRE_ERR_ARG;
+	}
+
+	// Points de coupure : 0, le début de chaque règle et le lendemain de sa fin
+	Points[nb_points++] = 0u;
+	for (i = 0u; i < nb; i++) {
+		Points[nb_points++] = regles[i].bas;
+		if (regles[i].haut != 0xFFFFFFFFu)
+			Points[nb_points++] = regles[i].haut + 1u;
+	}
+	qsort(Points, nb_points, sizeof(Points[0]), filtre_comparer);
+	for (i = 1u, n = 1u; i < nb_points; i++) {
+		if (Points[i] != Points[n - 1u])
+			Points[n++] = Points[i];
+	}
+	nb_points = n;
+
+	for (k = 0u; k < nb_points; k++) {
+		Bornes[k] = Points[k];
+		Regle[k] = FILTRE_AUCUNE;
+	}
+
+	// On peint de la dernière règle à la première pour que la plus petite l'emporte
+	for (i = nb; i-- > 0u; ) {
+		bas = 0u;
+		haut = nb_points;
+		while (bas < haut) {
+			milieu = (bas + haut) / 2u;
+			if (Bornes[milieu] < regles[i].bas)
+				bas = milieu + 1u;
+			else
+				haut = milieu;
+		}
+		for (k = bas; k < nb_points && Bornes[k] <= regles[i].haut; k++)
+			Regle[k] = (CPU_INT16U)i;
+	}
+
+	// Fusion des intervalles voisins attribués à la même règle
+	for (k = 1u, n = 1u; k < nb_points; k++) {
+		if (Regle[k] != Regle[n - 1u]) {
+			Bornes[n] = Bornes[k];
+			Regle[n] = Regle[k];
+			n++;
+		}
+	}
+	NbIntervalles = n;
+	NbRegles = nb;
+
+	for (i = 0u; i < FILTRE_NB_REGLES_MAX; i++)
+		Correspondances[i] = 0u;
+
+	FiltreLot = filtre_lot_scalaire;
+	FiltreNom = "scalaire";
+#if SIMD_X86
+	if (Simd.avx2) {
+		FiltreLot = filtre_lot_avx2;
+		FiltreNom = "AVX2";
+	}
+#endif
+
+	return FILTRE_OK;
+}
+
+/*
+ *********************************************************************************************************
+ *											  filtre_classer
+ *  - Retourne la règle qui rejette src, ou FILTRE_AUCUNE
+ *********************************************************************************************************
+ */
+CPU_INT16U filtre_classer(CPU_INT32U src) {
+	CPU_INT16U regle = Regle[filtre_chercher(src)];
+
+	if (regle != FILTRE_AUCUNE)
+		ATOM_INC32(&Correspondances[regle]);
+
+	return regle;
+}
+
+/*
+ *********************************************************************************************************
+ *											  filtre_classer_lot
+ *  - Classe nb sources d'un coup ; regles[i] reçoit la règle de src[i] ou FILTRE_AUCUNE
+ *  - Retourne le nombre de sources rejetées
+ *********************************************************************************************************
+ */
+CPU_INT32U filtre_classer_lot(const CPU_INT32U* src, CPU_INT16U* regles, CPU_INT32U nb) {
+	CPU_INT32U idx[64];
+	CPU_INT32U rejets = 0u;
+	CPU_INT32U i, j, n;
+	CPU_INT16U regle;
+
+	for (i = 0u; i < nb; i += n) {
+		n = (nb - i < 64u) ? (nb - i) : 64u;
+		FiltreLot(src + i, idx, n);
+		for (j = 0u; j < n; j++) {
+			regle = Regle[idx[j]];
+			regles[i + j] = regle;
+			if (regle != FILTRE_AUCUNE) {
+				ATOM_INC32(&Correspondances[regle]);
+				rejets++;
+			}
+		}
+	}
+	return rejets;
+}
+
+CPU_INT32U filtre_nb_regles(void) {
+	return NbRegles;
+}
+
+CPU_INT32U filtre_nb_correspondances(CPU_INT16U regle) {
+	if (regle >= NbRegles)
+		return 0u;
+
+	return Correspondances[regle];
+}
+
+const char* filtre_implementation(void) {
+	return FiltreNom;
+}
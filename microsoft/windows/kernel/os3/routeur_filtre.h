@@ -0,0 +1,36 @@
+/*
+ * routeur_filtre.h
+ *
+ *  Filtre de rejet des adresses sources.
+ *
+ *  La liste de plages [bas, haut] est compilée en un tableau trié d'intervalles disjoints, chacun
+ *  associé à la première règle qui le couvre. Un paquet est classé par recherche dichotomique sans
+ *  branchement ; la version par lot traite 8 adresses à la fois avec AVX2.
+ */
+
+#ifndef SRC_ROUTEUR_FILTRE_H_
+#define SRC_ROUTEUR_FILTRE_H_
+
+#include <os.h>
+
+#define FILTRE_NB_REGLES_MAX	8192u
+#define FILTRE_AUCUNE			0xFFFFu				// Aucune règle ne rejette la source
+
+typedef enum {
+	FILTRE_OK = 0,
+	FILTRE_ERR_ARG = -1
+} FILTRE_ERR;
+
+typedef struct {
+	CPU_INT32U bas;									// Bornes incluses
+	CPU_INT32U haut;
+} FILTRE_REGLE;
+
+FILTRE_ERR filtre_compiler(const FILTRE_REGLE* regles, CPU_INT32U nb);
+CPU_INT16U filtre_classer(CPU_INT32U src);
+CPU_INT32U filtre_classer_lot(const CPU_INT32U* src, CPU_INT16U* regles, CPU_INT32U nb);
+CPU_INT32U filtre_nb_regles(void);
+CPU_INT32U filtre_nb_correspondances(CPU_INT16U regle);
+const char* filtre_implementation(void);
+
+#endif /* SRC_ROUTEUR_FILTRE_H_ */
@@ -0,0 +1,100 @@
+/*
+*********************************************************************************************************
+*                                                 uC/OS-III
+*                                          The Real-Time Kernel
+*                                               PORT Windows
+*
+*
+*                                  Polytechnique Montreal, Qc, CANADA
+*
+* File : routeur_jetons.c
+*
+*********************************************************************************************************
+*/
+
+#include "routeur_jetons.h"
+
+#include  "routeur_atomique.h"
+
+
+/*
+ *********************************************************************************************************
+ *											  jetons_init
+ *  - debit en octets par seconde (0 : pas de mise en forme), rafale en octets
+ *  - Le seau part plein
+ *********************************************************************************************************
+ */
+void jetons_init(JETONS_SEAU* seau, CPU_INT32U debit, CPU_INT32U rafale, OS_TICK maintenant) {
+	seau->debit = debit;
+	seau->capacite = (CPU_INT64U)rafale * OS_CFG_TICK_RATE_HZ;
+	seau->jetons = seau->capacite;
+	seau->dernier = maintenant;
+	seau->en_attente = DEF_NO;
+	seau->debut_attente = maintenant;
+
+	seau->nb_paquets = 0u;
+	seau->nb_retardes = 0u;
+	seau->attente_totale = 0u;
+	seau->attente_max = 0u;
+	seau->pertes = 0u;
+}
+
+/*
+ *********************************************************************************************************
+ *											  jetons_prendre
+ *  - Retourne 0 si le paquet de taille octets peut partir (ses jetons sont consommés), sinon le
+ *    nombre de ticks à attendre avant de redemander.
+ *  - Un paquet plus gros que la rafale part dès que le seau est plein.
+ *********************************************************************************************************
+ */
+OS_TICK jetons_prendre(JETONS_SEAU* seau, CPU_INT32U octets, OS_TICK maintenant) {
+	CPU_INT64U besoin;
+	OS_TICK attente;
+
+	if (seau->debit == 0u) {
+		ATOM_ECRIRE32(&seau->nb_paquets, seau->nb_paquets + 1u);
+		return 0u;
+	}
+
+	// Remplissage paresseux : debit octets par seconde = debit / OS_CFG_TICK_RATE_HZ octets par tick
+	seau->jetons += (CPU_INT64U)(OS_TICK)(maintenant - seau->dernier) * seau->debit;
+	if (seau->jetons > seau->capacite)
+		seau->jetons = seau->capacite;
+	seau->dernier = maintenant;
+
+	besoin = (CPU_INT64U)octets * OS_CFG_TICK_RATE_HZ;
+	if (besoin > seau->capacite)
+		besoin = seau->capacite;
+
+	if (seau->jetons < besoin) {
+		if (seau->en_attente == DEF_NO) {
+			seau->en_attente = DEF_YES;
+			seau->debut_attente = maintenant;
+		}
+		return (OS_TICK)((besoin - seau->jetons + seau->debit - 1u) / seau->debit);
+	}
+
+	seau->jetons -= besoin;
+	ATOM_ECRIRE32(&seau->nb_paquets, seau->nb_paquets + 1u);
+	if (seau->en_attente == DEF_YES) {
+		seau->en_attente = DEF_NO;
+		attente = maintenant - seau->debut_attente;
+		ATOM_ECRIRE32(&seau->nb_retardes, seau->nb_retardes + 1u);
+		ATOM_ECRIRE32(&seau->attente_totale, seau->attente_totale + attente);
+		if (attente > seau->attente_max)
+			ATOM_ECRIRE32(&seau->attente_max, attente);
+	}
+	return 0u;
+}
+
+// Paquet refusé par la file du port ; appelé par les tâches qui alimentent le port (plusieurs en run-to-completion)
+void jetons_perte(JETONS_SEAU* seau) {
+	ATOM_INC32(&seau->pertes);
+}
+
+// Attente moyenne, en ticks, des paquets retardés
+CPU_INT32U jetons_attente_moyenne(const JETONS_SEAU* seau) {
+	CPU_INT32U nb = ATOM_LIRE32(&seau->nb_retardes);
+
+	return (nb == 0u) ? 0u : ATOM_LIRE32(&seau->attente_totale) / nb;
+}
@@ -0,0 +1,37 @@
+/*
+ * routeur_jetons.h
+ *
+ *  Mise en forme du trafic des ports de sortie par seau à jetons.
+ *
+ *  Le seau se remplit au débit configuré, jusqu'à la rafale maximale. Le remplissage est paresseux :
+ *  il est calculé à partir du nombre de ticks écoulés au moment où un paquet demande des jetons.
+ *  Un paquet sans jetons suffisants attend ; pendant ce temps les suivants restent dans la file du port.
+ */
+
+#ifndef SRC_ROUTEUR_JETONS_H_
+#define SRC_ROUTEUR_JETONS_H_
+
+#include <os.h>
+
+typedef struct {
+	CPU_INT64U debit;								// Octets par seconde, 0 : illimité
+	CPU_INT64U capacite;							// Rafale, en octets x OS_CFG_TICK_RATE_HZ
+	CPU_INT64U jetons;								// Même unité que capacite
+	OS_TICK    dernier;								// Tick du dernier remplissage
+	CPU_BOOLEAN en_attente;
+	OS_TICK    debut_attente;
+
+	// Statistiques : un seul écrivain par champ (la tâche du port), sauf pertes qu'incrémentent les émetteurs
+	volatile CPU_INT32U nb_paquets;
+	volatile CPU_INT32U nb_retardes;
+	volatile CPU_INT32U attente_totale;				// Ticks
+	volatile CPU_INT32U attente_max;
+	volatile CPU_INT32U pertes;
+} JETONS_SEAU;
+
+void       jetons_init(JETONS_SEAU* seau, CPU_INT32U debit, CPU_INT32U rafale, OS_TICK maintenant);
+OS_TICK    jetons_prendre(JETONS_SEAU* seau, CPU_INT32U octets, OS_TICK maintenant);
+void       jetons_perte(JETONS_SEAU* seau);
+CPU_INT32U jetons_attente_moyenne(const JETONS_SEAU* seau);
+
+#endif /* SRC_ROUTEUR_JETONS_H_ */
@@ -0,0 +1,284 @@
+/*
+*********************************************************************************************************
+*                                                 uC/OS-III
+*                                          The Real-Time Kernel
+*                                               PORT Windows
+*
+*
+*                                  Polytechnique Montreal, Qc, CANADA
+*
+* File : routeur_journal.c
+*
+*********************************************************************************************************
+*/
+
+#include "routeur_journal.h"
+
+#include  <stdio.h>
+#include  <string.h>
+#include  <lib_mem.h>
+#include  "routeur_atomique.h"
+
+#ifdef _MSC_VER
+#include  <io.h>
+#define journal_write(buf, n)	_write(1, (buf), (unsigned int)(n))
+#else
+#include  <unistd.h>
+#define journal_write(buf, n)	write(1, (buf), (n))
+#endif
+
+#define JOURNAL_LIGNE_MAX		512u				// Taille maximale d'un message mis en forme
+
+typedef struct {
+	OS_TICK    tick;
+	CPU_INT16U fmt;
+	CPU_INT16U nb_args;
+	CPU_INT64U args[JOURNAL_NB_ARGS_MAX];
+} JOURNAL_ENTREE;
+
+// tete n'est écrite que par la tâche propriétaire, queue que par la tâche de journal :
+// chacune sur sa ligne de cache
+typedef struct {
+	volatile CPU_INT32U tete;
+	volatile CPU_INT32U pertes;
+	CPU_INT08U          pad0[ATOM_TAILLE_LIGNE_CACHE - 2u * sizeof(CPU_INT32U)];
+	volatile CPU_INT32U queue;
+	CPU_INT08U          pad1[ATOM_TAILLE_LIGNE_CACHE - sizeof(CPU_INT32U)];
+	JOURNAL_ENTREE      entrees[JOURNAL_TAILLE_ANNEAU];
+} JOURNAL_ANNEAU;
+
+static ATOM_ALIGNE_CACHE JOURNAL_ANNEAU Anneaux[JOURNAL_NB_ANNEAUX_MAX];
+
+static const char* const* Formats = NULL;
+static CPU_INT32U         NbFormats = 0u;
+static OS_MUTEX*          MutSortie = NULL;
+static volatile CPU_INT64U NbEcrits = 0u;
+static volatile CPU_INT32U PertesHorsAnneaux = 0u;	// Messages d'un écrivain sans anneau (plusieurs écrivains possibles)
+
+static char Tampon[JOURNAL_TAILLE_TAMPON];
+static CPU_SIZE_T TamponLong = 0u;
+
+
+static void journal_purger(void) {
+	OS_ERR err;
+	CPU_TS ts;
+
+	if (TamponLong == 0u)
+		return;
+
+	// Le tampon de stdout (printf de TaskStats) part avant le nôtre pour garder l'ordre à l'écran
+	if (MutSortie != NULL)
+		OSMutexPend(MutSortie, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
+	fflush(stdout);
+	journal_write(Tampon, TamponLong);
+	if (MutSortie != NULL)
+		OSMutexPost(MutSortie, OS_OPT_POST_NONE, &err);
+
+	TamponLong = 0u;
+}
+
+/*
+ * Met en forme une entrée : le texte littéral est recopié, chaque conversion est confiée à
+ * snprintf avec un argument du type qu'elle attend.
+ */
+static CPU_SIZE_T journal_formater(char* dst, CPU_SIZE_T taille, const JOURNAL_ENTREE* e) {
+	const char* f;
+	char spec[16];
+	CPU_SIZE_T n = 0u;
+	CPU_INT32U k, arg = 0u, nb_l;
+	CPU_INT64U v;
+	int r;
+
+	if (e->fmt >= NbFormats || Formats[e->fmt] == NULL)
+		return 0u;
+
+	for (f = Formats[e->fmt]; *f != '\0' && n + 1u < taille; f++) {
+		if (*f != '%') {
+			dst[n++] = *f;
+			continue;
+		}
+		if (f[1] == '%') {
+			dst[n++] = '%';
+			f++;
+			continue;
+		}
+
+		// %[drapeaux][largeur][.précision][longueur]conversion
+		k = 0u;
+		nb_l = 0u;
+		spec[k++] = *f++;
+		while (*f != '\0' && k < sizeof(spec) - 2u && strchr("-+ #0123456789.hlzjt", *f) != NULL) {
+			if (*f == 'l')
+				nb_l++;
+			spec[k++] = *f++;
+		}
+		if (*f == '\0')
+			break;
+		spec[k++] = *f;
+		spec[k] = '\0';
+
+		v = (arg < e->nb_args) ? e->args[arg] : 0u;
+		arg++;
+		switch (*f) {
+		case 'd':
+		case 'i':
+			r = (nb_l >= 2u) ? snprintf(dst + n, taille - n, spec, (long long)v)
+			  : (nb_l == 1u) ? snprintf(dst + n, taille - n, spec, (long)v)
+			  : snprintf(dst + n, taille - n, spec, (int)v);
+			break;
+		case 'u':
+		case 'x':
+		case 'X':
+		case 'o':
+			r = (nb_l >= 2u) ? snprintf(dst + n, taille - n, spec, (unsigned long long)v)
+			  : (nb_l == 1u) ? snprintf(dst + n, taille - n, spec, (unsigned long)v)
+			  : snprintf(dst + n, taille - n, spec, (unsigned int)v);
+			break;
+		case 'c':
+			r = snprintf(dst + n, taille - n, spec, (int)v);
+			break;
+		default:
+			r = snprintf(dst + n, taille - n, "?");
+			break;
+		}
+		if (r < 0)
+			break;
+		n += ((CPU_SIZE_T)r < taille - n) ? (CPU_SIZE_T)r : taille - n - 1u;
+	}
+	dst[n] = '\0';
+	return n;
+}
+
+
+/*
+ *********************************************************************************************************
+ *											  journal_init
+ *  - formats[i] est le texte du message i ; le tableau doit rester valide
+ *  - mut_sortie (facultatif) est pris autour de chaque write() pour ne pas couper les printf des autres
+ *********************************************************************************************************
+ */
+void journal_init(const char* const* formats, CPU_INT32U nb_formats, OS_MUTEX* mut_sortie) {
+	Mem_Clr((void*)Anneaux, sizeof(Anneaux));
+	Formats = formats;
+	NbFormats = nb_formats;
+	MutSortie = mut_sortie;
+	NbEcrits = 0u;
+	TamponLong = 0u;
+}
+
+/*
+ *********************************************************************************************************
+ *											  journal_ajouter
+ *  - Dépose un message dans l'anneau de la tâche appelante (un seul écrivain par anneau)
+ *  - Ne bloque jamais : si l'anneau est plein ou n'existe pas, le message est compté comme perdu
+ *********************************************************************************************************
+ */
+void journal_ajouter(CPU_INT32U anneau, CPU_INT16U fmt, const CPU_INT64U* args, CPU_INT32U nb_args) {
+	JOURNAL_ANNEAU* a;
+	JOURNAL_ENTREE* e;
+	CPU_INT32U tete, i;
+
+	if (anneau >= JOURNAL_NB_ANNEAUX_MAX) {
+		ATOM_INC32(&PertesHorsAnneaux);
+		return;
+	}
+
+	a = &Anneaux[anneau];
+	tete = a->tete;
+	if (tete - ATOM_LIRE32(&a->queue) >= JOURNAL_TAILLE_ANNEAU) {
+		ATOM_ECRIRE32(&a->pertes, a->pertes + 1u);
+		return;
+	}
+
+	if (nb_args > JOURNAL_NB_ARGS_MAX)
+		nb_args = JOURNAL_NB_ARGS_MAX;
+
+	e = &a->entrees[tete & (JOURNAL_TAILLE_ANNEAU - 1u)];
+	e->tick = OSTickCtr;
+	e->fmt = fmt;
+	e->nb_args = (CPU_INT16U)nb_args;
+	for (i = 0u; i < nb_args; i++)
+		e->args[i] = args[i];
+
+	ATOM_ECRIRE32(&a->tete, tete + 1u);			// Publie l'entrée
+}
+
+/*
+ *********************************************************************************************************
+ *											  journal_vider
+ *  - Met en forme tous les messages en attente, dans l'ordre de leur tick, et les écrit
+ *  - Retourne le nombre de messages écrits
+ *********************************************************************************************************
+ */
+CPU_INT32U journal_vider(void) {
+	CPU_INT32U fin[JOURNAL_NB_ANNEAUX_MAX];
+	CPU_INT32U pos[JOURNAL_NB_ANNEAUX_MAX];
+	const JOURNAL_ENTREE* e;
+	CPU_INT32U i, choisi, nb = 0u;
+	OS_TICK plus_ancien;
+
+	for (i = 0u; i < JOURNAL_NB_ANNEAUX_MAX; i++) {
+		fin[i] = ATOM_LIRE32(&Anneaux[i].tete);
+		pos[i] = Anneaux[i].queue;
+	}
+
+	// Fusion des anneaux : le plus ancien message d'abord
+	while (DEF_TRUE) {
+		choisi = JOURNAL_NB_ANNEAUX_MAX;
+		plus_ancien = 0u;
+		for (i = 0u; i < JOURNAL_NB_ANNEAUX_MAX; i++) {
+			if (pos[i] == fin[i])
+				continue;
+			e = &Anneaux[i].entrees[pos[i] & (JOURNAL_TAILLE_ANNEAU - 1u)];
+			if (choisi == JOURNAL_NB_ANNEAUX_MAX || (OS_TICK)(e->tick - plus_ancien) > (OS_TICK)0x7FFFFFFFu) {
+				choisi = i;
+				plus_ancien = e->tick;
+			}
+		}
+		if (choisi == JOURNAL_NB_ANNEAUX_MAX)
+			break;
+
+		if (JOURNAL_TAILLE_TAMPON - TamponLong < JOURNAL_LIGNE_MAX)
+			journal_purger();
+
+		e = &Anneaux[choisi].entrees[pos[choisi] & (JOURNAL_TAILLE_ANNEAU - 1u)];
+		TamponLong += journal_formater(Tampon + TamponLong, JOURNAL_LIGNE_MAX, e);
+		pos[choisi]++;
+		ATOM_ECRIRE32(&Anneaux[choisi].queue, pos[choisi]);	// Libère la place pour l'écrivain
+		nb++;
+	}
+
+	journal_purger();
+	ATOM_ECRIRE64_PROPRIO(&NbEcrits, NbEcrits, NbEcrits + nb);
+	return nb;
+}
+
+/*
+ *********************************************************************************************************
+ *											  journal_tache
+ *  - Corps de la tâche de journal : vide les anneaux à chaque tick
+ *********************************************************************************************************
+ */
+void journal_tache(void* data) {
+	OS_ERR err;
+
+	(void)data;
+	while (DEF_TRUE) {
+		journal_vider();
+		OSTimeDly(1, OS_OPT_TIME_DLY, &err);
+	}
+}
+
+CPU_INT64U journal_nb_pertes(void) {
+	CPU_INT64U total = ATOM_LIRE32(&PertesHorsAnneaux);
+	CPU_INT32U i;
+
+	for (i = 0u; i < JOURNAL_NB_ANNEAUX_MAX; i++)
+		total += ATOM_LIRE32(&Anneaux[i].pertes);
+
+	return total;
+}
+
+CPU_INT64U journal_nb_ecrits(void) {
+	return ATOM_LIRE64(&NbEcrits);
+}
@@ -0,0 +1,42 @@
+/*
+ * routeur_journal.h
+ *
+ *  Journal asynchrone des tâches du routeur.
+ *
+ *  Une tâche n'imprime plus elle-même : elle dépose un identifiant de format et ses arguments
+ *  bruts dans son propre anneau (un seul écrivain, un seul lecteur, sans verrou). La tâche de
+ *  journal, de faible priorité, vide les anneaux par lots, met les messages en forme et les écrit
+ *  d'un seul appel à write(). Un message est perdu, et compté, si l'anneau de la tâche est plein.
+ *
+ *  Les formats acceptent les conversions entières de printf (d, i, u, x, X, o, c ; ll pour 64 bits).
+ */
+
+#ifndef SRC_ROUTEUR_JOURNAL_H_
+#define SRC_ROUTEUR_JOURNAL_H_
+
+#include <os.h>
+
+#ifndef JOURNAL_NB_ANNEAUX_MAX
+#define JOURNAL_NB_ANNEAUX_MAX	32u					// Un anneau par écrivain (tranche de compteurs)
+#endif
+#define JOURNAL_TAILLE_ANNEAU	512u				// Messages par anneau, puissance de 2
+#define JOURNAL_NB_ARGS_MAX		4u
+#define JOURNAL_TAILLE_TAMPON	16384u				// Texte accumulé avant un write()
+
+void       journal_init(const char* const* formats, CPU_INT32U nb_formats, OS_MUTEX* mut_sortie);
+void       journal_ajouter(CPU_INT32U anneau, CPU_INT16U fmt, const CPU_INT64U* args, CPU_INT32U nb_args);
+CPU_INT32U journal_vider(void);
+void       journal_tache(void* data);
+
+CPU_INT64U journal_nb_pertes(void);
+CPU_INT64U journal_nb_ecrits(void);
+
+// journal_ecrire(anneau, fmt, arg0, arg1, ...) : jusqu'à JOURNAL_NB_ARGS_MAX arguments entiers
+#define journal_ecrire(anneau, fmt, ...)												\
+do {																					\
+	const CPU_INT64U journal_args_[] = { 0u, ##__VA_ARGS__ };							\
+	journal_ajouter((anneau), (fmt), journal_args_ + 1,									\
+	                (CPU_INT32U)(sizeof(journal_args_) / sizeof(journal_args_[0]) - 1u));	\
+} while (0)
+
+#endif /* SRC_ROUTEUR_JOURNAL_H_ */
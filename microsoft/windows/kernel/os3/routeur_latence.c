@@ -0,0 +1,112 @@
+/*
+*********************************************************************************************************
+*                                                 uC/OS-III
+*                                          The Real-Time Kernel
+*                                               PORT Windows
+*
+*
+*                                  Polytechnique Montreal, Qc, CANADA
+*
+* File : routeur_latence.c
+*
+*********************************************************************************************************
+*/
+
+#include "routeur_latence.h"
+
+#include  "routeur_atomique.h"
+
+#define LATENCE_BITS_SOUS_CASE	4u					// log2(LATENCE_SOUS_CASES)
+
+
+static CPU_INT32U latence_case(CPU_INT32U us) {
+	CPU_INT32U e;
+
+	if (us < LATENCE_SOUS_CASES)
+		return us;
+
+	e = 31u - (CPU_INT32U)CPU_CntLeadZeros32(us);	// Bit de poids fort, au moins LATENCE_BITS_SOUS_CASE
+	return LATENCE_SOUS_CASES * (e - LATENCE_BITS_SOUS_CASE + 1u)
+	     + ((us >> (e - LATENCE_BITS_SOUS_CASE)) & (LATENCE_SOUS_CASES - 1u));
+}
+
+// Plus grande valeur en us qui tombe dans la case
+static CPU_INT32U latence_borne(CPU_INT32U c) {
+	CPU_INT32U decalage, bas;
+
+	if (c < LATENCE_SOUS_CASES)
+		return c;
+
+	decalage = c / LATENCE_SOUS_CASES - 1u;
+	bas = (LATENCE_SOUS_CASES + c % LATENCE_SOUS_CASES) << decalage;
+	return bas + ((1u << decalage) - 1u);
+}
+
+
+void latence_raz(LATENCE_HISTO* h) {
+	CPU_INT32U c;
+
+	for (c = 0u; c < LATENCE_NB_CASES; c++)
+		h->nb[c] = 0u;
+	h->total = 0u;
+	h->max_us = 0u;
+}
+
+/*
+ *********************************************************************************************************
+ *											  latence_ajouter
+ *  - Ajoute la latence ts_fin - ts_debut ; réservé à l'unique écrivain de l'histogramme
+ *********************************************************************************************************
+ */
+void latence_ajouter(LATENCE_HISTO* h, CPU_TS ts_debut, CPU_TS ts_fin) {
+	CPU_INT64U ns = CPU_TS32_to_nSec((CPU_TS32)(ts_fin - ts_debut));	// Sans division 64 bits par la fréquence
+	CPU_INT64U us64 = (ns <= DEF_INT_32U_MAX_VAL) ? (CPU_INT64U)((CPU_INT32U)ns / 1000u) : ns / 1000u;
+	CPU_INT32U us = (us64 > DEF_INT_32U_MAX_VAL) ? DEF_INT_32U_MAX_VAL : (CPU_INT32U)us64;
+	CPU_INT32U c = latence_case(us);
+
+	ATOM_ECRIRE32(&h->nb[c], h->nb[c] + 1u);
+	ATOM_ECRIRE32(&h->total, h->total + 1u);
+	if (us > h->max_us)
+		ATOM_ECRIRE32(&h->max_us, us);
+}
+
+// Additionne h dans somme, une copie locale du lecteur
+void latence_cumuler(LATENCE_HISTO* somme, const LATENCE_HISTO* h) {
+	CPU_INT32U c, max;
+
+	for (c = 0u; c < LATENCE_NB_CASES; c++)
+		somme->nb[c] += ATOM_LIRE32(&h->nb[c]);
+	somme->total += ATOM_LIRE32(&h->total);
+	max = ATOM_LIRE32(&h->max_us);
+	if (max > somme->max_us)
+		somme->max_us = max;
+}
+
+/*
+ *********************************************************************************************************
+ *											  latence_quantile
+ *  - pour_10000 : rang du quantile en dix-millièmes (5000 : médiane, 9990 : p99,9)
+ *  - Retourne la borne supérieure de la case qui contient le quantile, sans dépasser le maximum
+ *    observé ; 0 si l'histogramme est vide
+ *********************************************************************************************************
+ */
+CPU_INT32U latence_quantile(const LATENCE_HISTO* h, CPU_INT32U pour_10000) {
+	CPU_INT64U rang, cumul = 0u;
+	CPU_INT32U c, borne;
+
+	if (h->total == 0u)
+		return 0u;
+
+	rang = ((CPU_INT64U)h->total * pour_10000 + 9999u) / 10000u;
+	if (rang == 0u)
+		rang = 1u;
+
+	for (c = 0u; c < LATENCE_NB_CASES; c++) {
+		cumul += h->nb[c];
+		if (cumul >= rang) {
+			borne = latence_borne(c);
+			return (borne < h->max_us) ? borne : h->max_us;
+		}
+	}
+	return h->max_us;
+}
@@ -0,0 +1,31 @@
+/*
+ * routeur_latence.h
+ *
+ *  Histogrammes de latence de bout en bout (TaskGenerate -> TaskOutputPort), en microsecondes.
+ *
+ *  Les cases sont log-linéaires : valeurs exactes jusqu'à 15 us, puis 16 cases par puissance de 2,
+ *  soit une erreur relative d'au plus 1/16 sur les quantiles. Chaque histogramme n'a qu'un seul
+ *  écrivain (la tâche d'un port, pour une classe) ; le lecteur additionne les histogrammes voulus
+ *  dans une copie locale avant d'en tirer les quantiles.
+ */
+
+#ifndef SRC_ROUTEUR_LATENCE_H_
+#define SRC_ROUTEUR_LATENCE_H_
+
+#include <os.h>
+
+#define LATENCE_SOUS_CASES		16u					// Cases par puissance de 2, puissance de 2
+#define LATENCE_NB_CASES		(LATENCE_SOUS_CASES * 29u)	// Couvre tout CPU_INT32U
+
+typedef struct {
+	volatile CPU_INT32U nb[LATENCE_NB_CASES];
+	volatile CPU_INT32U total;
+	volatile CPU_INT32U max_us;
+} LATENCE_HISTO;
+
+void       latence_raz(LATENCE_HISTO* h);
+void       latence_ajouter(LATENCE_HISTO* h, CPU_TS ts_debut, CPU_TS ts_fin);
+void       latence_cumuler(LATENCE_HISTO* somme, const LATENCE_HISTO* h);
+CPU_INT32U latence_quantile(const LATENCE_HISTO* h, CPU_INT32U pour_10000);
+
+#endif /* SRC_ROUTEUR_LATENCE_H_ */
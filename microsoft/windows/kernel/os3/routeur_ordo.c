@@ -0,0 +1,207 @@
+/*
+*********************************************************************************************************
+*                                                 uC/OS-III
+*                                          The Real-Time Kernel
+*                                               PORT Windows
+*
+*
+*                                  Polytechnique Montreal, Qc, CANADA
+*
+* File : routeur_ordo.c
+*
+*********************************************************************************************************
+*/
+
+#include "routeur_ordo.h"
+
+#include  <stdlib.h>
+#include  "routeur_atomique.h"
+
+#define ORDO_ECHELLE		65536u					// Précision des étiquettes virtuelles de WFQ
+
+// L'état n'est modifié que par la tâche qui sert les files (TaskForwarding), ou sous mutOrdo en run-to-completion
+static ORDO_POLITIQUE Politique = ORDO_STRICT;
+static CPU_INT32U     NbClasses = 0u;
+static CPU_INT32U     Poids[ORDO_NB_CLASSES_MAX];	// Quantum en octets (DRR) ou poids (WFQ)
+
+// DRR
+static CPU_INT32U     Courant = 0u;
+static CPU_INT32S     Deficit[ORDO_NB_CLASSES_MAX];
+
+// WFQ (SFQ) : étiquettes de début et de fin par classe, temps virtuel global
+static CPU_BOOLEAN    Actif[ORDO_NB_CLASSES_MAX];
+static CPU_INT64U     Debut[ORDO_NB_CLASSES_MAX];
+static CPU_INT64U     Fin[ORDO_NB_CLASSES_MAX];
+static CPU_INT64U     TempsVirtuel = 0u;
+
+static volatile CPU_INT64U NbServis[ORDO_NB_CLASSES_MAX];
+static volatile CPU_INT64U OctetsServis[ORDO_NB_CLASSES_MAX];
+
+
+static CPU_INT32U ordo_choisir_strict(const CPU_INT32U* nb_attente) {
+	CPU_INT32U c;
+
+	for (c = 0u; c < NbClasses; c++) {
+		if (nb_attente[c] > 0u)
+			return c;
+	}
+	return ORDO_AUCUNE;
+}
+
+/*
+ * Le déficit peut devenir négatif puisque la taille n'est connue qu'après le service ; la dette
+ * est remboursée par les quanta des tours suivants.
+ */
+static CPU_INT32U ordo_choisir_drr(const CPU_INT32U* nb_attente) {
+	CPU_INT32U c = Courant;
+
+	if (ordo_choisir_strict(nb_attente) == ORDO_AUCUNE)
+		return ORDO_AUCUNE;
+
+	while (DEF_TRUE) {
+		if (nb_attente[c] == 0u) {
+			if (Deficit[c] > 0)
+				Deficit[c] = 0;						// Une classe vide ne garde pas son crédit
+		}
+		else if (Deficit[c] > 0) {
+			Courant = c;
+			return c;
+		}
+		c = (c + 1u) % NbClasses;
+		if (nb_attente[c] > 0u)
+			Deficit[c] += (CPU_INT32S)Poids[c];
+	}
+}
+
+static CPU_INT32U ordo_choisir_wfq(const CPU_INT32U* nb_attente) {
+	CPU_INT32U c, choisie = ORDO_AUCUNE;
+
+	for (c = 0u; c < NbClasses; c++) {
+		if (nb_attente[c] == 0u) {
+			Actif[c] = DEF_NO;
+			continue;
+		}
+		if (Actif[c] == DEF_NO) {
+			Actif[c] = DEF_YES;
+			Debut[c] = (Fin[c] > TempsVirtuel) ? Fin[c] : TempsVirtuel;
+		}
+		if (choisie == ORDO_AUCUNE || Debut[c] < Debut[choisie])
+			choisie = c;
+	}
+	return choisie;
+}
+
+
+/*
+ *********************************************************************************************************
+ *											  ordo_init
+ *  - poids[c] est le quantum en octets par tour (DRR) ou le poids relatif (WFQ) de la classe c ;
+ *    il est ignoré par ORDO_STRICT et peut alors être NULL
+ *  - La classe 0 est la plus prioritaire
+ *********************************************************************************************************
+ */
+ORDO_ERR ordo_init(ORDO_POLITIQUE politique, const CPU_INT32U* poids, CPU_INT32U nb_classes) {
+	CPU_INT32U c;
+
+	if (nb_classes == 0u || nb_classes > ORDO_NB_CLASSES_MAX || politique > ORDO_WFQ)
+		return ORDO_ERR_ARG;
+	if (politique != ORDO_STRICT) {
+		if (poids == NULL)
+			return ORDO_ERR_ARG;
+		for (c = 0u; c < nb_classes; c++) {
+			if (poids[c] == 0u || poids[c] > 0x7FFFFFFFu)
+				return ORDO_ERR_ARG;
+		}
+	}
+
+	Politique = politique;
+	NbClasses = nb_classes;
+	Courant = nb_classes - 1u;						// Le premier tour commence par la classe 0
+	TempsVirtuel = 0u;
+	for (c = 0u; c < ORDO_NB_CLASSES_MAX; c++) {
+		Poids[c] = (poids != NULL && c < nb_classes) ? poids[c] : 1u;
+		Deficit[c] = 0;
+		Actif[c] = DEF_NO;
+		Debut[c] = 0u;
+		Fin[c] = 0u;
+		NbServis[c] = 0u;
+		OctetsServis[c] = 0u;
+	}
+	return ORDO_OK;
+}
+
+/*
+ *********************************************************************************************************
+ *											  ordo_choisir
+ *  - nb_attente[c] : nombre de paquets dans la file de la classe c
+ *  - Retourne la classe à servir, ou ORDO_AUCUNE si toutes les files sont vides
+ *  - Si la file choisie se révèle vide au moment de la lire, il suffit de rappeler ordo_choisir
+ *********************************************************************************************************
+ */
+CPU_INT32U ordo_choisir(const CPU_INT32U* nb_attente) {
+	switch (Politique) {
+	case ORDO_DRR:
+		return ordo_choisir_drr(nb_attente);
+	case ORDO_WFQ:
+		return ordo_choisir_wfq(nb_attente);
+	case ORDO_STRICT:
+	default:
+		return ordo_choisir_strict(nb_attente);
+	}
+}
+
+/*
+ *********************************************************************************************************
+ *											  ordo_servi
+ *  - Un paquet de la classe a été retiré de sa file : met à jour le crédit de la classe et ses compteurs
+ *********************************************************************************************************
+ */
+void ordo_servi(CPU_INT32U classe, CPU_INT32U octets) {
+	if (classe >= NbClasses)
+		return;
+
+	switch (Politique) {
+	case ORDO_DRR:
+		Deficit[classe] -= (CPU_INT32S)octets;
+		break;
+	case ORDO_WFQ:
+		TempsVirtuel = Debut[classe];
+		Fin[classe] = Debut[classe] + ((CPU_INT64U)octets * ORDO_ECHELLE) / Poids[classe];
+		Debut[classe] = Fin[classe];				// Étiquette du paquet suivant de la même classe
+		break;
+	default:
+		break;
+	}
+
+	ATOM_ECRIRE64_PROPRIO(&NbServis[classe], NbServis[classe], NbServis[classe] + 1u);
+	ATOM_ECRIRE64_PROPRIO(&OctetsServis[classe], OctetsServis[classe], OctetsServis[classe] + octets);
+}
+
+ORDO_POLITIQUE ordo_politique(void) {
+	return Politique;
+}
+
+const char* ordo_nom(void) {
+	switch (Politique) {
+	case ORDO_DRR:
+		return "DRR";
+	case ORDO_WFQ:
+		return "WFQ";
+	default:
+		return "priorite stricte";
+	}
+}
+
+CPU_INT64U ordo_nb_servis(CPU_INT32U classe) {
+	if (classe >= ORDO_NB_CLASSES_MAX)
+		return 0u;
+
+	return ATOM_LIRE64(&NbServis[classe]);
+}
+
+CPU_INT64U ordo_octets_servis(CPU_INT32U classe) {
+	if (classe >= ORDO_NB_CLASSES_MAX)
+		return 0u;
+
+	return ATOM_LIRE64(&OctetsServis[classe]);
+}
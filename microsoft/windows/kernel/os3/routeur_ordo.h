@@ -0,0 +1,44 @@
+/*
+ * routeur_ordo.h
+ *
+ *  Ordonnanceur de classes entre les files de priorité (highQ, mediumQ, lowQ) et dispatch_packet.
+ *
+ *  - ORDO_STRICT : la première classe non vide est toujours servie (comportement d'origine).
+ *  - ORDO_DRR    : Deficit Round Robin, chaque classe reçoit un quantum d'octets par tour.
+ *  - ORDO_WFQ    : file équitable pondérée, approchée par Start-time Fair Queuing (SFQ).
+ *
+ *  L'ordonnanceur ne regarde que le nombre de paquets en attente par classe ; la taille réelle du
+ *  paquet servi lui est rendue ensuite par ordo_servi(). Le coût par décision est O(nb de classes),
+ *  soit O(1) pour un nombre de classes fixé, et O(1) tours de DRR si les quanta couvrent un paquet.
+ *  À poids égaux, la classe de plus petit indice (la vidéo) passe en premier.
+ */
+
+#ifndef SRC_ROUTEUR_ORDO_H_
+#define SRC_ROUTEUR_ORDO_H_
+
+#include <os.h>
+
+#define ORDO_NB_CLASSES_MAX		8u
+#define ORDO_AUCUNE				0xFFFFFFFFu			// Aucune classe n'a de paquet en attente
+
+typedef enum {
+	ORDO_STRICT,
+	ORDO_DRR,
+	ORDO_WFQ
+} ORDO_POLITIQUE;
+
+typedef enum {
+	ORDO_OK = 0,
+	ORDO_ERR_ARG = -1
+} ORDO_ERR;
+
+ORDO_ERR       ordo_init(ORDO_POLITIQUE politique, const CPU_INT32U* poids, CPU_INT32U nb_classes);
+CPU_INT32U     ordo_choisir(const CPU_INT32U* nb_attente);
+void           ordo_servi(CPU_INT32U classe, CPU_INT32U octets);
+
+ORDO_POLITIQUE ordo_politique(void);
+const char*    ordo_nom(void);
+CPU_INT64U     ordo_nb_servis(CPU_INT32U classe);
+CPU_INT64U     ordo_octets_servis(CPU_INT32U classe);
+
+#endif /* SRC_ROUTEUR_ORDO_H_ */
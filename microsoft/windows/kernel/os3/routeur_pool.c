@@ -0,0 +1,306 @@
+/*
+*********************************************************************************************************
+*                                                 uC/OS-III
+*                                          The Real-Time Kernel
+*                                               PORT Windows
+*
+*
+*                                  Polytechnique Montreal, Qc, CANADA
+*
+* File : routeur_pool.c
+*
+*********************************************************************************************************
+*/
+
+#include "routeur_pool.h"
+
+#include  <cpu.h>
+
+#define POOL_AUCUN			0xFFFFu
+
+typedef enum {
+	SEAU_LIBRE,										// Vide, dans aucune liste
+	SEAU_PRET,										// Dans la liste de son propriétaire
+	SEAU_EN_COURS									// En traitement chez son propriétaire
+} SEAU_ETAT;
+
+typedef struct {
+	void*      msgs[POOL_CAPACITE_SEAU];
+	CPU_INT16U tete;
+	CPU_INT16U nb;
+	CPU_INT08U etat;
+	CPU_INT08U proprio;
+} POOL_SEAU;
+
+typedef struct {
+	OS_SEM     sem;									// Réveil du travailleur
+	CPU_INT16U prets[POOL_NB_SEAUX];				// Seaux prêts (file circulaire)
+	CPU_INT32U tete;
+	CPU_INT32U nb;
+	CPU_INT32U courant;								// Seau en traitement ou POOL_AUCUN
+	CPU_INT32U quantum;
+	CPU_BOOLEAN inactif;
+	CPU_INT32U nb_vols;
+} POOL_TRAVAILLEUR;
+
+// Toutes les structures sont protégées par la section critique du processeur (accès de quelques lignes)
+static POOL_SEAU        Seaux[POOL_NB_SEAUX];
+static POOL_TRAVAILLEUR Travailleurs[POOL_NB_TRAVAILLEURS_MAX];
+static CPU_INT32U       NbTravailleurs = 0u;
+static CPU_INT32U       Capacite = 0u;
+static CPU_INT32U       NbEntrees = 0u;
+static CPU_INT32U       NbEntreesMax = 0u;
+
+
+static void pool_liste_ajouter(POOL_TRAVAILLEUR* t, CPU_INT32U seau) {
+	t->prets[(t->tete + t->nb) % POOL_NB_SEAUX] = (CPU_INT16U)seau;
+	t->nb++;
+}
+
+static CPU_INT32U pool_liste_retirer_tete(POOL_TRAVAILLEUR* t) {
+	CPU_INT32U seau;
+
+	if (t->nb == 0u)
+		return POOL_AUCUN;
+
+	seau = t->prets[t->tete];
+	t->tete = (t->tete + 1u) % POOL_NB_SEAUX;
+	t->nb--;
+	return seau;
+}
+
+static CPU_INT32U pool_liste_retirer_queue(POOL_TRAVAILLEUR* t) {
+	if (t->nb == 0u)
+		return POOL_AUCUN;
+
+	t->nb--;
+	return t->prets[(t->tete + t->nb) % POOL_NB_SEAUX];
+}
+
+// Prend le dernier seau prêt du travailleur le plus chargé, qui devient la propriété du voleur
+static CPU_INT32U pool_voler(CPU_INT32U voleur) {
+	CPU_INT32U victime = POOL_AUCUN;
+	CPU_INT32U plus_long = 0u;
+	CPU_INT32U i, seau;
+
+	for (i = 0u; i < NbTravailleurs; i++) {
+		if (i != voleur && Travailleurs[i].nb > plus_long) {
+			plus_long = Travailleurs[i].nb;
+			victime = i;
+		}
+	}
+	if (victime == POOL_AUCUN)
+		return POOL_AUCUN;
+
+	seau = pool_liste_retirer_queue(&Travailleurs[victime]);
+	Seaux[seau].proprio = (CPU_INT08U)voleur;
+	Travailleurs[voleur].nb_vols++;
+	return seau;
+}
+
+
+/*
+ *********************************************************************************************************
+ *											  pool_init
+ *  - nb_travailleurs tâches appelleront pool_prendre(0) à pool_prendre(nb_travailleurs - 1)
+ *  - capacite borne le nombre total de paquets en attente (équivalent de la fifo d'entrée)
+ *  - À appeler après OSInit() et avant la création des tâches
+ *********************************************************************************************************
+ */
+POOL_ERR pool_init(CPU_INT32U nb_travailleurs, CPU_INT32U capacite) {
+	OS_ERR err;
+	CPU_INT32U i;
+
+	if (nb_travailleurs == 0u || nb_travailleurs > POOL_NB_TRAVAILLEURS_MAX || capacite == 0u)
+		return POOL_ERR_ARG;
+
+	NbTravailleurs = nb_travailleurs;
+	Capacite = capacite;
+	NbEntrees = 0u;
+	NbEntreesMax = 0u;
+
+	for (i = 0u; i < POOL_NB_SEAUX; i++) {
+		Seaux[i].tete = 0u;
+		Seaux[i].nb = 0u;
+		Seaux[i].etat = SEAU_LIBRE;
+		Seaux[i].proprio = (CPU_INT08U)(i % nb_travailleurs);
+	}
+	for (i = 0u; i < nb_travailleurs; i++) {
+		OSSemCreate(&Travailleurs[i].sem, "PoolSem", 0, &err);
+		Travailleurs[i].tete = 0u;
+		Travailleurs[i].nb = 0u;
+		Travailleurs[i].courant = POOL_AUCUN;
+		Travailleurs[i].quantum = 0u;
+		Travailleurs[i].inactif = DEF_NO;
+		Travailleurs[i].nb_vols = 0u;
+	}
+	return POOL_OK;
+}
+
+CPU_INT32U pool_hacher_flux(CPU_INT32U src, CPU_INT32U dst) {
+	CPU_INT32U h = (src * 0x9E3779B1u) ^ dst;
+
+	h ^= h >> 16;
+	h *= 0x85EBCA6Bu;
+	h ^= h >> 13;
+	return h;
+}
+
+/*
+ *********************************************************************************************************
+ *											  pool_soumettre
+ *  - Dépose msg dans le seau du flux et réveille son propriétaire
+ *  - Si le propriétaire est déjà occupé, un travailleur inactif est aussi réveillé pour qu'il vole
+ *********************************************************************************************************
+ */
+POOL_ERR pool_soumettre(void* msg, CPU_INT32U flux) {
+	POOL_SEAU* s = &Seaux[flux & (POOL_NB_SEAUX - 1u)];
+	CPU_INT32U proprio = POOL_AUCUN;
+	CPU_INT32U aide = POOL_AUCUN;
+	CPU_INT32U i;
+	OS_ERR err;
+	CPU_SR_ALLOC();
+
+	CPU_CRITICAL_ENTER();
+	if (NbEntrees >= Capacite || s->nb >= POOL_CAPACITE_SEAU) {
+		CPU_CRITICAL_EXIT();
+		return POOL_ERR_PLEIN;
+	}
+	s->msgs[(s->tete + s->nb) % POOL_CAPACITE_SEAU] = msg;
+	s->nb++;
+	if (++NbEntrees > NbEntreesMax)
+		NbEntreesMax = NbEntrees;
+
+	if (s->etat == SEAU_LIBRE) {
+		s->etat = SEAU_PRET;
+		proprio = s->proprio;
+		pool_liste_ajouter(&Travailleurs[proprio], (CPU_INT32U)(s - Seaux));
+		if (Travailleurs[proprio].inactif == DEF_NO) {
+			for (i = 0u; i < NbTravailleurs; i++) {
+				if (Travailleurs[i].inactif == DEF_YES) {
+					Travailleurs[i].inactif = DEF_NO;		// Un seul réveil par inactif
+					aide = i;
+					break;
+				}
+			}
+		}
+	}
+	CPU_CRITICAL_EXIT();
+
+	if (proprio != POOL_AUCUN)
+		OSSemPost(&Travailleurs[proprio].sem, OS_OPT_POST_1 | OS_OPT_POST_NO_SCHED, &err);
+	if (aide != POOL_AUCUN)
+		OSSemPost(&Travailleurs[aide].sem, OS_OPT_POST_1 | OS_OPT_POST_NO_SCHED, &err);
+
+	return POOL_OK;
+}
+
+/*
+ *********************************************************************************************************
+ *											  pool_prendre
+ *  - Retourne le prochain message pour le travailleur, en bloquant s'il n'y a rien à faire.
+ *  - Le seau courant est conservé jusqu'à POOL_QUANTUM messages : l'appel suivant signifie que le
+ *    message précédent est traité, ce qui garantit l'ordre à l'intérieur d'un flux.
+ *********************************************************************************************************
+ */
+void* pool_prendre(CPU_INT32U travailleur) {
+	POOL_TRAVAILLEUR* t = &Travailleurs[travailleur];
+	POOL_SEAU* s;
+	CPU_INT32U seau;
+	void* msg;
+	CPU_TS ts;
+	OS_ERR err;
+	CPU_SR_ALLOC();
+
+	while (DEF_TRUE) {
+		CPU_CRITICAL_ENTER();
+		if (t->courant != POOL_AUCUN) {
+			s = &Seaux[t->courant];
+			if (s->nb > 0u && t->quantum > 0u) {
+				msg = s->msgs[s->tete];
+				s->tete = (CPU_INT16U)((s->tete + 1u) % POOL_CAPACITE_SEAU);
+				s->nb--;
+				t->quantum--;
+				NbEntrees--;
+				CPU_CRITICAL_EXIT();
+				return msg;
+			}
+			// Quantum épuisé ou seau vide : on le remet en fin de liste ou on le libère
+			if (s->nb > 0u) {
+				s->etat = SEAU_PRET;
+				pool_liste_ajouter(t, t->courant);
+			}
+			else {
+				s->etat = SEAU_LIBRE;
+			}
+			t->courant = POOL_AUCUN;
+		}
+
+		seau = pool_liste_retirer_tete(t);
+		if (seau == POOL_AUCUN)
+			seau = pool_voler(travailleur);
+
+		if (seau != POOL_AUCUN) {
+			Seaux[seau].etat = SEAU_EN_COURS;
+			t->courant = seau;
+			t->quantum = POOL_QUANTUM;
+			t->inactif = DEF_NO;
+			CPU_CRITICAL_EXIT();
+			continue;
+		}
+
+		t->inactif = DEF_YES;
+		CPU_CRITICAL_EXIT();
+		OSSemPend(&t->sem, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
+	}
+}
+
+/*
+ *********************************************************************************************************
+ *											  pool_prendre_lot
+ *  - Comme pool_prendre, mais retire jusqu'à max messages d'un coup, tous du même seau (donc au
+ *    plus POOL_QUANTUM) ; bloque s'il n'y a rien à faire et retourne le nombre de messages
+ *  - L'appel suivant signifie que tout le lot est traité
+ *********************************************************************************************************
+ */
+CPU_INT32U pool_prendre_lot(CPU_INT32U travailleur, void** lot, CPU_INT32U max) {
+	POOL_TRAVAILLEUR* t = &Travailleurs[travailleur];
+	POOL_SEAU* s;
+	CPU_INT32U n;
+	CPU_SR_ALLOC();
+
+	if (max == 0u)
+		return 0u;
+
+	// pool_prendre laisse le seau du message en traitement chez le travailleur : personne ne le vole
+	lot[0] = pool_prendre(travailleur);
+	n = 1u;
+
+	CPU_CRITICAL_ENTER();
+	s = &Seaux[t->courant];
+	while (n < max && s->nb > 0u && t->quantum > 0u) {
+		lot[n++] = s->msgs[s->tete];
+		s->tete = (CPU_INT16U)((s->tete + 1u) % POOL_CAPACITE_SEAU);
+		s->nb--;
+		t->quantum--;
+		NbEntrees--;
+	}
+	CPU_CRITICAL_EXIT();
+
+	return n;
+}
+
+CPU_INT32U pool_nb_entrees(void) {
+	return NbEntrees;
+}
+
+CPU_INT32U pool_nb_entrees_max(void) {
+	return NbEntreesMax;
+}
+
+CPU_INT32U pool_nb_vols(CPU_INT32U travailleur) {
+	if (travailleur >= NbTravailleurs)
+		return 0u;
+
+	return Travailleurs[travailleur].nb_vols;
+}
@@ -0,0 +1,39 @@
+/*
+ * routeur_pool.h
+ *
+ *  Répartition des paquets entre plusieurs tâches de traitement (TaskComputing) en préservant
+ *  l'ordre à l'intérieur d'un flux.
+ *
+ *  Chaque flux (hachage de src et dst) tombe dans un seau. Un seau n'est traité que par un seul
+ *  travailleur à la fois et appartient à celui qui l'a traité en dernier. Un travailleur sans
+ *  travail vole un seau entier en attente chez le travailleur le plus chargé ; les paquets déjà
+ *  dans ce seau partent avec lui, l'ordre du flux est donc conservé.
+ */
+
+#ifndef SRC_ROUTEUR_POOL_H_
+#define SRC_ROUTEUR_POOL_H_
+
+#include <os.h>
+
+#define POOL_NB_TRAVAILLEURS_MAX	16u
+#define POOL_NB_SEAUX				256u			// Puissance de 2
+#define POOL_CAPACITE_SEAU			64u				// Paquets en attente par seau
+#define POOL_QUANTUM				8u				// Paquets d'un seau traités avant de passer au suivant
+
+typedef enum {
+	POOL_OK = 0,
+	POOL_ERR_PLEIN = -1,							// Capacité globale ou capacité du seau atteinte
+	POOL_ERR_ARG = -2
+} POOL_ERR;
+
+POOL_ERR   pool_init(CPU_INT32U nb_travailleurs, CPU_INT32U capacite);
+CPU_INT32U pool_hacher_flux(CPU_INT32U src, CPU_INT32U dst);
+POOL_ERR   pool_soumettre(void* msg, CPU_INT32U flux);
+void*      pool_prendre(CPU_INT32U travailleur);
+CPU_INT32U pool_prendre_lot(CPU_INT32U travailleur, void** lot, CPU_INT32U max);
+
+CPU_INT32U pool_nb_entrees(void);
+CPU_INT32U pool_nb_entrees_max(void);
+CPU_INT32U pool_nb_vols(CPU_INT32U travailleur);
+
+#endif /* SRC_ROUTEUR_POOL_H_ */
@@ -0,0 +1,35 @@
+/*
+*********************************************************************************************************
+*                                                 uC/OS-III
+*                                          The Real-Time Kernel
+*                                               PORT Windows
+*
+*
+*                                  Polytechnique Montreal, Qc, CANADA
+*
+* File : routeur_simd.c
+*
+*********************************************************************************************************
+*/
+
+#include "routeur_simd.h"
+
+SIMD_CAPACITES Simd;
+
+/*
+ *********************************************************************************************************
+ *											  simd_init
+ *  - Remplit Simd à partir des extensions détectées par Mem_Init() (qui doit avoir été appelé).
+ *    Tout à DEF_NO hors x86 ou sans LIB_MEM_CFG_SIMD_EN.
+ *********************************************************************************************************
+ */
+void simd_init(void) {
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED) && SIMD_X86
+	CPU_INT32U feat = Mem_SIMD_FeatGet();
+
+	Simd.sse42 = DEF_BIT_IS_SET(feat, LIB_MEM_SIMD_FEAT_SSE42);
+	Simd.avx2  = DEF_BIT_IS_SET(feat, LIB_MEM_SIMD_FEAT_AVX2);
+#else
+	Simd.sse42 = Simd.avx2 = DEF_NO;
+#endif
+}
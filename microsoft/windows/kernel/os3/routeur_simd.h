@@ -0,0 +1,39 @@
+/*
+ * routeur_simd.h
+ *
+ *  Extensions SIMD du processeur hôte utilisées par le routeur, reprises de la détection de lib_mem
+ *  (Mem_SIMD_FeatGet) pour qu'une seule routine interroge CPUID. Sans LIB_MEM_CFG_SIMD_EN, aucune
+ *  extension n'est déclarée et le routeur garde ses versions portables.
+ *  Les modules du routeur choisissent leur implémentation une seule fois à leur initialisation.
+ */
+
+#ifndef SRC_ROUTEUR_SIMD_H_
+#define SRC_ROUTEUR_SIMD_H_
+
+#include <cpu.h>
+#include <lib_def.h>
+#include <lib_mem.h>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define SIMD_X86	1
+#else
+#define SIMD_X86	0
+#endif
+
+// Permet de compiler une fonction AVX2/SSE4 sans imposer /arch ou -m au reste du projet
+#if defined(__GNUC__) && SIMD_X86
+#define SIMD_CIBLE(ext)		__attribute__((target(ext)))
+#else
+#define SIMD_CIBLE(ext)
+#endif
+
+typedef struct {
+	CPU_BOOLEAN sse42;								// Instruction CRC32 (routeur_crc.c)
+	CPU_BOOLEAN avx2;								// Filtre des sources par lots (routeur_filtre.c)
+} SIMD_CAPACITES;
+
+extern SIMD_CAPACITES Simd;
+
+void simd_init(void);
+
+#endif /* SRC_ROUTEUR_SIMD_H_ */
@@ -22,8 +22,12 @@
 #include  <os.h>
 #include  "os_app_hooks.h"
 #include  "app_cfg.h"
+#include  "routeur_banc.h"
+#include  <bsp_int.h>
+#include  <string.h>
 
-// À utiliser pour suivre le remplissage et le vidage des fifos
+// Réservé aux messages rares : les traces de remplissage et de vidage des fifos passent par le
+// journal asynchrone (journal_ecrire, routeur_journal.c), qui ne bloque pas le pipeline
 // Mettre en commentaire et utiliser la fonction vide suivante si vous ne voulez pas de trace
 #define safeprintf(fmt, ...)															\
 {																						\
@@ -38,13 +42,51 @@
 
 
 
+// Segment du slab des paquets (SlabPaquets)
+static CPU_INT08U MemPaquets[TAILLE_SEG_PAQUETS];
+
+// Textes des messages du journal, dans l'ordre de JOURNAL_MSG (routeur.h)
+static const char* const FormatsJournal[NB_JNL] = {
+	"Nb de paquets dans le fifo d'entrée - apres production de TaskGenenerate: %u \n",
+	"GENERATE: %u paquets rejetes a l'entree car la FIFO est pleine !\n",
+	"Nb de paquets dans le fifo d'entrée - apres consommation de TaskComputing %d: %u \n",
+	"\n--TaskComputing: CRC invalide (Paquet rejete) (%llu pour cette tache)\n",
+	"\n--TaskComputing: Source invalide (Paquet rejete) (%llu pour cette tache)\n\n--Il s agit du paquet\n	** src : %x \n	** dst : %x \n",
+	"Nb de paquets dans la queue de haute priorité - apres production de TaskComputing: %d \n",
+	"Nb de paquets dans la queue de moyenne priorité - apres production de TaskComputing: %d \n",
+	"Nb de paquets dans la queue de faible priorité - apres production de TaskComputing: %d \n",
+	"TaskComputing : QFULL.\n",
+	"\n--AQM : paquet de classe %d jete (total pour la file : %u)\n",
+	"Nb de paquets dans la queue de haute priorité - apres consommation de TaskFowarding: %d \n",
+	"Nb de paquets dans la queue de moyenne priorité - apres consommation de TaskFowarding: %d \n",
+	"Nb de paquets dans la queue de faible priorité - apres consommation de TaskFowarding: %d \n",
+	"\n--TaskForwarding: paquets %d envoyes\n\n",
+	"\n--Paquet dans Output Port no %d\n",
+	"\n--Paquet BC dans Output Port no 0 à %d\n",
+	"\n--TaskForwarding: Aucune route pour %x\n",
+	"\n--TaskForwarding: Erreur mailbox full\n",
+	"\nPaquet recu en %d \n    >> src : %x \n    >> dst : %x \n    >> type : %d \n"
+};
+
+
 ///////////////////////////////////////////////////////////////////////////////////////
 //								Routines d'interruptions
 ///////////////////////////////////////////////////////////////////////////////////////
 
+#define INT_ENTREE		0u		// Ligne du contrôleur d'interruptions virtuel (bsp_int.c)
+
 /*
-À venir dans la partie 2
-*/
+ *********************************************************************************************************
+ *                                              entree_isr
+ *  -Signale l'arrivée de paquets à TaskGenerate lorsque APP_CFG_INT_ENTREE_EN vaut DEF_ENABLED
+ *  -Appelée par le contrôleur entre OSIntEnter() et OSIntExit() : aucun appel bloquant, aucun printf
+ *********************************************************************************************************
+ */
+void entree_isr(void) {
+	OS_ERR err;
+
+	OSTaskSemPost(&TaskGenerateTCB, OS_OPT_POST_NONE, &err);
+}
 
 
 
@@ -65,24 +107,55 @@ int main(void)
 	CPU_Init();                                                 // Initialize the uC/CPU services                       
 
 	OSInit(&os_err);
+	App_OS_SetAllHooks();                                       // Le crochet du tick entretient CPU_TS_Get64()
+
+	// Sans contrôleur d'interruptions, TaskGenerate ne serait jamais réveillée : on s'arrête
+	if (create_application() != 0)
+		return 1;
 
-	create_application();
+#if (APP_CFG_BANC_ESSAI_EN == DEF_ENABLED)
+	banc_essai();
+#endif
 
 	OSStart(&os_err);
 
 	return 0;
 }
 
-void create_application() {
+int create_application() {
 	int error;
 
+	compteurs_init();
+	simd_init();
+	crc_init();
+
 	error = create_events();
 	if (error != 0)
 		printf("Error %d while creating events\n", error);
 
+	create_routes();
+	create_filtre();
+	create_ordo();
+	create_aqm();
+	create_mode();
+
 	error = create_tasks();
 	if (error != 0)
 		printf("Error %d while creating tasks\n", error);
+
+#if (APP_CFG_INT_ENTREE_EN == DEF_ENABLED)
+	// Les occurrences levées avant OSStart() restent en attente dans le contrôleur
+	if (BSP_IntInit() != DEF_OK) {
+		printf("Erreur a l'initialisation du controleur d'interruptions\n");
+		return -1;
+	}
+	BSP_IntVectSet(INT_ENTREE, entree_isr);
+	BSP_IntPrioSet(INT_ENTREE, 0u);
+	BSP_IntEn(INT_ENTREE);
+	BSP_IntSrcTmrSet(INT_ENTREE, APP_CFG_INT_ENTREE_HZ);
+#endif
+
+	return 0;
 }
 
 int create_tasks() {
@@ -91,36 +164,40 @@ int create_tasks() {
 	for (i = 0; i < NB_OUTPUT_PORTS; i++)
 	{
 		Port[i].id = i;
-		switch (i)
-		{
-		case 0:
-			Port[i].name = "Port 0";
-			break;
-		case 1:
-			Port[i].name = "Port 1";
-			break;
-		case 2:
-			Port[i].name = "Port 2";
-			break;
-		default:
-			break;
-		};
+		snprintf(Port[i].name, sizeof(Port[i].name), "Port %d", i);
+		jetons_init(&Jetons[i], DEBIT_PORT, RAFALE_PORT, 0);
+	}
+	for (i = 0; i < NB_COMPUTING_TASKS; i++)
+	{
+		Computing[i].id = i;
+		snprintf(Computing[i].name, sizeof(Computing[i].name), (ModeRouteur == MODE_RTC) ? "TaskRTC %d" : "TaskComputing %d", i);
 	}
 
-	// Creation des taches
+	// Les tâches TaskComputing partagent la même priorité et font de l'attente active : sans
+	// tourniquet, une seule d'entre elles aurait le processeur jusqu'à ce qu'elle bloque
 	OS_ERR err;
+	OSSchedRoundRobinCfg(DEF_ENABLED, 1, &err);
 
+	// Creation des taches
 	OSTaskCreate(&TaskGenerateTCB, "TaskGenerate", TaskGenerate, (void*)0, TaskGeneratePRIO, &TaskGenerateSTK[0u], TASK_STK_SIZE / 2, TASK_STK_SIZE, 1, 0, (void*)0, (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), &err);
 
-	OSTaskCreate(&TaskComputingTCB, "TaskComputing", TaskComputing, (void*)0, TaskComputingPRIO, &TaskComputingSTK[0u], TASK_STK_SIZE / 2, TASK_STK_SIZE, 1024, 0, (void*)0, (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), &err);
+	// Les paquets arrivent par le pool (routeur_pool.c), pas par la file de la tâche.
+	// En run-to-completion, les mêmes tâches font aussi le travail de TaskForwarding, qui n'est pas créée.
+	for (i = 0; i < NB_COMPUTING_TASKS; i++) {
+		OSTaskCreate(&TaskComputingTCB[i], Computing[i].name, (ModeRouteur == MODE_RTC) ? TaskRunToCompletion : TaskComputing, &Computing[i], TaskComputingPRIO, &TaskComputingSTK[i][0u], TASK_STK_SIZE / 2, TASK_STK_SIZE, 1, 0, (void*)0, (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), &err);
+	}
 
-	OSTaskCreate(&TaskForwardingTCB, "TaskForwarding", TaskForwarding, (void*)0, TaskForwardingPRIO, &TaskForwardingSTK[0u], TASK_STK_SIZE / 2, TASK_STK_SIZE, 1, 0, (void*)0, (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), &err);
+	if (ModeRouteur == MODE_PIPELINE)
+		OSTaskCreate(&TaskForwardingTCB, "TaskForwarding", TaskForwarding, (void*)0, TaskForwardingPRIO, &TaskForwardingSTK[0u], TASK_STK_SIZE / 2, TASK_STK_SIZE, 1, 0, (void*)0, (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), &err);
 
 	// Pour éviter d'avoir 3 fois le même code on a un tableau pour lequel chaque entrée appel TaskOutputPort avec des paramètres différents
 	for (i = 0; i < NB_OUTPUT_PORTS; i++) {
-		OSTaskCreate(&TaskOutputPortTCB[i], "OutputPort", TaskOutputPort, &Port[i], TaskOutputPortPRIO, &TaskOutputPortSTK[i][0u], TASK_STK_SIZE / 2, TASK_STK_SIZE, 1, 0, (void*)0, (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), &err);
+		OSTaskCreate(&TaskOutputPortTCB[i], "OutputPort", TaskOutputPort, &Port[i], TaskOutputPortPRIO, &TaskOutputPortSTK[i][0u], TASK_STK_SIZE / 2, TASK_STK_SIZE, TAILLE_FILE_PORT, 0, (void*)0, (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), &err);
+		OSTaskQCoalesceSet(&TaskOutputPortTCB[i], LOT_REVEIL_PORT, ATTENTE_REVEIL_PORT, &err);
 	};
 
+	OSTaskCreate(&TaskJournalTCB, "TaskJournal", journal_tache, (void*)0, TaskJournalPRIO, &TaskJournalSTK[0u], TASK_STK_SIZE / 2, TASK_STK_SIZE, 1, 0, (void*)0, (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), &err);
+
 	OSTaskCreate(&TaskStatsTCB, "TaskStats", TaskStats, (void*)0, TaskStatsPRIO, &TaskStatsSTK[0u], TASK_STK_SIZE / 2, TASK_STK_SIZE, 1, 0, (void*)0, (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR), &err);
 
 	return 0;
@@ -128,33 +205,196 @@ int create_tasks() {
 
 int create_events() {
 	OS_ERR err;
+	LIB_ERR lerr;
 	int i;
 
 	// Creation des semaphores
-	// Pas de sémaphore pour la partie 1
+	OSSemCreate(&semForwarding, "semForwarding", 0, &err);
 
 	// Creation des mutex
-	OSMutexCreate(&mutRejete, "mutRejete", &err);
 	OSMutexCreate(&mutPrint, "mutPrint", &err);
-	OSMutexCreate(&mutAlloc, "mutAlloc", &err);
+	OSMutexCreate(&mutOrdo, "mutOrdo", &err);
+
+	// Les tâches du pipeline journalisent sans attendre la console
+	journal_init(FormatsJournal, NB_JNL, &mutPrint);
 
 	// Creation des files externes  - vous pourrez diminuer au besoin la longueur des files
 	OSQCreate(&lowQ, "lowQ", 1024, &err);
 	OSQCreate(&mediumQ, "mediumQ", 1024, &err);
 	OSQCreate(&highQ, "highQ", 1024, &err);
 
+	// Fifo d'entrée répartie entre les tâches TaskComputing
+	if (pool_init(NB_COMPUTING_TASKS, TAILLE_FIFO_ENTREE) != POOL_OK)
+		return -1;
+
+	// Slab des paquets et une cache par tranche
+	Mem_SegCreate("Paquets", &SegPaquets, (CPU_ADDR)&MemPaquets[0], sizeof(MemPaquets), LIB_MEM_PADDING_ALIGN_NONE, &lerr);
+	if (lerr != LIB_MEM_ERR_NONE)
+		return -2;
+	Mem_SlabCreate("Paquets", &SlabPaquets, &SegPaquets, &lerr);
+	if (lerr != LIB_MEM_ERR_NONE)
+		return -2;
+	for (i = 0; i < NB_SHARDS; i++)
+		Mem_SlabCacheInit(&CachePaquets[i], &SlabPaquets, &lerr);
+
 	return 0;
 }
 
 
+/*
+ *********************************************************************************************************
+ *											  create_routes
+ *  - Charge la table de routage depuis TABLE_FICHIER_ROUTES s'il existe.
+ *  - Sinon, ou si le fichier est refusé, reproduit les quatre plages d'origine (INT1 à INT3 et diffusion).
+ *********************************************************************************************************
+ */
+void create_routes() {
+	static const ROUTE RoutesDefaut[] = {
+		{ INT1_LOW,   2, 0 },
+		{ INT2_LOW,   2, 1 },
+		{ INT3_LOW,   2, 2 },
+		{ INT_BC_LOW, 2, ROUTE_DIFFUSION }
+	};
+	TABLE_ERR err;
+	CPU_INT32U ligne;
+
+	table_init();
+
+	err = table_charger_fichier(TABLE_FICHIER_ROUTES, NB_OUTPUT_PORTS, &ligne);
+	if (err != TABLE_OK) {
+		// Un fichier absent est normal ; un fichier refusé est signalé avec la ligne fautive
+		if (err != TABLE_ERR_FICHIER)
+			printf("%s refuse (erreur %d, ligne %u) : table par defaut\n", TABLE_FICHIER_ROUTES, err, ligne);
+		err = table_construire(RoutesDefaut, ARRAY_SIZE(RoutesDefaut));
+	}
+
+	if (err != TABLE_OK)
+		printf("Error %d while creating routes\n", err);
+	else
+		printf("Table de routage : %u routes\n", table_nb_routes());
+}
+
+/*
+ *********************************************************************************************************
+ *											  create_filtre
+ *  - Compile les quatre plages de sources rejetées (REJECT_LOWx à REJECT_HIGHx, bornes exclues)
+ *********************************************************************************************************
+ */
+void create_filtre() {
+	static const FILTRE_REGLE RejetsDefaut[] = {
+		{ REJECT_LOW1 + 1, REJECT_HIGH1 - 1 },
+		{ REJECT_LOW2 + 1, REJECT_HIGH2 - 1 },
+		{ REJECT_LOW3 + 1, REJECT_HIGH3 - 1 },
+		{ REJECT_LOW4 + 1, REJECT_HIGH4 - 1 }
+	};
+
+	if (filtre_compiler(RejetsDefaut, ARRAY_SIZE(RejetsDefaut)) != FILTRE_OK)
+		printf("Error while compiling the source filter\n");
+	else
+		printf("Filtre de sources : %u regles (%s)\n", filtre_nb_regles(), filtre_implementation());
+}
+
+/*
+ *********************************************************************************************************
+ *											  create_ordo
+ *  - Parts de bande passante de TaskForwarding : vidéo 50 %, audio 30 %, autre 20 %.
+ *    Les mêmes valeurs servent de quanta en octets (DRR) ou de poids (WFQ).
+ *********************************************************************************************************
+ */
+void create_ordo() {
+	static const CPU_INT32U Parts[NB_PACKET_TYPE] = {
+		5 * sizeof(Packet),							// PACKET_VIDEO -> highQ
+		3 * sizeof(Packet),							// PACKET_AUDIO -> mediumQ
+		2 * sizeof(Packet)							// PACKET_AUTRE -> lowQ
+	};
+
+	if (ordo_init(ORDO_POLITIQUE_FORWARDING, Parts, NB_PACKET_TYPE) != ORDO_OK)
+		printf("Error while configuring the class scheduler\n");
+	else
+		printf("Ordonnanceur de TaskForwarding : %s\n", ordo_nom());
+}
+
+
+/*
+ *********************************************************************************************************
+ *											  create_aqm
+ *  - Même configuration pour les trois files de classe ; les seuils de RED sont en paquets, à
+ *    comparer aux TAILLE_FIFO_ENTREE entrées de chaque file
+ *********************************************************************************************************
+ */
+void create_aqm() {
+	static const AQM_CONFIG Config = {
+		AQM_POLITIQUE_FILES,
+		DEF_NO,										// Pas de marquage ECN : les paquets sont jetés
+		64, 256, 6554, 9,							// RED : seuils, probabilité max (10 %), poids 1/512
+		5000, 100000								// CoDel : cible 5 ms, intervalle 100 ms
+	};
+	int i;
+
+	for (i = 0; i < NB_PACKET_TYPE; i++)
+		aqm_init(&Aqm[i], &Config);
+	printf("Gestion active des files de classe : %s\n", aqm_nom(&Aqm[0]));
+	if (POST_BLOQUANT_EN == DEF_ENABLED)
+		printf("Depot dans les files pleines : bloquant (%d ticks max)\n", ATTENTE_POST_MAX);
+	else
+		printf("Depot dans les files pleines : rejet immediat\n");
+}
+
+/*
+ *********************************************************************************************************
+ *											  create_mode
+ *  - Pipeline ou run-to-completion (voir MODE_ROUTEUR_DEFAUT) ; à appeler avant create_tasks
+ *  - La variable d'environnement ROUTEUR_MODE permet de comparer les deux modes sans recompiler
+ *********************************************************************************************************
+ */
+void create_mode() {
+	const char* choix = getenv("ROUTEUR_MODE");
+
+	ModeRouteur = MODE_ROUTEUR_DEFAUT;
+	if (choix != NULL) {
+		if (strcmp(choix, "rtc") == 0)
+			ModeRouteur = MODE_RTC;
+		else if (strcmp(choix, "pipeline") == 0)
+			ModeRouteur = MODE_PIPELINE;
+		else
+			printf("ROUTEUR_MODE inconnu : %s (pipeline ou rtc)\n", choix);
+	}
+
+	if (ModeRouteur == MODE_RTC)
+		printf("Mode d'execution : %s (%d taches, lots de %d paquets)\n", mode_nom(), NB_COMPUTING_TASKS, LOT_RTC);
+	else
+		printf("Mode d'execution : %s\n", mode_nom());
+}
+
+const char* mode_nom() {
+	return (ModeRouteur == MODE_RTC) ? "run-to-completion" : "pipeline";
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////////////
 //									TASKS
 ///////////////////////////////////////////////////////////////////////////////////////
 
+/*
+ *********************************************************************************************************
+ *											  Flux de trafic
+ *  - Un TaskGenerate émet pour tous les flux ; chaque flux a son modèle d'arrivée et sa graine.
+ *  - Le flux par défaut reproduit l'ancien générateur : silences de 2 s puis rafales de 1 à 255
+ *    paquets, un par tick, classes et destinations uniformes. Exemples de saturation :
+ *      { TRAFIC_POISSON, 7, 8.0, 0, 0, 0, 0, { 1, 1, 1 }, NULL, 0 }
+ *      { TRAFIC_PARETO,  9, 4.0, 1.5, 0, 0, 0, { 2, 1, 1 }, NULL, 0 }
+ *********************************************************************************************************
+ */
+static const TRAFIC_CONFIG TraficConfig[] = {
+	{ TRAFIC_ON_OFF, 42, 1.0, 0.0, 1, 255, 200, { 1, 1, 1 }, NULL, 0 }
+};
+
 /*
  *********************************************************************************************************
  *											  TaskGeneratePacket
  *  - Génère des paquets et les envoie dans le fifo d'entrée.
+ *  - Se réveille à chaque tick et émet d'un coup les paquets échus de chaque flux (au plus
+ *    GENERATE_LOT_MAX par flux) : une allocation, un calcul de CRC par lot.
  *  - À des fins de développement de votre application, vous pouvez *temporairement* modifier la variable
  *    "shouldSlowthingsDown" à true pour ne générer que quelques paquets par seconde, et ainsi pouvoir
  *    déboguer le flot de vos paquets de manière plus saine d'esprit. Cependant, la correction sera effectuée
@@ -162,70 +402,96 @@ int create_events() {
  *********************************************************************************************************
  */
 void TaskGenerate(void* data) {
-	srand(42);
 	OS_ERR err, perr;
 	CPU_TS ts;
-	bool isGenPhase = false; 		//Indique si on est dans la phase de generation ou non
 	const bool shouldSlowThingsDown = false;		//Variable à modifier
-	int packGenQty = (rand() % 250);
+	int nbPacketCrees = 0;
+	static TRAFIC_FLUX flux[ARRAY_SIZE(TraficConfig)];
+	CPU_BOOLEAN actif[ARRAY_SIZE(TraficConfig)];
+	Packet* lot[GENERATE_LOT_MAX];
+	CPU_INT32U f, i, n, nbRejets;
+	OS_TICK maintenant;
+	CPU_TS tsCreation;
+
+	maintenant = OSTimeGet(&err);
+	for (f = 0; f < ARRAY_SIZE(TraficConfig); f++) {
+		actif[f] = (trafic_init(&flux[f], &TraficConfig[f], maintenant) == TRAFIC_OK) ? DEF_YES : DEF_NO;
+		if (!actif[f])
+			safeprintf("GENERATE: configuration invalide pour le flux %u, flux desactive\n", f);
+	}
+
 	while (true) {
-		if (isGenPhase) {
-			OSMutexPend(&mutAlloc, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
-			Packet* packet = malloc(sizeof(Packet));
-			OSMutexPost(&mutAlloc, OS_OPT_POST_NONE, &err);
-
-			packet->src = rand() * (UINT32_MAX / RAND_MAX);
-			packet->dst = rand() * (UINT32_MAX / RAND_MAX);
-			packet->type = rand() % NB_PACKET_TYPE;
-
-			for (int i = 0; i < ARRAY_SIZE(packet->data); ++i)
-				packet->data[i] = (unsigned int)rand();
-			packet->data[0] = nbPacketCrees;
-
-			nbPacketCrees++;
-			OSMutexPend(&mutPrint, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
-			//if (shouldSlowThingsDown) {
-			printf("GENERATE : ********Generation du Paquet # %d ******** \n", nbPacketCrees);
-			printf("ADD %x \n", packet);
-			printf("	** src : %x \n", packet->src);
-			printf("	** dst : %x \n", packet->dst);
-			printf("	** type : %d \n", packet->type);
-			OSMutexPost(&mutPrint, OS_OPT_POST_NONE, &err);
-
-			//}
-
-			OSTaskQPost(&TaskComputingTCB, packet, sizeof(packet), OS_OPT_POST_FIFO + OS_OPT_POST_NO_SCHED, &err);
-
-			safeprintf("Nb de paquets dans le fifo d'entrée - apres production de TaskGenenerate: %d \n", TaskComputingTCB.MsgQ.NbrEntries);
-
-			if (err == OS_ERR_Q_MAX || err== OS_ERR_MSG_POOL_EMPTY) {
-
-				OSMutexPend(&mutAlloc, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
-				safeprintf("GENERATE: Paquet rejete a l'entree car la FIFO est pleine !\n");
-				free(packet);
-				OSMutexPost(&mutAlloc, OS_OPT_POST_NONE, &err);
-				packet_rejete_fifo_pleine_inputQ++;
+		maintenant = OSTimeGet(&err);
+
+		for (f = 0; f < ARRAY_SIZE(TraficConfig); f++) {
+			if (!actif[f])
+				continue;
+
+			n = trafic_nb_arrivees(&flux[f], maintenant, shouldSlowThingsDown ? 1 : GENERATE_LOT_MAX);
+			if (n == 0)
+				continue;
+
+			// Slab épuisé : le lot s'arrête aux paquets obtenus
+			for (i = 0; i < n; i++) {
+				lot[i] = paquet_allouer(SHARD_GENERATE);
+				if (lot[i] == NULL)
+					break;
+			}
+			n = i;
+			if (n == 0)
+				continue;
+
+			// Tout le lot est estampillé au même instant, avant le calcul du CRC qui couvre ts
+			tsCreation = OS_TS_GET();
+			for (i = 0; i < n; i++) {
+				trafic_remplir_paquet(&flux[f], lot[i]);
+				lot[i]->data[0] = nbPacketCrees++;
+				lot[i]->ts = tsCreation;
 			}
+			crc_paquet_calculer_lot(lot, n);
+			compteurs_ajouter(SHARD_GENERATE, CPT_PAQUETS_CREES, n);
 
 			if (shouldSlowThingsDown) {
-				OSTimeDlyHMSM(0, 0, 0, 200 + rand() % 600, OS_OPT_TIME_HMSM_STRICT, &err);
+				OSMutexPend(&mutPrint, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
+				for (i = 0; i < n; i++) {
+					printf("GENERATE : ********Generation du Paquet # %d ******** \n", lot[i]->data[0] + 1);
+					printf("ADD %x \n", lot[i]);
+					printf("	** src : %x \n", lot[i]->src);
+					printf("	** dst : %x \n", lot[i]->dst);
+					printf("	** type : %d \n", lot[i]->type);
+				}
+				OSMutexPost(&mutPrint, OS_OPT_POST_NONE, &err);
 			}
-			else {
-				OSTimeDlyHMSM(0, 0, 0, 1, OS_OPT_TIME_HMSM_STRICT, &err);
 
-				if ((nbPacketCrees % packGenQty) == 0) //On genère jusqu'à 250 paquets par phase de géneration
-				{
-					isGenPhase = false;
-				}
+			// Tous les paquets d'un même flux (src, dst) vont au même seau, donc restent en ordre.
+			// Les paquets refusés sont regroupés en tête du lot pour être libérés ensemble.
+			nbRejets = 0;
+			for (i = 0; i < n; i++) {
+				if (pool_soumettre(lot[i], pool_hacher_flux(lot[i]->src, lot[i]->dst)) != POOL_OK)
+					lot[nbRejets++] = lot[i];
+			}
+
+			journal_ecrire(SHARD_GENERATE, JNL_FIFO_ENTREE_PRODUCTION, pool_nb_entrees());
+
+			if (nbRejets > 0) {
+				journal_ecrire(SHARD_GENERATE, JNL_FIFO_ENTREE_PLEINE, nbRejets);
+				for (i = 0; i < nbRejets; i++)
+					paquet_liberer(lot[i], SHARD_GENERATE);
+				compteurs_ajouter(SHARD_GENERATE, CPT_REJET_FIFO_ENTREE, nbRejets);
 			}
 		}
-		else
-		{
-			OSTimeDlyHMSM(0, 0, 2, 0, OS_OPT_TIME_HMSM_STRICT, &err); // 2 sec
-			isGenPhase = true;
-			do { packGenQty = (rand() % 256); } while (packGenQty == 0); // 255 paquets
 
-			safeprintf("GENERATE: Generation de %d paquets durant les %d prochaines millisecondes\n", packGenQty, packGenQty * 2);
+		if (shouldSlowThingsDown) {
+			OSTimeDlyHMSM(0, 0, 0, 200 + rand() % 600, OS_OPT_TIME_HMSM_STRICT, &err);
+		}
+		else {
+#if (APP_CFG_INT_ENTREE_EN == DEF_ENABLED)
+			// Les interruptions reçues pendant le lot (ou la suspension par TaskStats) sont regroupées
+			OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, &ts, &err);
+			OSTaskSemSet(&TaskGenerateTCB, 0, &err);
+#else
+			OSTimeDly(1, OS_OPT_TIME_DLY, &err);
+#endif
 		}
 	}
 }
@@ -250,56 +516,100 @@ void TaskGenerate(void* data) {
   */
   // Partie 2 (oubliez ça pour l'instant)
 
+/*
+ *********************************************************************************************************
+ *											  simuler_traitement
+ *  -Simule le temps de traitement d'un paquet et le compte dans la tranche shard
+ *********************************************************************************************************
+ */
+static void simuler_traitement(CPU_INT32U shard) {
+	OS_ERR err;
+	OS_TICK actualticks = 0;
+
+	// ****************************************************************** //
+		/* On simule un temps de traitement avec ce compteur bidon.
+		 * Cette boucle devrait prendre entre 2 et 4 ticks d'OS (considérez
+		 * exactement 3 ticks pour la question dans l'énoncé).
+		 */
+		 //		Code de l'attente active à compléter, utilisez la constante WAITFORComputing 
+	actualticks = OSTimeGet(&err);//***
+	while (WAITFORComputing + actualticks > OSTimeGet(&err)) {}//***
+	// ****************************************************************** //
+	compteurs_inc(shard, CPT_PAQUETS_CALCULES);
+}
+
+/*
+ *********************************************************************************************************
+ *											  rejeter_crc / rejeter_source
+ *  -Comptent le paquet non conforme dans la tranche shard, le journalisent et le détruisent
+ *  -Le journal reçoit le compte de la tranche seulement : le total (compteurs_lire) parcourrait toutes
+ *   les tranches à chaque rejet
+ *********************************************************************************************************
+ */
+static void rejeter_crc(Packet* packet, CPU_INT32U shard) {
+	compteurs_inc(shard, CPT_REJET_CRC);
+	journal_ecrire(shard, JNL_CRC_INVALIDE, compteurs_lire_shard(shard, CPT_REJET_CRC));
+	paquet_liberer(packet, shard);
+}
+
+static void rejeter_source(Packet* packet, CPU_INT32U shard) {
+	compteurs_inc(shard, CPT_SOURCE_REJETE);
+	journal_ecrire(shard, JNL_SOURCE_INVALIDE, compteurs_lire_shard(shard, CPT_SOURCE_REJETE), packet->src, packet->dst);
+	paquet_liberer(packet, shard);
+}
+
+/*
+ *********************************************************************************************************
+ *											  verifier_paquet
+ *  -Simule le temps de traitement puis vérifie le CRC et l'adresse source du paquet
+ *  -Un paquet non conforme est compté dans la tranche shard et détruit ; retourne DEF_NO dans ce cas
+ *********************************************************************************************************
+ */
+static CPU_BOOLEAN verifier_paquet(Packet* packet, CPU_INT32U shard) {
+	simuler_traitement(shard);
+
+	//Verification du CRC
+	if (!crc_paquet_verifier(packet)) {
+		rejeter_crc(packet, shard);
+		return DEF_NO;
+	}
+	//Verification de l'espace d'addressage
+	if (filtre_classer(packet->src) != FILTRE_AUCUNE) {
+		rejeter_source(packet, shard);
+		return DEF_NO;
+	}
+	return DEF_YES;
+}
+
   /*
    *********************************************************************************************************
    *											  TaskComputing
    *  -Vérifie si les paquets sont conformes (CRC,Adresse Source)
    *  -Dispatche les paquets dans des files (HIGH,MEDIUM,LOW)
+   *  -NB_COMPUTING_TASKS instances tournent en parallèle ; chacune reçoit ses paquets du pool
    *
    *********************************************************************************************************
    */
 void TaskComputing(void* pdata) {
 	OS_ERR err, perr;
-	CPU_TS ts;
-	OS_MSG_SIZE msg_size;
 	Packet* packet = NULL;
-	OS_TICK actualticks = 0;
+	Info_Port info = *(Info_Port*)pdata;
+	CPU_INT32U shard = SHARD_COMPUTING + info.id;
+	OS_Q* const files[NB_PACKET_TYPE] = { &highQ, &mediumQ, &lowQ };
 	while (true) {
-		//		1) Appel de fonction à compléter, 2) compléter safeprint et 3) compléter err_msg
-		packet = OSTaskQPend(0, OS_OPT_PEND_BLOCKING, &msg_size, &ts, &err);//***
-		safeprintf("Nb de paquets dans le fifo d'entrée - apres consommation de TaskComputing: %d \n", TaskComputingTCB.MsgQ.NbrEntries);//***
-		err_msg("TaskComputing: Erreur sur la recherche du prochain paquet", err); //***
-
-		// ****************************************************************** //
-			/* On simule un temps de traitement avec ce compteur bidon.
-			 * Cette boucle devrait prendre entre 2 et 4 ticks d'OS (considérez
-			 * exactement 3 ticks pour la question dans l'énoncé).
-			 */
-			 //		Code de l'attente active à compléter, utilisez la constante WAITFORComputing 
-		actualticks = OSTimeGet(&err);//***
-		while (WAITFORComputing + actualticks > OSTimeGet(&err)) {}//***
-		// ****************************************************************** //
-
-		//Verification de l'espace d'addressage
-		if ((packet->src > REJECT_LOW1 && packet->src < REJECT_HIGH1) ||
-			(packet->src > REJECT_LOW2 && packet->src < REJECT_HIGH2) ||
-			(packet->src > REJECT_LOW3 && packet->src < REJECT_HIGH3) ||
-			(packet->src > REJECT_LOW4 && packet->src < REJECT_HIGH4)) {
-			OSMutexPend(&mutRejete, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
-			++nbPacketSourceRejete;
-
-			OSMutexPend(&mutPrint, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
-			printf("\n--TaskComputing: Source invalide (Paquet rejete) (total : %d)\n", nbPacketSourceRejete);
-			printf("\n--Il s agit du paquet\n");
-			printf("	** src : %x \n", packet->src);
-			printf("	** dst : %x \n", packet->dst);
-			OSMutexPost(&mutPrint, OS_OPT_POST_NONE, &err);
-
-			OSMutexPost(&mutRejete, OS_OPT_POST_NONE, &err);
-
-			OSMutexPend(&mutAlloc, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
-			free(packet);
-			OSMutexPost(&mutAlloc, OS_OPT_POST_NONE, &err);
+		packet = pool_prendre(info.id);
+		journal_ecrire(shard, JNL_FIFO_ENTREE_CONSOMMATION, info.id, pool_nb_entrees());//***
+
+		if (!verifier_paquet(packet, shard))
+			continue;
+
+		//Gestion active de la file de destination (RED) ; un paquet marqué est accepté
+		if (packet->type < NB_PACKET_TYPE
+			&& aqm_entree(&Aqm[packet->type], files[packet->type]->MsgQ.NbrEntries) == AQM_JETER) {
+			compteurs_inc(shard, CPT_REJET_AQM);
+			journal_ecrire(shard, JNL_AQM_REJET, packet->type, Aqm[packet->type].jetes);
+
+			paquet_liberer(packet, shard);
 		}
 		else {
 
@@ -307,31 +617,35 @@ void TaskComputing(void* pdata) {
 			switch (packet->type) {
 			case PACKET_VIDEO:
 				//			1) Appel de fonction à compléter et 2) compléter safeprint
-				OSQPost(&highQ, packet, sizeof(Packet), OS_OPT_POST_FIFO, &err); // ***
-				safeprintf("Nb de paquets dans la queue de haute priorité - apres production de TaskComputing: %d \n", highQ.MsgQ.NbrEntries);//***
+				OSQPostTimeout(&highQ, packet, sizeof(Packet), OPT_POST_FILES, ATTENTE_POST_MAX, &err); // ***
+				journal_ecrire(shard, JNL_HIGHQ_PRODUCTION, highQ.MsgQ.NbrEntries);//***
 				break;
 
 			case PACKET_AUDIO:
 				//			1) Appel de fonction à compléter et 2) compléter safeprint
-				OSQPost(&mediumQ, packet, sizeof(Packet), OS_OPT_POST_FIFO, &err); // ***
-				safeprintf("Nb de paquets dans la queue de moyenne priorité - apres production de TaskComputing: %d \n", mediumQ.MsgQ.NbrEntries);//***
+				OSQPostTimeout(&mediumQ, packet, sizeof(Packet), OPT_POST_FILES, ATTENTE_POST_MAX, &err); // ***
+				journal_ecrire(shard, JNL_MEDIUMQ_PRODUCTION, mediumQ.MsgQ.NbrEntries);//***
 				break;
 
 			case PACKET_AUTRE:
 				//			1) Appel de fonction à compléter et 2) compléter safeprint
-				OSQPost(&lowQ, packet, sizeof(Packet), OS_OPT_POST_FIFO, &err); // ***
-				safeprintf("Nb de paquets dans la queue de faible priorité - apres production de TaskComputing: %d \n", lowQ.MsgQ.NbrEntries);//***
+				OSQPostTimeout(&lowQ, packet, sizeof(Packet), OPT_POST_FILES, ATTENTE_POST_MAX, &err); // ***
+				journal_ecrire(shard, JNL_LOWQ_PRODUCTION, lowQ.MsgQ.NbrEntries);//***
 				break;
 
 			default:
-				break;
+				// Type inconnu : le paquet n'a été déposé dans aucune file
+				paquet_liberer(packet, shard);
+				compteurs_inc(shard, CPT_TYPE_INVALIDE);
+				continue;
 			}
-			if (err == OS_ERR_Q_MAX || err == OS_ERR_MSG_POOL_EMPTY ) {
-				safeprintf("TaskComputing : QFULL.\n");
-				OSMutexPend(&mutAlloc, 0, OS_OPT_PEND_BLOCKING, &ts, &err);//***
-				free(packet);//***
-				packet_rejete_3Q++;//***
-				OSMutexPost(&mutAlloc, OS_OPT_POST_NONE, &err);//***
+			if (err == OS_ERR_Q_MAX || err == OS_ERR_MSG_POOL_EMPTY || err == OS_ERR_TIMEOUT) {
+				journal_ecrire(shard, JNL_Q_PLEINE);
+				paquet_liberer(packet, shard);//***
+				compteurs_inc(shard, CPT_REJET_3Q);//***
+			}
+			else if (err == OS_ERR_NONE) {
+				OSSemPost(&semForwarding, OS_OPT_POST_1, &err);
 			}
 
 		}
@@ -342,8 +656,9 @@ void TaskComputing(void* pdata) {
 /*
  *********************************************************************************************************
  *											  TaskForwarding
- *  -traite la priorité des paquets : si un paquet de haute priorité est prêt,
- *   on l'envoie à l'aide de la fonction dispatch_packet, sinon on regarde les paquets de moins haute priorité
+ *  -traite la priorité des paquets : l'ordonnanceur de classes (routeur_ordo.c) choisit la file
+ *   à servir parmi highQ, mediumQ et lowQ, puis le paquet est envoyé à l'aide de la fonction dispatch_packet
+ *  -quand les trois files sont vides, attend la sonnette semForwarding (OS_OPT_PEND_SPIN)
  *********************************************************************************************************
  */
 void TaskForwarding(void* pdata) {
@@ -351,43 +666,136 @@ void TaskForwarding(void* pdata) {
 	CPU_TS ts;
 	OS_MSG_SIZE msg_size;
 	Packet* packet = NULL;
+	int nbPacketTraites = 0;
+	// Une file par classe, dans l'ordre de PACKET_TYPE
+	OS_Q* const files[NB_PACKET_TYPE] = { &highQ, &mediumQ, &lowQ };
+	static const JOURNAL_MSG consommation[NB_PACKET_TYPE] = { JNL_HIGHQ_CONSOMMATION, JNL_MEDIUMQ_CONSOMMATION, JNL_LOWQ_CONSOMMATION };
+	CPU_INT32U nbAttente[NB_PACKET_TYPE];
+	CPU_INT32U classe;
 
 	while (1) {
-		/* Si paquet vidéo prêt */
-//		1) Appel de fonction à compléter et 2) compléter safeprint
-		packet = OSQPend(&highQ, 0, OS_OPT_PEND_NON_BLOCKING, &msg_size, &ts, &err);//***
-		safeprintf("Nb de paquets dans la queue de haute priorité - apres consommation de TaskFowarding: %d \n", highQ.MsgQ.NbrEntries);//***
+		for (classe = 0; classe < NB_PACKET_TYPE; classe++)
+			nbAttente[classe] = files[classe]->MsgQ.NbrEntries;
+
+		classe = ordo_choisir(nbAttente);
+		if (classe == ORDO_AUCUNE) {
+			// Les files sont vides : attente active brève, puis blocage jusqu'au prochain dépôt.
+			// Les jetons accumulés pendant que la tâche servait les files sont remis à zéro au réveil :
+			// les dépôts qu'ils signalent sont déjà visibles dans les files, relues au tour suivant.
+			OSSemPend(&semForwarding, 0, OS_OPT_PEND_BLOCKING | OS_OPT_PEND_SPIN, &ts, &err);
+			OSSemSet(&semForwarding, 0, &err);
+			continue;
+		}
+
+		packet = OSQPend(files[classe], 0, OS_OPT_PEND_NON_BLOCKING, &msg_size, &ts, &err);//***
+		journal_ecrire(SHARD_FORWARDING, consommation[classe], files[classe]->MsgQ.NbrEntries);//***
 		if (err == OS_ERR_NONE) {
+			// CoDel : ts est l'estampille du dépôt du paquet dans la file
+			if (aqm_sortie(&Aqm[classe], ts, files[classe]->MsgQ.NbrEntries) == AQM_JETER) {
+				compteurs_inc(SHARD_FORWARDING, CPT_REJET_AQM);
+				journal_ecrire(SHARD_FORWARDING, JNL_AQM_REJET, classe, Aqm[classe].jetes);
+
+				paquet_liberer(packet, SHARD_FORWARDING);
+				continue;
+			}
+
 			/* Envoi du paquet */
+			ordo_servi(classe, msg_size);
 			++nbPacketTraites;//***
-			safeprintf("\n--TaskForwarding:  paquets %d envoyes\n\n", nbPacketTraites);
-			dispatch_packet(packet);
+			compteurs_inc(SHARD_FORWARDING, CPT_PAQUETS_TRAITES);
+			journal_ecrire(SHARD_FORWARDING, JNL_PAQUETS_ENVOYES, nbPacketTraites);
+			dispatch_packet(packet, SHARD_FORWARDING);
 		}
-		else {
+	}
+}
 
-			/* Si paquet audio prêt */
-//			1) Appel de fonction à compléter et 2) compléter safeprint
-			packet = OSQPend(&mediumQ, 0, OS_OPT_PEND_NON_BLOCKING, &msg_size, &ts, &err);//***
-			safeprintf("Nb de paquets dans la queue de moyenne priorité - apres consommation de TaskFowarding: %d \n", mediumQ.MsgQ.NbrEntries);//***
-			if (err == OS_ERR_NONE) {
-				/* Envoi du paquet */
-				++nbPacketTraites;//***
-				safeprintf("\n--TaskForwarding: paquets %d envoyes\n\n", nbPacketTraites);
-				dispatch_packet(packet);
+/*
+ *********************************************************************************************************
+ *											  TaskRunToCompletion
+ *  -Remplace TaskComputing et TaskForwarding en MODE_RTC ; NB_COMPUTING_TASKS instances en parallèle
+ *  -Prend un lot dans le pool, vérifie chaque paquet, les range par classe, puis l'ordonnanceur de
+ *   classes fixe l'ordre d'envoi du lot comme il le ferait entre highQ, mediumQ et lowQ
+ *  -Les paquets partent directement vers les files des ports (router_paquet)
+ *********************************************************************************************************
+ */
+void TaskRunToCompletion(void* pdata) {
+	OS_ERR err;
+	CPU_TS ts;
+	Info_Port info = *(Info_Port*)pdata;
+	CPU_INT32U shard = SHARD_COMPUTING + info.id;
+	void* lot[LOT_RTC];
+	Packet* parClasse[NB_PACKET_TYPE][LOT_RTC];
+	CPU_INT32U nbAttente[NB_PACKET_TYPE];
+	CPU_INT32U tete[NB_PACKET_TYPE];
+	CPU_INT32U dst[LOT_RTC];
+	CPU_INT16U ports[LOT_RTC];
+	CPU_INT32U src[LOT_RTC];
+	CPU_INT16U regles[LOT_RTC];
+	CPU_BOOLEAN crcOk[LOT_RTC];
+	CPU_INT32U classe, i, n, nbValides, nbEnvois;
+	Packet* packet;
+
+	while (true) {
+		n = pool_prendre_lot(info.id, lot, LOT_RTC);
+		journal_ecrire(shard, JNL_FIFO_ENTREE_CONSOMMATION, info.id, pool_nb_entrees());
+
+		/* Validation et classement */
+		for (classe = 0; classe < NB_PACKET_TYPE; classe++) {
+			nbAttente[classe] = 0;
+			tete[classe] = 0;
+		}
+		for (i = 0; i < n; i++)
+			simuler_traitement(shard);
+
+		// CRC du lot entier, quatre paquets entrelacés à la fois
+		crc_paquet_verifier_lot((Packet* const*)lot, crcOk, n);
+		nbValides = 0;
+		for (i = 0; i < n; i++) {
+			if (crcOk[i])
+				lot[nbValides++] = lot[i];
+			else
+				rejeter_crc(lot[i], shard);
+		}
+
+		// Filtre des sources sur tout le lot (8 adresses à la fois avec AVX2)
+		for (i = 0; i < nbValides; i++)
+			src[i] = ((Packet*)lot[i])->src;
+		filtre_classer_lot(src, regles, nbValides);
+
+		for (i = 0; i < nbValides; i++) {
+			packet = lot[i];
+			if (regles[i] != FILTRE_AUCUNE) {
+				rejeter_source(packet, shard);
+				continue;
 			}
-			else {
-				/* Si paquet autre prêt */
-//				1) Appel de fonction à compléter et 2) compléter safeprint	
-				packet = OSQPend(&lowQ, 0, OS_OPT_PEND_NON_BLOCKING, &msg_size, &ts, &err);//***	
-				safeprintf("Nb de paquets dans la queue de faible priorité - apres consommation de TaskFowarding: %d \n", lowQ.MsgQ.NbrEntries);//***
-				if (err == OS_ERR_NONE) {
-					/* Envoi du paquet */
-					++nbPacketTraites;//***
-					safeprintf("\n--TaskForwarding: paquets %d envoyes\n\n", nbPacketTraites);
-					dispatch_packet(packet);
-				}
+			if (packet->type >= NB_PACKET_TYPE) {
+				paquet_liberer(packet, shard);
+				compteurs_inc(shard, CPT_TYPE_INVALIDE);
+				continue;
 			}
+			parClasse[packet->type][nbAttente[packet->type]++] = packet;
 		}
+
+		/* Ordonnancement : l'ordonnanceur est partagé par les tâches, une seule prise de mutOrdo par lot */
+		nbEnvois = 0;
+		OSMutexPend(&mutOrdo, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
+		while ((classe = ordo_choisir(nbAttente)) != ORDO_AUCUNE) {
+			lot[nbEnvois++] = parClasse[classe][tete[classe]++];
+			nbAttente[classe]--;
+			ordo_servi(classe, sizeof(Packet));
+		}
+		OSMutexPost(&mutOrdo, OS_OPT_POST_NONE, &err);
+
+		/* Envoi des paquets : une seule prise de référence sur la table de routage pour le lot */
+		for (i = 0; i < nbEnvois; i++)
+			dst[i] = ((Packet*)lot[i])->dst;
+		table_chercher_lot(dst, ports, nbEnvois);
+		for (i = 0; i < nbEnvois; i++) {
+			compteurs_inc(shard, CPT_PAQUETS_TRAITES);
+			router_paquet(lot[i], ports[i], shard);
+		}
+		if (nbEnvois > 0)
+			journal_ecrire(shard, JNL_PAQUETS_ENVOYES, compteurs_lire_shard(shard, CPT_PAQUETS_TRAITES));
 	}
 }
 
@@ -395,59 +803,89 @@ void TaskForwarding(void* pdata) {
  *********************************************************************************************************
  *											  Fonction Dispatch
  *  -Envoie le paquet passé en paramètre vers la mailbox correspondante à son adressage destination
+ *  -shard : tranche de compteurs et anneau de journal de la tâche appelante
  *********************************************************************************************************
  */
-void dispatch_packet(Packet* packet) {
-	OS_ERR perr, err = OS_ERR_NONE; //***
-	CPU_TS ts;
-	OS_MSG_SIZE msg_size;
+void dispatch_packet(Packet* packet, CPU_INT32U shard) {
+	/* Recherche de la destination du paquet dans la table de routage */
+	router_paquet(packet, table_chercher(packet->dst), shard);
+}
 
-	/* Test sur la destination du paquet */
-	if (packet->dst >= INT1_LOW && packet->dst <= INT1_HIGH) {
+/*
+ *********************************************************************************************************
+ *											  router_paquet
+ *  -Envoie le paquet vers le port déjà trouvé dans la table de routage (ou ROUTE_DIFFUSION / ROUTE_AUCUNE)
+ *********************************************************************************************************
+ */
+void router_paquet(Packet* packet, CPU_INT16U port, CPU_INT32U shard) {
+	Packet* copie;
+	int i;
 
-		safeprintf("\n--Paquet dans Output Port no 0\n");
-		//		Appel de fonction à compléter
-		OSTaskQPost(&TaskOutputPortTCB[0], packet, sizeof(Packet), OS_OPT_POST_FIFO, &err);//***
+	if (port < NB_OUTPUT_PORTS) {
+		journal_ecrire(shard, JNL_PORT, port);
+		envoyer_port(port, packet, shard);
 	}
-	else {
-		if (packet->dst >= INT2_LOW && packet->dst <= INT2_HIGH) {
-			safeprintf("\n--Paquet dans Output Port no 1\n");
-			//			Appel de fonction à compléter
-			OSTaskQPost(&TaskOutputPortTCB[1], packet, sizeof(Packet), OS_OPT_POST_FIFO, &err);//***
-		}
-		else {
-			if (packet->dst >= INT3_LOW && packet->dst <= INT3_HIGH) {
-				safeprintf("\n--Paquet dans OutputPort no 2\n");
-				//					Appel de fonction à compléter
-				OSTaskQPost(&TaskOutputPortTCB[2], packet, sizeof(Packet), OS_OPT_POST_FIFO, &err);//***
-			}
-			else {
-				if (packet->dst >= INT_BC_LOW && packet->dst <= INT_BC_HIGH) {
-					Packet* others[2];
-					int i;
-					for (i = 0; i < ARRAY_SIZE(others); ++i) {
-						OSMutexPend(&mutAlloc, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
-						others[i] = malloc(sizeof(Packet));
-						OSMutexPost(&mutAlloc, OS_OPT_POST_NONE, &err);
-						memcpy(others[i], packet, sizeof(Packet));
-					}
-					safeprintf("\n--Paquet BC dans Output Port no 0 à 2\n");
-					//						Appels de fonction à compléter
-					OSTaskQPost(&TaskOutputPortTCB[0], packet, sizeof(Packet), OS_OPT_POST_FIFO, &err);//***
-					OSTaskQPost(&TaskOutputPortTCB[1], others[0], sizeof(Packet), OS_OPT_POST_FIFO, &err);//***
-					OSTaskQPost(&TaskOutputPortTCB[2], others[1], sizeof(Packet), OS_OPT_POST_FIFO, &err);//***
-				}
+	else if (port == ROUTE_DIFFUSION) {
+		journal_ecrire(shard, JNL_DIFFUSION, NB_OUTPUT_PORTS - 1);
+		// Une copie par port supplémentaire ; le paquet original part sur le port 0
+		for (i = NB_OUTPUT_PORTS - 1; i > 0; --i) {
+			copie = paquet_allouer(shard);
+			if (copie == NULL) {
+				compteurs_inc(shard, CPT_REJET_PORT_SORTIE);
+				continue;
 			}
+			Mem_Copy(copie, packet, sizeof(Packet));
+			envoyer_port(i, copie, shard);
 		}
+		envoyer_port(0, packet, shard);
+	}
+	else {
+		/*Destruction du paquet si aucune route ne couvre sa destination*/
+		journal_ecrire(shard, JNL_SANS_ROUTE, packet->dst);
+		paquet_liberer(packet, shard);
+		compteurs_inc(shard, CPT_SANS_ROUTE);
 	}
-	if (err == OS_ERR_Q_MAX || err == OS_ERR_MSG_POOL_EMPTY ) {
+}
+
+/*
+ *********************************************************************************************************
+ *											  paquet_allouer
+ *  -Prend un paquet dans la cache de la tranche shard ; NULL si le slab des paquets est épuisé
+ *  -Un paquet peut être libéré par une autre tâche que celle qui l'a alloué : il rejoint alors la
+ *   cache de la tâche qui le libère
+ *********************************************************************************************************
+ */
+Packet* paquet_allouer(CPU_INT32U shard) {
+	LIB_ERR err;
+
+	return (Packet*)Mem_SlabCacheAlloc(&CachePaquets[shard], sizeof(Packet), &err);
+}
+
+void paquet_liberer(Packet* packet, CPU_INT32U shard) {
+	LIB_ERR err;
+
+	Mem_SlabCacheFree(&CachePaquets[shard], packet, &err);
+}
+
+/*
+ *********************************************************************************************************
+ *											  envoyer_port
+ *  -Dépose le paquet dans la file de la tâche du port de sortie, ou le détruit si elle est pleine
+ *   (après au plus ATTENTE_POST_MAX ticks d'attente avec POST_BLOQUANT_EN)
+ *********************************************************************************************************
+ */
+void envoyer_port(int port, Packet* packet, CPU_INT32U shard) {
+	OS_ERR err = OS_ERR_NONE;
+
+	OSTaskQPostTimeout(&TaskOutputPortTCB[port], packet, sizeof(Packet), OPT_POST_FILES, ATTENTE_POST_MAX, &err);//***
+
+	if (err == OS_ERR_Q_MAX || err == OS_ERR_MSG_POOL_EMPTY || err == OS_ERR_TIMEOUT) {
 		/*Destruction du paquet si la mailbox de destination est pleine*/
 
-		OSMutexPend(&mutAlloc, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
-		safeprintf("\n--TaskForwarding: Erreur mailbox full\n");
-		free(packet);
-		packet_rejete_output_port_plein++;
-		OSMutexPost(&mutAlloc, OS_OPT_POST_NONE, &err);
+		journal_ecrire(shard, JNL_PORT_PLEIN);
+		paquet_liberer(packet, shard);
+		compteurs_inc(shard, CPT_REJET_PORT_SORTIE);
+		jetons_perte(&Jetons[port]);
 
 	}
 }
@@ -456,36 +894,54 @@ void dispatch_packet(Packet* packet) {
  *********************************************************************************************************
  *											  TaskPrint
  *  -Affiche les infos des paquets arrivés à destination et libere la mémoire allouée
+ *  -Le paquet ne part qu'une fois ses jetons disponibles (débit du lien, DEBIT_PORT) ;
+ *   en attendant, les paquets suivants restent dans la file du port
+ *  -File vide : la tâche dort jusqu'à LOT_REVEIL_PORT paquets ou ATTENTE_REVEIL_PORT ticks, puis
+ *   les OSTaskQPend suivants rendent les paquets accumulés sans bloquer
+ *  -Enregistre la latence de chaque paquet depuis sa création, par port et par classe (Latences)
  *********************************************************************************************************
  */
 void TaskOutputPort(void* data) {
 	OS_ERR err, perr;
 	CPU_TS ts;
 	OS_MSG_SIZE msg_size;
+	OS_TICK attente;
 	Packet* packet = NULL;
 	Info_Port info = *(Info_Port*)data;
 	while (1) {
 		/*Attente d'un paquet*/
 //		1) Appel de fonction à compléter, 2) compléter err_msg 
-		packet = OSTaskQPend(0, OS_OPT_PEND_BLOCKING, &msg_size, &ts, &err);//***
+		packet = OSTaskQPend(0, OS_OPT_PEND_BLOCKING | OS_OPT_PEND_COALESCE, &msg_size, &ts, &err);//***
 		err_msg("PRINT : erreur dans la recherche du packet", err); //***
 
-		OSMutexPend(&mutPrint, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
+		/*Attente des jetons*/
+		while ((attente = jetons_prendre(&Jetons[info.id], msg_size, OSTimeGet(&err))) > 0)
+			OSTimeDly(attente, OS_OPT_TIME_DLY, &err);
+
+		/*Latence de bout en bout, au départ du paquet sur le lien*/
+		if (packet->type < NB_PACKET_TYPE)
+			latence_ajouter(&Latences[info.id][packet->type], packet->ts, OS_TS_GET());
+
 		/*impression des infos du paquets*/
-		printf("\nPaquet recu en %d \n", info.id);
-		printf("    >> src : %x \n", packet->src);
-		printf("    >> dst : %x \n", packet->dst);
-		printf("    >> type : %d \n", packet->type);
-		OSMutexPost(&mutPrint, OS_OPT_POST_NONE, &err);
+		journal_ecrire(SHARD_OUTPUT_PORT + info.id, JNL_PAQUET_RECU, info.id, packet->src, packet->dst, packet->type);
 
 		/*Libération de la mémoire*/
-		OSMutexPend(&mutAlloc, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
-		free(packet);
-		OSMutexPost(&mutAlloc, OS_OPT_POST_NONE, &err);
+		paquet_liberer(packet, SHARD_OUTPUT_PORT + info.id);
 	}
 
 }
 
+/*
+ *********************************************************************************************************
+ *                                              afficher_latence
+ *  -Quantiles de somme, en us (p50, p99, p99,9 et maximum)
+ *********************************************************************************************************
+ */
+static void afficher_latence(const char* nom, int no, const LATENCE_HISTO* somme) {
+	printf("   - %s %d : %u paquets, p50 %u, p99 %u, p99.9 %u, max %u \n", nom, no, somme->total,
+	       latence_quantile(somme, 5000), latence_quantile(somme, 9900), latence_quantile(somme, 9990), somme->max_us);
+}
+
 /*
  *********************************************************************************************************
  *                                              TaskStats
@@ -497,10 +953,18 @@ void TaskStats(void* pdata) {
 	OS_ERR err, perr;
 	CPU_TS ts;
 	OS_TICK actualticks;
+	COMPTEURS_PHOTO avant, apres;
+	LATENCE_HISTO somme;
+#if (APP_CFG_INT_ENTREE_EN == DEF_ENABLED)
+	BSP_INT_STAT stat_int;
+#endif
 
 	OSTaskSuspend(&TaskGenerateTCB, &err);
-	OSTaskSuspend(&TaskComputingTCB, &err);
-	OSTaskSuspend(&TaskForwardingTCB, &err);
+	for (int i = 0; i < NB_COMPUTING_TASKS; i++) {
+		OSTaskSuspend(&TaskComputingTCB[i], &err);
+	}
+	if (ModeRouteur == MODE_PIPELINE)
+		OSTaskSuspend(&TaskForwardingTCB, &err);
 
 	for (int i = 0; i < NB_OUTPUT_PORTS; i++) {
 		OSTaskSuspend(&TaskOutputPortTCB[i], &err);
@@ -510,75 +974,142 @@ void TaskStats(void* pdata) {
 	OSStatReset(&err);
 
 	OSTaskResume(&TaskGenerateTCB, &err);
-	OSTaskResume(&TaskComputingTCB, &err);
-	OSTaskResume(&TaskForwardingTCB, &err);
+	for (int i = 0; i < NB_COMPUTING_TASKS; i++) {
+		OSTaskResume(&TaskComputingTCB[i], &err);
+	}
+	if (ModeRouteur == MODE_PIPELINE)
+		OSTaskResume(&TaskForwardingTCB, &err);
 	for (int i = 0; i < NB_OUTPUT_PORTS; i++) {
 		OSTaskResume(&TaskOutputPortTCB[i], &err);
 	}
 
+	compteurs_photo(&avant);
+
 	while (1) {
+		compteurs_photo(&apres);
+
 		OSMutexPend(&mutPrint, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
 
-		printf("\n------------------ Affichage des statistiques ------------------\n\n");
+		printf("\n------------------ Affichage des statistiques (%s) ------------------\n\n", mode_nom());
 
 		// À compléter en utilisant la numérotation de 1 à 15  dans l'énoncé du laboratoire
 		// 1)  Nb de paquets total créés
-		printf("1- Nb de paquets total crees : %d \n", nbPacketCrees);
+		printf("1- Nb de paquets total crees : %llu (%llu/s) \n", apres.total[CPT_PAQUETS_CREES], compteurs_taux(&avant, &apres, CPT_PAQUETS_CREES));
 
 		// 2)  Nb de paquets total traités 
-		printf("2- Nb de paquets total traites : %d \n\n", nbPacketTraites);
+		printf("2- Nb de paquets total traites : %llu (%llu/s) \n\n", apres.total[CPT_PAQUETS_TRAITES], compteurs_taux(&avant, &apres, CPT_PAQUETS_TRAITES));
 
 		// 3)  Nb de paquets rejetés pour mauvaise source (adresse)
-		printf("3- Nb de paquets rejetes pour mauvaise source (adresse) : %d \n", nbPacketSourceRejete);
+		printf("3- Nb de paquets rejetes pour mauvaise source (adresse) : %llu \n", apres.total[CPT_SOURCE_REJETE]);
+		for (CPU_INT16U r = 0, nb = 0; r < filtre_nb_regles() && nb < 16; r++) {
+			if (filtre_nb_correspondances(r) != 0) {
+				printf("   - regle %u : %u \n", r, filtre_nb_correspondances(r));
+				nb++;
+			}
+		}
+
+		printf("3.5- Nb de paquets rejetes pour mauvais CRC (%s) : %llu \n", crc_implementation(), apres.total[CPT_REJET_CRC]);
+		printf("3.6- Nb de paquets de type invalide : %llu \n", apres.total[CPT_TYPE_INVALIDE]);
 
 		// 4)  Nb de paquets rejetés dans la fifo d’entrée 
-		printf("4- Nb de paquets rejetes dans la fifo d entree : %d \n", packet_rejete_fifo_pleine_inputQ);
+		printf("4- Nb de paquets rejetes dans la fifo d entree : %llu (%llu/s) \n", apres.total[CPT_REJET_FIFO_ENTREE], compteurs_taux(&avant, &apres, CPT_REJET_FIFO_ENTREE));
+
+		printf("4.5- Nb de paquets rejetes dans les Q : %llu (%llu/s)\n", apres.total[CPT_REJET_3Q], compteurs_taux(&avant, &apres, CPT_REJET_3Q));
 
-		printf("4.5- Nb de paquets rejetes dans les Q : %d\n", packet_rejete_3Q);
+		printf("4.6- Nb de paquets rejetes par la gestion active des Q (%s) : %llu (%llu/s)\n", aqm_nom(&Aqm[0]), apres.total[CPT_REJET_AQM], compteurs_taux(&avant, &apres, CPT_REJET_AQM));
 
 		// 5)  Nb de paquets rejetés dans l’interface de sortie 
-		printf("5- Nb de paquets rejetes dans l interface de sortie : %d \n\n", packet_rejete_output_port_plein);
+		printf("5- Nb de paquets rejetes dans l interface de sortie : %llu \n", apres.total[CPT_REJET_PORT_SORTIE]);
+
+		printf("5.5- Nb de paquets sans route : %llu \n", apres.total[CPT_SANS_ROUTE]);
+
+		// Mise en forme des ports : paquets retardés faute de jetons et attente en ticks
+		for (int i = 0; i < NB_OUTPUT_PORTS; i++) {
+			printf("   - port %d : %u envoyes, %u retardes (attente moy %u, max %u ticks), %u pertes, file max %d, %u reveils \n", i,
+			       Jetons[i].nb_paquets, Jetons[i].nb_retardes, jetons_attente_moyenne(&Jetons[i]), Jetons[i].attente_max,
+			       Jetons[i].pertes, TaskOutputPortTCB[i].MsgQ.NbrEntriesMax, TaskOutputPortTCB[i].CtxSwCtr);
+		}
+		printf("\n");
 
 		// 6)  Nb de paquets maximum dans le fifo d'entrée
-		printf("6- Nb de paquets maximum dans le fifo d entree : %d \n", TaskStatsTCB.MsgQ.NbrEntriesMax); 
+		printf("6- Nb de paquets maximum dans le fifo d entree : %u \n", pool_nb_entrees_max());
 
 		// 7)  Nb de paquets maximum dans highQ 
-		printf("7- Nb de paquets maximum dans highQ : %d \n", highQ.MsgQ.NbrEntriesMax);
+		printf("7- Nb de paquets maximum dans highQ : %d (AQM : %u jetes, %u marques, sejour max %u us) \n", highQ.MsgQ.NbrEntriesMax,
+		       Aqm[0].jetes, Aqm[0].marques, Aqm[0].sejour_max_us);
 
 		// 8)  Nb de paquets maximum dans mediumQ 
-		printf("8- Nb de paquets maximum dans mediumQ : %d \n", mediumQ.MsgQ.NbrEntriesMax);
+		printf("8- Nb de paquets maximum dans mediumQ : %d (AQM : %u jetes, %u marques, sejour max %u us) \n", mediumQ.MsgQ.NbrEntriesMax,
+		       Aqm[1].jetes, Aqm[1].marques, Aqm[1].sejour_max_us);
 
 		// 9)  Nb de paquets maximum dans lowQ 
-		printf("9- Nb de paquets maximum dans lowQ : %d \n\n", lowQ.MsgQ.NbrEntriesMax);
+		printf("9- Nb de paquets maximum dans lowQ : %d (AQM : %u jetes, %u marques, sejour max %u us) \n", lowQ.MsgQ.NbrEntriesMax,
+		       Aqm[2].jetes, Aqm[2].marques, Aqm[2].sejour_max_us);
+
+		printf("9.5- Paquets servis par TaskForwarding (%s) : \n", ordo_nom());
+		for (int i = 0; i < NB_PACKET_TYPE; i++) {
+			printf("   - classe %d : %llu paquets, %llu octets \n", i, ordo_nb_servis(i), ordo_octets_servis(i));
+		}
+		printf("\n");
+
+		// Latence de la création du paquet à son départ sur le port de sortie, depuis le démarrage
+		printf("9.6- Latence de bout en bout par classe (us) : \n");
+		for (int c = 0; c < NB_PACKET_TYPE; c++) {
+			latence_raz(&somme);
+			for (int i = 0; i < NB_OUTPUT_PORTS; i++)
+				latence_cumuler(&somme, &Latences[i][c]);
+			afficher_latence("classe", c, &somme);
+		}
+		printf("9.7- Latence de bout en bout par port (us) : \n");
+		for (int i = 0; i < NB_OUTPUT_PORTS; i++) {
+			latence_raz(&somme);
+			for (int c = 0; c < NB_PACKET_TYPE; c++)
+				latence_cumuler(&somme, &Latences[i][c]);
+			afficher_latence("port", i, &somme);
+		}
+		printf("\n");
 
 		// 10) Pourcentage de temps CPU Max de TaskGenerate 
-		printf("10- Pourcentage de temps CPU Max de TaskGenerate : %u\% \n", TaskGenerateTCB.CPUUsageMax);
+		printf("10- Pourcentage de temps CPU Max de TaskGenerate : %u%% \n", TaskGenerateTCB.CPUUsageMax);
 
 		// 11) Pourcentage de temps CPU Max TaskComputing 
-		printf("11- Pourcentage de temps CPU Max de TaskComputing : %u\% \n", TaskComputingTCB.CPUUsageMax);
+		printf("11- Pourcentage de temps CPU Max de TaskComputing (%d taches, %llu paquets/s) : \n", NB_COMPUTING_TASKS, compteurs_taux(&avant, &apres, CPT_PAQUETS_CALCULES));
+		for (int i = 0; i < NB_COMPUTING_TASKS; i++) {
+			printf("   - no %d : %u%% (%llu paquets, %u flux voles) \n", i, TaskComputingTCB[i].CPUUsageMax, compteurs_lire_shard(SHARD_COMPUTING + i, CPT_PAQUETS_CALCULES), pool_nb_vols(i));
+		}
 
 		// 12)  Pourcentage de temps CPU Max TaskFowarding 
-		printf("12- Pourcentage de temps CPU Max de TaskFowarding : %u\% \n", TaskForwardingTCB.CPUUsageMax);
+		printf("12- Pourcentage de temps CPU Max de TaskFowarding : %u%% \n", TaskForwardingTCB.CPUUsageMax);
 
-		// 13) Pourcentage de temps CPU Max TaskOutputPort no 1 
-		printf("13- Pourcentage de temps CPU Max de TaskOutputPort no 1 : %u\% \n", TaskOutputPortTCB[0].CPUUsageMax);
-
-		// 14) Pourcentage de temps CPU Max TaskOutputPort no 2 
-		printf("14- Pourcentage de temps CPU Max de TaskOutputPort no 2 : %u\% \n", TaskOutputPortTCB[1].CPUUsageMax);
-
-		// 15) Pourcentage de temps CPU Max TaskOutputPort no 3 
-		printf("15- Pourcentage de temps CPU Max de TaskOutputPort no 3 : %u\% \n", TaskOutputPortTCB[2].CPUUsageMax);
+		// 13) Pourcentage de temps CPU Max TaskOutputPort (un sous-item par port)
+		printf("13- Pourcentage de temps CPU Max de TaskOutputPort (%d ports) : \n", NB_OUTPUT_PORTS);
+		for (int i = 0; i < NB_OUTPUT_PORTS; i++) {
+			printf("   - no %d : %u%% \n", i + 1, TaskOutputPortTCB[i].CPUUsageMax);
+		}
 
-		printf("16- Pourcentage de temps CPU  : %d \n", OSStatTaskCPUUsage / 100);
-		printf("17- Pourcentage de temps CPU Max : %d \n", OSStatTaskCPUUsageMax / 100);
-		printf("18- Message free : %d \n", OSMsgPool.NbrFree);
-		printf("19- Message used : %d \n", OSMsgPool.NbrUsed);
-		printf("20- Message used max : %d \n", OSMsgPool.NbrUsedMax);
+		printf("14- Pourcentage de temps CPU  : %d \n", OSStatTaskCPUUsage / 100);
+		printf("15- Pourcentage de temps CPU Max : %d \n", OSStatTaskCPUUsageMax / 100);
+		printf("16- Message free : %d \n", OSMsgPool.NbrFree);
+		printf("17- Message used : %d \n", OSMsgPool.NbrUsed);
+		printf("18- Message used max : %d \n", OSMsgPool.NbrUsedMax);
+		printf("19- Messages de journal ecrits : %llu, perdus : %llu \n", journal_nb_ecrits(), journal_nb_pertes());
+#if (APP_CFG_INT_ENTREE_EN == DEF_ENABLED)
+		BSP_IntStatGet(INT_ENTREE, &stat_int);
+		printf("20- Interruptions d'entree : %u servies, %u perdues, imbrication max %u \n", stat_int.Nbr, stat_int.OvfCtr, BSP_IntNestMaxGet());
+		if (stat_int.Nbr > 0)
+			printf("    latence d'entree (ns) : min %llu, moy %llu, max %llu \n",
+			       CPU_TS32_to_nSec(stat_int.LatMin),
+			       CPU_TS64_to_nSec(stat_int.LatTot / stat_int.Nbr),
+			       CPU_TS32_to_nSec(stat_int.LatMax));
+#endif
 
 		OSMutexPost(&mutPrint, OS_OPT_POST_NONE, &err);
 
 		Suspend_Delay_Resume_All(10);
 
+		// Les débits sont calculés sur la période où le routeur tourne, pas sur la pause
+		compteurs_photo(&avant);
+
 		OSTimeDlyHMSM(0, 0, 10, 0, OS_OPT_TIME_HMSM_STRICT, &err);
 	}
 }
@@ -597,8 +1128,11 @@ void Suspend_Delay_Resume_All(int nb_sec) {
 	int i;
 
 	OSTaskSuspend(&TaskGenerateTCB, &err);
-	OSTaskSuspend(&TaskComputingTCB, &err);
-	OSTaskSuspend(&TaskForwardingTCB, &err);
+	for (i = 0; i < NB_COMPUTING_TASKS; i++) {
+		OSTaskSuspend(&TaskComputingTCB[i], &err);
+	}
+	if (ModeRouteur == MODE_PIPELINE)
+		OSTaskSuspend(&TaskForwardingTCB, &err);
 
 	for (i = 0; i < NB_OUTPUT_PORTS; i++) {
 		OSTaskSuspend(&TaskOutputPortTCB[i], &err);
@@ -607,8 +1141,11 @@ void Suspend_Delay_Resume_All(int nb_sec) {
 	OSTimeDlyHMSM(0, 0, nb_sec, 0, OS_OPT_TIME_HMSM_STRICT, &err);
 	
 	OSTaskResume(&TaskGenerateTCB, &err);
-	OSTaskResume(&TaskComputingTCB, &err);
-	OSTaskResume(&TaskForwardingTCB, &err);
+	for (i = 0; i < NB_COMPUTING_TASKS; i++) {
+		OSTaskResume(&TaskComputingTCB[i], &err);
+	}
+	if (ModeRouteur == MODE_PIPELINE)
+		OSTaskResume(&TaskForwardingTCB, &err);
 	for (i = 0; i < NB_OUTPUT_PORTS; i++) {
 		OSTaskResume(&TaskOutputPortTCB[i], &err);
 	}
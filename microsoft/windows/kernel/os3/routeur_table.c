@@ -0,0 +1,349 @@
+/*
+*********************************************************************************************************
+*                                                 uC/OS-III
+*                                          The Real-Time Kernel
+*                                               PORT Windows
+*
+*
+*                                  Polytechnique Montreal, Qc, CANADA
+*
+* File : routeur_table.c
+*
+*********************************************************************************************************
+*/
+
+#include "routeur_table.h"
+
+#include  <stdio.h>
+#include  <lib_str.h>
+#include  "routeur_atomique.h"
+
+#define TABLE_EXT				0x8000u				// L'entrée pointe vers un bloc du niveau suivant
+#define TABLE_VAL				0x7FFFu
+
+typedef struct {
+	// Nb de recherches en cours dans cette table, sur sa propre ligne de cache
+	volatile CPU_INT32U lecteurs;
+	CPU_INT08U          pad[ATOM_TAILLE_LIGNE_CACHE - sizeof(CPU_INT32U)];
+
+	CPU_INT32U nb_blocs;
+	CPU_INT32U nb_routes;
+	CPU_INT16U niv1[1u << 16];
+	CPU_INT16U blocs[TABLE_NB_BLOCS_MAX][256];
+} TABLE_ROUTAGE;
+
+static ATOM_ALIGNE_CACHE TABLE_ROUTAGE Tables[2];
+static TABLE_ROUTAGE* volatile TableActive = &Tables[0];
+
+static OS_MUTEX mutTable;							// Un seul écrivain à la fois
+
+static ROUTE RoutesTriees[TABLE_NB_ROUTES_MAX];
+static ROUTE RoutesLues[TABLE_NB_ROUTES_MAX];
+
+
+static void table_vider(TABLE_ROUTAGE* t) {
+	CPU_INT32U i;
+
+	for (i = 0u; i < (1u << 16); i++)
+		t->niv1[i] = ROUTE_AUCUNE;
+	t->nb_blocs = 0u;
+	t->nb_routes = 0u;
+}
+
+/*
+ * Alloue un bloc de 256 entrées initialisé avec la valeur de l'entrée qu'il remplace,
+ * pour que les adresses non couvertes par le nouveau préfixe gardent la route plus courte.
+ */
+static int table_nouveau_bloc(TABLE_ROUTAGE* t, CPU_INT16U val) {
+	CPU_INT32U i;
+
+	if (t->nb_blocs >= TABLE_NB_BLOCS_MAX)
+		return -1;
+
+	for (i = 0u; i < 256u; i++)
+		t->blocs[t->nb_blocs][i] = val;
+
+	return (int)t->nb_blocs++;
+}
+
+/*
+ * Les routes doivent être insérées par longueur de préfixe croissante : un préfixe plus long
+ * écrase alors toujours un préfixe plus court, et une plage à remplir ne contient jamais
+ * d'entrée déjà étendue vers un bloc.
+ */
+static TABLE_ERR table_inserer(TABLE_ROUTAGE* t, const ROUTE* r) {
+	CPU_INT32U masque = (r->longueur == 0u) ? 0u : (0xFFFFFFFFu << (32u - r->longueur));
+	CPU_INT32U pre = r->prefixe & masque;
+	CPU_INT16U* e;
+	CPU_INT16U* bloc;
+	CPU_INT32U debut, nb, i;
+	int b;
+
+	if (r->longueur <= 16u) {
+		debut = pre >> 16;
+		nb = 1u << (16u - r->longueur);
+		for (i = 0u; i < nb; i++)
+			t->niv1[debut + i] = r->port;
+		return TABLE_OK;
+	}
+
+	e = &t->niv1[pre >> 16];
+	if ((*e & TABLE_EXT) == 0u) {
+		b = table_nouveau_bloc(t, *e);
+		if (b < 0)
+			return TABLE_ERR_PLEINE;
+		*e = (CPU_INT16U)(TABLE_EXT | b);
+	}
+	bloc = t->blocs[*e & TABLE_VAL];
+
+	if (r->longueur <= 24u) {
+		debut = (pre >> 8) & 0xFFu;
+		nb = 1u << (24u - r->longueur);
+	}
+	else {
+		e = &bloc[(pre >> 8) & 0xFFu];
+		if ((*e & TABLE_EXT) == 0u) {
+			b = table_nouveau_bloc(t, *e);
+			if (b < 0)
+				return TABLE_ERR_PLEINE;
+			*e = (CPU_INT16U)(TABLE_EXT | b);
+		}
+		bloc = t->blocs[*e & TABLE_VAL];
+		debut = pre & 0xFFu;
+		nb = 1u << (32u - r->longueur);
+	}
+
+	for (i = 0u; i < nb; i++)
+		bloc[debut + i] = r->port;
+
+	return TABLE_OK;
+}
+
+static CPU_INT16U table_chercher_dans(const TABLE_ROUTAGE* t, CPU_INT32U dst) {
+	CPU_INT16U e = t->niv1[dst >> 16];
+
+	if (e & TABLE_EXT) {
+		e = t->blocs[e & TABLE_VAL][(dst >> 8) & 0xFFu];
+		if (e & TABLE_EXT)
+			e = t->blocs[e & TABLE_VAL][dst & 0xFFu];
+	}
+	return e;
+}
+
+// Prend une référence sur la table active ; revalide pour ne jamais lire une table en reconstruction
+static TABLE_ROUTAGE* table_acquerir(void) {
+	TABLE_ROUTAGE* t;
+
+	for (;;) {
+		t = (TABLE_ROUTAGE*)ATOM_LIRE_PTR(&TableActive);
+		ATOM_INC32(&t->lecteurs);
+		if ((TABLE_ROUTAGE*)ATOM_LIRE_PTR(&TableActive) == t)
+			return t;
+		ATOM_DEC32(&t->lecteurs);
+	}
+}
+
+
+/*
+ *********************************************************************************************************
+ *											  table_init
+ *  - Crée le mutex des écrivains et publie une table vide (aucune route)
+ *********************************************************************************************************
+ */
+TABLE_ERR table_init(void) {
+	OS_ERR err;
+
+	OSMutexCreate(&mutTable, "mutTable", &err);
+	table_vider(&Tables[0]);
+	ATOM_ECRIRE_PTR(&TableActive, &Tables[0]);
+
+	return TABLE_OK;
+}
+
+/*
+ *********************************************************************************************************
+ *											  table_construire
+ *  - Construit une nouvelle table à partir de nb routes dans la table inactive, puis la publie.
+ *  - Les recherches en cours continuent sur l'ancienne table ; on attend qu'elles soient toutes
+ *    terminées avant de réutiliser cette dernière à la prochaine mise à jour.
+ *  - Pour deux routes de même préfixe et même longueur, la dernière de la liste l'emporte.
+ *********************************************************************************************************
+ */
+TABLE_ERR table_construire(const ROUTE* routes, CPU_INT32U nb) {
+	OS_ERR err;
+	CPU_TS ts;
+	TABLE_ROUTAGE* cible;
+	CPU_INT32U debut[34];
+	CPU_INT32U i, l;
+	TABLE_ERR res = TABLE_OK;
+
+	if (routes == NULL || nb > TABLE_NB_ROUTES_MAX)
+		return TABLE_ERR_ARG;
+	for (i = 0u; i < nb; i++) {
+		if (routes[i].longueur > 32u || (routes[i].port > TABLE_PORT_MAX && routes[i].port != ROUTE_DIFFUSION))
+			return TABLE_ERR_ARG;
+	}
+
+	OSMutexPend(&mutTable, 0, OS_OPT_PEND_BLOCKING, &ts, &err);
+
+	cible = ((TABLE_ROUTAGE*)ATOM_LIRE_PTR(&TableActive) == &Tables[0]) ? &Tables[1] : &Tables[0];
+	while (ATOM_LIRE32(&cible->lecteurs) != 0u)
+		OSTimeDly(1, OS_OPT_TIME_DLY, &err);
+
+	// Tri par dénombrement sur la longueur du préfixe (stable, donc la dernière route l'emporte)
+	for (l = 0u; l <= 33u; l++)
+		debut[l] = 0u;
+	for (i = 0u; i < nb; i++)
+		debut[routes[i].longueur + 1u]++;
+	for (l = 1u; l <= 33u; l++)
+		debut[l] += debut[l - 1u];
+	for (i = 0u; i < nb; i++)
+		RoutesTriees[debut[routes[i].longueur]++] = routes[i];
+
+	table_vider(cible);
+	for (i = 0u; i < nb && res == TABLE_OK; i++)
+		res = table_inserer(cible, &RoutesTriees[i]);
+
+	if (res == TABLE_OK) {
+		cible->nb_routes = nb;
+		ATOM_ECRIRE_PTR(&TableActive, cible);
+	}
+
+	OSMutexPost(&mutTable, OS_OPT_POST_NONE, &err);
+
+	return res;
+}
+
+/*
+ *********************************************************************************************************
+ *											  table_charger_fichier
+ *  - Lit une route par ligne, sous la forme « a.b.c.d/longueur port » ou « a.b.c.d/longueur bc »
+ *  - Les lignes vides et celles qui commencent par '#' sont ignorées
+ *  - Le fichier entier est refusé si une ligne est mal formée (TABLE_ERR_SYNTAXE), si un port n'existe
+ *    pas (>= nb_ports, TABLE_ERR_PORT) ou s'il contient plus de TABLE_NB_ROUTES_MAX routes
+ *    (TABLE_ERR_PLEINE) ; la table active est conservée et *ligne_err reçoit le numéro de la ligne
+ *    fautive (0 si l'erreur ne vient pas d'une ligne)
+ *********************************************************************************************************
+ */
+TABLE_ERR table_charger_fichier(const char* chemin, CPU_INT16U nb_ports, CPU_INT32U* ligne_err) {
+	FILE* f;
+	char ligne[128];
+	CPU_CHAR* p;
+	CPU_CHAR* suite;
+	CPU_INT32U nb = 0u, no_ligne = 0u;
+	CPU_INT32U octet, i;
+	TABLE_ERR res = TABLE_OK;
+	ROUTE r;
+
+#ifdef _MSC_VER
+	if (fopen_s(&f, chemin, "r") != 0)
+		f = NULL;
+#else
+	f = fopen(chemin, "r");
+#endif
+	*ligne_err = 0u;
+	if (f == NULL)
+		return TABLE_ERR_FICHIER;
+
+	while (res == TABLE_OK && fgets(ligne, sizeof(ligne), f) != NULL) {
+		no_ligne++;
+		p = ligne;
+		while (*p == ' ' || *p == '\t')
+			p++;
+		if (*p == '#' || *p == '\n' || *p == '\r' || *p == '\0')
+			continue;
+
+		r.prefixe = 0u;
+		for (i = 0u; i < 4u; i++) {
+			octet = Str_ParseNbr_Int32U(p, &suite, 10u);
+			if (suite == p || octet > 255u || *suite != ((i < 3u) ? '.' : '/'))
+				break;
+			r.prefixe = (r.prefixe << 8) | octet;
+			p = suite + 1;
+		}
+		if (i < 4u) {
+			res = TABLE_ERR_SYNTAXE;					// Préfixe mal formé
+			break;
+		}
+
+		octet = Str_ParseNbr_Int32U(p, &suite, 10u);
+		if (suite == p || octet > 32u) {
+			res = TABLE_ERR_SYNTAXE;					// Longueur absente ou trop grande
+			break;
+		}
+		r.longueur = (CPU_INT08U)octet;
+
+		p = suite;
+		while (*p == ' ' || *p == '\t')
+			p++;
+		if ((p[0] == 'b' || p[0] == 'B') && (p[1] == 'c' || p[1] == 'C')) {
+			r.port = ROUTE_DIFFUSION;
+		}
+		else {
+			octet = Str_ParseNbr_Int32U(p, &suite, 10u);
+			if (suite == p) {
+				res = TABLE_ERR_SYNTAXE;				// Port absent
+				break;
+			}
+			if (octet >= nb_ports || octet > TABLE_PORT_MAX) {
+				res = TABLE_ERR_PORT;					// Route vers un port inexistant
+				break;
+			}
+			r.port = (CPU_INT16U)octet;
+		}
+
+		if (nb >= TABLE_NB_ROUTES_MAX) {
+			res = TABLE_ERR_PLEINE;
+			break;
+		}
+		RoutesLues[nb++] = r;
+	}
+	fclose(f);
+
+	if (res != TABLE_OK) {
+		*ligne_err = no_ligne;
+		return res;
+	}
+	if (nb == 0u)
+		return TABLE_ERR_FICHIER;
+
+	return table_construire(RoutesLues, nb);
+}
+
+/*
+ *********************************************************************************************************
+ *											  table_chercher
+ *  - Retourne le port de sortie de dst (plus long préfixe), ROUTE_DIFFUSION ou ROUTE_AUCUNE
+ *********************************************************************************************************
+ */
+CPU_INT16U table_chercher(CPU_INT32U dst) {
+	TABLE_ROUTAGE* t = table_acquerir();
+	CPU_INT16U port = table_chercher_dans(t, dst);
+
+	ATOM_DEC32(&t->lecteurs);
+	return port;
+}
+
+/*
+ *********************************************************************************************************
+ *											  table_chercher_lot
+ *  - Même chose que table_chercher sur nb destinations, avec une seule prise de référence
+ *********************************************************************************************************
+ */
+void table_chercher_lot(const CPU_INT32U* dst, CPU_INT16U* ports, CPU_INT32U nb) {
+	TABLE_ROUTAGE* t = table_acquerir();
+	CPU_INT32U i;
+
+	for (i = 0u; i < nb; i++)
+		ports[i] = table_chercher_dans(t, dst[i]);
+
+	ATOM_DEC32(&t->lecteurs);
+}
+
+CPU_INT32U table_nb_routes(void) {
+	TABLE_ROUTAGE* t = table_acquerir();
+	CPU_INT32U nb = t->nb_routes;
+
+	ATOM_DEC32(&t->lecteurs);
+	return nb;
+}
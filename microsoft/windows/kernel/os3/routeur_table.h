@@ -0,0 +1,50 @@
+/*
+ * routeur_table.h
+ *
+ *  Table de routage du routeur (recherche du plus long préfixe sur packet->dst).
+ *
+ *  Structure DIR-16-8-8 : un premier niveau de 65536 entrées indexé par les 16 bits de poids
+ *  fort, puis des blocs de 256 entrées pour les octets suivants. Une recherche coûte au plus
+ *  trois accès mémoire, quel que soit le nombre de préfixes.
+ *
+ *  Deux tables sont allouées : la mise à jour se construit dans la table inactive puis est
+ *  publiée par un simple échange de pointeur, sans bloquer les tâches qui font des recherches.
+ */
+
+#ifndef SRC_ROUTEUR_TABLE_H_
+#define SRC_ROUTEUR_TABLE_H_
+
+#include <os.h>
+
+#define TABLE_NB_BLOCS_MAX		4096u				// Blocs de 256 entrées pour les niveaux 2 et 3
+#define TABLE_NB_ROUTES_MAX		16384u
+#define TABLE_FICHIER_ROUTES	"routes.txt"
+
+// Valeurs spéciales de la sortie d'une recherche (les ports vont de 0 à TABLE_PORT_MAX)
+#define TABLE_PORT_MAX			0x7FFDu
+#define ROUTE_DIFFUSION			0x7FFEu				// Paquet à copier sur tous les ports
+#define ROUTE_AUCUNE			0x7FFFu				// Aucun préfixe ne couvre la destination
+
+typedef enum {
+	TABLE_OK = 0,
+	TABLE_ERR_ARG = -1,
+	TABLE_ERR_PLEINE = -2,
+	TABLE_ERR_FICHIER = -3,
+	TABLE_ERR_PORT = -4,
+	TABLE_ERR_SYNTAXE = -5
+} TABLE_ERR;
+
+typedef struct {
+	CPU_INT32U prefixe;
+	CPU_INT08U longueur;							// 0 à 32 bits
+	CPU_INT16U port;								// 0 à TABLE_PORT_MAX ou ROUTE_DIFFUSION
+} ROUTE;
+
+TABLE_ERR  table_init(void);
+TABLE_ERR  table_construire(const ROUTE* routes, CPU_INT32U nb);
+TABLE_ERR  table_charger_fichier(const char* chemin, CPU_INT16U nb_ports, CPU_INT32U* ligne_err);
+CPU_INT16U table_chercher(CPU_INT32U dst);
+void       table_chercher_lot(const CPU_INT32U* dst, CPU_INT16U* ports, CPU_INT32U nb);
+CPU_INT32U table_nb_routes(void);
+
+#endif /* SRC_ROUTEUR_TABLE_H_ */
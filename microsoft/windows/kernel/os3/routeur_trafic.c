@@ -0,0 +1,177 @@
+/*
+*********************************************************************************************************
+*                                                 uC/OS-III
+*                                          The Real-Time Kernel
+*                                               PORT Windows
+*
+*
+*                                  Polytechnique Montreal, Qc, CANADA
+*
+* File : routeur_trafic.c
+*
+*********************************************************************************************************
+*/
+
+#include "routeur_trafic.h"
+
+#include  <stdlib.h>
+#include  <math.h>
+
+#define TRAFIC_ECHELLE_ALEA		4294967296.0		// 2^32 : Math_RandStreamGet rend 32 bits
+
+
+CPU_INT32U trafic_alea32(TRAFIC_FLUX* flux) {
+	return Math_RandStreamGet(&flux->alea);
+}
+
+// Uniforme dans ]0, 1]
+static double trafic_uniforme(TRAFIC_FLUX* flux) {
+	return ((double)Math_RandStreamGet(&flux->alea) + 1.0) / TRAFIC_ECHELLE_ALEA;
+}
+
+static CPU_INT32U trafic_tirer(TRAFIC_FLUX* flux, CPU_INT32U min, CPU_INT32U max) {
+	if (max - min == 0xFFFFFFFFu)
+		return trafic_alea32(flux);
+
+	return min + trafic_alea32(flux) % (max - min + 1u);
+}
+
+// Délai (en ticks) jusqu'à l'arrivée suivante
+static double trafic_inter_arrivee(TRAFIC_FLUX* flux) {
+	const TRAFIC_CONFIG* cfg = &flux->cfg;
+	double delai;
+
+	switch (cfg->modele) {
+	case TRAFIC_POISSON:
+		return -log(trafic_uniforme(flux)) / cfg->debit;
+
+	case TRAFIC_PARETO:
+		// Échelle choisie pour que la moyenne alpha * xm / (alpha - 1) vaille 1 / debit
+		return ((cfg->forme - 1.0) / (cfg->forme * cfg->debit)) / pow(trafic_uniforme(flux), 1.0 / cfg->forme);
+
+	case TRAFIC_ON_OFF:
+		delai = 1.0 / cfg->debit;
+		if (--flux->reste_rafale == 0u) {
+			flux->reste_rafale = trafic_tirer(flux, cfg->rafale_min, cfg->rafale_max);
+			delai += (double)cfg->silence;
+		}
+		return delai;
+
+	case TRAFIC_CONSTANT:
+	default:
+		return 1.0 / cfg->debit;
+	}
+}
+
+
+/*
+ *********************************************************************************************************
+ *											  trafic_init
+ *  - Copie la configuration et place la première arrivée après maintenant
+ *  - TRAFIC_ON_OFF commence par un silence, comme l'ancien TaskGenerate
+ *********************************************************************************************************
+ */
+TRAFIC_ERR trafic_init(TRAFIC_FLUX* flux, const TRAFIC_CONFIG* cfg, OS_TICK maintenant) {
+	CPU_INT32U i;
+
+	if (flux == NULL || cfg == NULL || !(cfg->debit > 0.0))
+		return TRAFIC_ERR_ARG;
+	if (cfg->modele == TRAFIC_PARETO && !(cfg->forme > 1.0))
+		return TRAFIC_ERR_ARG;
+	if (cfg->modele == TRAFIC_ON_OFF && (cfg->rafale_min == 0u || cfg->rafale_min > cfg->rafale_max))
+		return TRAFIC_ERR_ARG;
+	if (cfg->destinations == NULL && cfg->nb_destinations > 0u)
+		return TRAFIC_ERR_ARG;
+
+	flux->cfg = *cfg;
+	Math_RandStreamInit(&flux->alea, cfg->graine, 0u);
+	flux->dernier = maintenant;
+	flux->nb_emis = 0u;
+
+	flux->total_classes = 0u;
+	for (i = 0u; i < NB_PACKET_TYPE; i++)
+		flux->total_classes += cfg->poids_classe[i];
+
+	flux->total_destinations = 0u;
+	for (i = 0u; i < cfg->nb_destinations; i++) {
+		if (cfg->destinations[i].bas > cfg->destinations[i].haut)
+			return TRAFIC_ERR_ARG;
+		flux->total_destinations += cfg->destinations[i].poids;
+	}
+	if (cfg->nb_destinations > 0u && flux->total_destinations == 0u)
+		return TRAFIC_ERR_ARG;
+
+	if (cfg->modele == TRAFIC_ON_OFF) {
+		flux->reste_rafale = trafic_tirer(flux, cfg->rafale_min, cfg->rafale_max);
+		flux->prochaine = (double)maintenant + (double)cfg->silence;
+	}
+	else {
+		flux->reste_rafale = 0u;
+		flux->prochaine = (double)maintenant + trafic_inter_arrivee(flux);
+	}
+	return TRAFIC_OK;
+}
+
+/*
+ *********************************************************************************************************
+ *											  trafic_nb_arrivees
+ *  - Retourne le nombre de paquets échus jusqu'à la fin du tick maintenant (au plus max).
+ *    Ceux qui dépassent max restent dus et seront rendus à l'appel suivant.
+ *  - L'appelant est censé se réveiller à chaque tick. Un écart plus grand (tâche suspendue) décale
+ *    le calendrier d'autant : une pause ne produit pas de rafale de rattrapage.
+ *********************************************************************************************************
+ */
+CPU_INT32U trafic_nb_arrivees(TRAFIC_FLUX* flux, OS_TICK maintenant, CPU_INT32U max) {
+	CPU_INT32U n = 0u;
+	double fin = (double)maintenant + 1.0;
+
+	if (maintenant - flux->dernier > 1u)
+		flux->prochaine += (double)(maintenant - flux->dernier - 1u);
+	flux->dernier = maintenant;
+
+	while (n < max && flux->prochaine < fin) {
+		flux->prochaine += trafic_inter_arrivee(flux);
+		n++;
+	}
+	flux->nb_emis += n;
+
+	return n;
+}
+
+/*
+ *********************************************************************************************************
+ *											  trafic_remplir_paquet
+ *  - Source uniforme, classe et destination tirées selon les poids de la configuration
+ *  - Le contenu est aléatoire ; l'appelant numérote le paquet et calcule son CRC
+ *********************************************************************************************************
+ */
+void trafic_remplir_paquet(TRAFIC_FLUX* flux, Packet* packet) {
+	const TRAFIC_CONFIG* cfg = &flux->cfg;
+	const TRAFIC_PLAGE* plage;
+	CPU_INT32U x, i;
+
+	packet->src = trafic_alea32(flux);
+
+	if (cfg->nb_destinations == 0u) {
+		packet->dst = trafic_alea32(flux);
+	}
+	else {
+		x = trafic_alea32(flux) % flux->total_destinations;
+		for (plage = cfg->destinations; x >= plage->poids; plage++)
+			x -= plage->poids;
+		packet->dst = trafic_tirer(flux, plage->bas, plage->haut);
+	}
+
+	if (flux->total_classes == 0u) {
+		packet->type = (PACKET_TYPE)(trafic_alea32(flux) % NB_PACKET_TYPE);
+	}
+	else {
+		x = trafic_alea32(flux) % flux->total_classes;
+		for (i = 0u; x >= cfg->poids_classe[i]; i++)
+			x -= cfg->poids_classe[i];
+		packet->type = (PACKET_TYPE)i;
+	}
+
+	// Tout le contenu d'un coup, avec SSE2 si lib_mem l'a choisi
+	Math_RandStreamFill(&flux->alea, packet->data, sizeof(packet->data) / sizeof(packet->data[0]));
+}
@@ -0,0 +1,66 @@
+/*
+ * routeur_trafic.h
+ *
+ *  Générateur de trafic déterministe pour TaskGenerate.
+ *
+ *  Chaque flux possède son propre flot pseudo-aléatoire (MATH_RAND_STREAM de uC-LIB, sans verrou),
+ *  initialisé par une graine : une même configuration reproduit exactement la même suite de paquets.
+ *  Le modèle d'arrivée donne la date (en ticks) de chaque paquet ; à chaque réveil, la tâche émet
+ *  d'un coup tous les paquets dont la date est échue.
+ */
+
+#ifndef SRC_ROUTEUR_TRAFIC_H_
+#define SRC_ROUTEUR_TRAFIC_H_
+
+#include <os.h>
+#include <lib_math.h>
+#include "paquet.h"
+
+typedef enum {
+	TRAFIC_CONSTANT,								// Un paquet tous les 1/debit ticks
+	TRAFIC_POISSON,									// Inter-arrivées exponentielles de moyenne 1/debit
+	TRAFIC_ON_OFF,									// Rafales au débit debit, séparées par des silences
+	TRAFIC_PARETO									// Inter-arrivées de Pareto (forme alpha), moyenne 1/debit
+} TRAFIC_MODELE;
+
+typedef enum {
+	TRAFIC_OK = 0,
+	TRAFIC_ERR_ARG = -1
+} TRAFIC_ERR;
+
+typedef struct {
+	CPU_INT32U bas;									// Bornes incluses
+	CPU_INT32U haut;
+	CPU_INT32U poids;
+} TRAFIC_PLAGE;
+
+typedef struct {
+	TRAFIC_MODELE       modele;
+	RAND_NBR            graine;
+	double              debit;						// Paquets par tick (pendant les rafales pour TRAFIC_ON_OFF)
+	double              forme;						// TRAFIC_PARETO : alpha > 1
+	CPU_INT32U          rafale_min;					// TRAFIC_ON_OFF : paquets par rafale, tirés dans [min, max]
+	CPU_INT32U          rafale_max;
+	CPU_INT32U          silence;					// TRAFIC_ON_OFF : ticks entre deux rafales
+	CPU_INT32U          poids_classe[NB_PACKET_TYPE];
+	const TRAFIC_PLAGE* destinations;				// NULL : destinations uniformes sur 32 bits
+	CPU_INT32U          nb_destinations;
+} TRAFIC_CONFIG;
+
+typedef struct {
+	TRAFIC_CONFIG    cfg;
+	MATH_RAND_STREAM alea;
+	double           prochaine;						// Date de la prochaine arrivée, en ticks
+	OS_TICK          dernier;						// Tick du dernier appel à trafic_nb_arrivees
+	CPU_INT32U       reste_rafale;
+	CPU_INT32U       total_classes;
+	CPU_INT32U       total_destinations;
+	CPU_INT64U       nb_emis;
+} TRAFIC_FLUX;
+
+TRAFIC_ERR trafic_init(TRAFIC_FLUX* flux, const TRAFIC_CONFIG* cfg, OS_TICK maintenant);
+CPU_INT32U trafic_nb_arrivees(TRAFIC_FLUX* flux, OS_TICK maintenant, CPU_INT32U max);
+void       trafic_remplir_paquet(TRAFIC_FLUX* flux, Packet* packet);
+CPU_INT32U trafic_alea32(TRAFIC_FLUX* flux);
+
+#endif /* SRC_ROUTEUR_TRAFIC_H_ */